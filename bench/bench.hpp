@@ -0,0 +1,97 @@
+#if !defined(RAYMATH_BENCH_HPP)
+#define RAYMATH_BENCH_HPP
+/**
+ * @file   bench.hpp
+ * @brief  Timing and JSON output shared by the benchmarks.
+*/
+#include "../raymath.hpp"
+#include <chrono>
+#include <cstdio>
+
+// NOTE(alicia): define the RAYMATH_CPP_ macros a benchmark needs
+// before including this, it includes raymath.hpp itself.
+// every benchmark prints one JSON object per line,
+// { "bench": ..., "name": ..., "ns": ..., ... }, so the output of two
+// compilers or flag sets can be diffed line by line.
+// times are the best of several runs, in nanoseconds per element
+// (or per call where a benchmark says so).
+namespace bench {
+
+/// Keeps the optimizer from dropping a value.
+template<typename T> inline
+void Use( const T& value ) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile( "" : : "r"( &value ) : "memory" );
+#else
+    static const void* volatile sink;
+    sink = &value;
+#endif
+}
+/// Memory clobber, values stored before it are considered read.
+inline
+void Clobber() {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile( "" : : : "memory" );
+#endif
+}
+
+/// Best time of repeats runs of fn(), divided by per.
+template<typename Fn> inline
+double Best( const Fn& fn, double per = 1.0, int repeats = 7 ) {
+    double best = 1e300;
+    for( int r = 0; r < repeats; ++r ) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        fn();
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>( end - start ).count();
+        best = ns < best ? ns : best;
+    }
+    return best / per;
+}
+
+/// The compiler and the SIMD level the header picked.
+inline
+const char* Target() {
+#if defined(RAYMATH_CPP_NO_SIMD)
+    return "scalar";
+#elif defined(RAYMATH_CPP_AVX2) && defined(RAYMATH_CPP_FMA)
+    return "avx2+fma";
+#elif defined(RAYMATH_CPP_AVX2)
+    return "avx2";
+#elif defined(RAYMATH_CPP_AVX)
+    return "avx";
+#elif defined(RAYMATH_CPP_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+inline
+const char* Compiler() {
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc";
+#else
+    return "unknown";
+#endif
+}
+
+/// One result line. extra is either null or more "key": value pairs.
+inline
+void Print( const char* benchmark, const char* name, double ns, const char* extra = nullptr ) {
+    std::printf( "{ \"bench\": \"%s\", \"name\": \"%s\", \"ns\": %.3f, \"target\": \"%s\"%s%s }\n",
+        benchmark, name, ns, Target(), extra ? ", " : "", extra ? extra : "" );
+}
+/// First line of a benchmark: what built it.
+inline
+void Header( const char* benchmark ) {
+    std::printf( "{ \"bench\": \"%s\", \"compiler\": \"%s\", \"target\": \"%s\" }\n",
+        benchmark, Compiler(), Target() );
+}
+
+} // namespace bench
+
+#endif /* header guard */
@@ -0,0 +1,57 @@
+/**
+ * @file   bvh_build.cpp
+ * @brief  Bvh::Build time from 1K to 1M primitives.
+ *
+ * Build (-I the folder with raymath.h):
+ *   g++ -O2 bench/bvh_build.cpp -o bvh_build
+ *   ./bvh_build [max primitives]
+ * Max primitives defaults to 1M. "ns" is per primitive, "ms" the
+ * whole build, both the best of 5 builds. With -DRAYMATH_CPP_PARALLEL
+ * -pthread it also times Build( pool, ... ) on the default pool.
+*/
+#include "bench.hpp"
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+int main( int argc, char** argv ) {
+    size_t maxCount = argc > 1 ? (size_t)std::atoll( argv[1] ) : (size_t)1 << 20;
+
+    // NOTE(alicia): small boxes scattered in a flat slab, roughly what
+    // a scene's triangles look like, plus a few big ones.
+    std::mt19937 rng( 99 );
+    std::uniform_real_distribution<float> position( -500.0f, 500.0f );
+    std::uniform_real_distribution<float> height( 0.0f, 40.0f );
+    std::uniform_real_distribution<float> size( 0.05f, 2.0f );
+    std::vector<Vector3> min( maxCount ), max( maxCount );
+    for( size_t i = 0; i < maxCount; ++i ) {
+        Vector3 c = { position( rng ), height( rng ), position( rng ) };
+        float   e = i % 1000 == 0 ? 50.0f : size( rng );
+        min[i] = Vector3{ c.x - e, c.y - e, c.z - e };
+        max[i] = Vector3{ c.x + e, c.y + e, c.z + e };
+    }
+
+    bench::Header( "bvh_build" );
+    char extra[128];
+    for( size_t count = 1024; count <= maxCount; count *= 4 ) {
+        Bvh bvh;
+        double ns = bench::Best( [&]() {
+            bvh.Build( min.data(), max.data(), count );
+            bench::Clobber();
+        }, (double)count, 5 );
+        std::snprintf( extra, sizeof(extra), "\"count\": %zu, \"ms\": %.3f, \"nodes\": %zu",
+            count, ns * (double)count * 1e-6, bvh.nodeCount );
+        bench::Print( "bvh_build", "Build", ns, extra );
+#if defined(RAYMATH_CPP_PARALLEL)
+        ThreadPool& pool = ThreadPool::Default();
+        ns = bench::Best( [&]() {
+            bvh.Build( pool, min.data(), max.data(), count );
+            bench::Clobber();
+        }, (double)count, 5 );
+        std::snprintf( extra, sizeof(extra), "\"count\": %zu, \"ms\": %.3f, \"threads\": %u",
+            count, ns * (double)count * 1e-6, pool.ThreadCount() );
+        bench::Print( "bvh_build", "Build(pool)", ns, extra );
+#endif
+    }
+    return 0;
+}
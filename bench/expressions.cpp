@@ -0,0 +1,79 @@
+/**
+ * @file   expressions.cpp
+ * @brief  Eager operators against RAYMATH_CPP_EXPRESSIONS for chained Vec3/Vec4 math.
+ *
+ * Build it twice and diff the output (-I the folder with raymath.h):
+ *   g++ -O2 -mavx2 -mfma -ffp-contract=off bench/expressions.cpp -o eager
+ *   g++ -O2 -mavx2 -mfma -ffp-contract=off -DRAYMATH_CPP_EXPRESSIONS bench/expressions.cpp -o fused
+ * GCC contracts the eager operators into FMA by itself without -ffp-contract=off.
+ * Chain3/Chain4 are kept out of line so their code can be compared with
+ *   objdump -d --no-show-raw-insn -C fused | awk '/<Chain4/,/ret/'
+*/
+#include "bench.hpp"
+
+#if defined(RAYMATH_CPP_EXPRESSIONS)
+    #define MODE "fused"
+#else
+    #define MODE "eager"
+#endif
+#if defined(__GNUC__) || defined(__clang__)
+    #define NOINLINE __attribute__((noinline))
+#else
+    #define NOINLINE __declspec(noinline)
+#endif
+
+NOINLINE Vec3 Chain3( const Vec3& a, const Vec3& b, const Vec3& c, float s, float t ) {
+    return a + b * s - c * t;
+}
+NOINLINE Vec4 Chain4( const Vec4& a, const Vec4& b, const Vec4& c, float s, float t ) {
+    return a + b * s - c * t;
+}
+
+int main() {
+    const size_t count = 4096;
+    static Vec3 a3[count], b3[count], c3[count], out3[count];
+    static Vec4 a4[count], b4[count], c4[count], out4[count];
+    for( size_t i = 0; i < count; ++i ) {
+        float f = (float)i;
+        a3[i] = Vec3( f, f + 1.0f, f + 2.0f );
+        b3[i] = Vec3( 0.5f * f, 1.0f, -f );
+        c3[i] = Vec3( 1.0f, -0.25f * f, 2.0f );
+        a4[i] = Vec4( f, f + 1.0f, f + 2.0f, f + 3.0f );
+        b4[i] = Vec4( 0.5f * f, 1.0f, -f, 2.0f );
+        c4[i] = Vec4( 1.0f, -0.25f * f, 2.0f, f );
+    }
+    bench::Header( "expressions" );
+
+    // NOTE(alicia): inlined chains, what user code sees.
+    double ns = bench::Best( [&]() {
+        for( size_t i = 0; i < count; ++i ) {
+            out3[i] = a3[i] + b3[i] * 0.5f - c3[i] * 0.25f;
+        }
+        bench::Clobber();
+    }, (double)count, 201 );
+    bench::Print( "expressions", "Vec3 a + b * s - c * t", ns, "\"mode\": \"" MODE "\"" );
+    ns = bench::Best( [&]() {
+        for( size_t i = 0; i < count; ++i ) {
+            out4[i] = a4[i] + b4[i] * 0.5f - c4[i] * 0.25f;
+        }
+        bench::Clobber();
+    }, (double)count, 201 );
+    bench::Print( "expressions", "Vec4 a + b * s - c * t", ns, "\"mode\": \"" MODE "\"" );
+
+    // NOTE(alicia): one call per element, the codegen of Chain3/Chain4.
+    ns = bench::Best( [&]() {
+        for( size_t i = 0; i < count; ++i ) {
+            out3[i] = Chain3( a3[i], b3[i], c3[i], 0.5f, 0.25f );
+        }
+        bench::Clobber();
+    }, (double)count, 201 );
+    bench::Print( "expressions", "Chain3 call", ns, "\"mode\": \"" MODE "\"" );
+    ns = bench::Best( [&]() {
+        for( size_t i = 0; i < count; ++i ) {
+            out4[i] = Chain4( a4[i], b4[i], c4[i], 0.5f, 0.25f );
+        }
+        bench::Clobber();
+    }, (double)count, 201 );
+    bench::Print( "expressions", "Chain4 call", ns, "\"mode\": \"" MODE "\"" );
+    return 0;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file   fast_math_error.cpp
+ * @brief  Measured error of the FastMath estimate against the bound it documents.
+ *
+ * Build (-I the folder with raymath.h):
+ *   g++ -O2 bench/fast_math_error.cpp -o fast_math_error
+ *   ./fast_math_error
+ * Exits with 1 when an error goes over the bound or a special case
+ * (zero, tiny, huge, inf) is wrong, so it can run as a check.
+*/
+#include "bench.hpp"
+#include <cfloat>
+#include <cmath>
+#include <random>
+#include <vector>
+
+static int failures = 0;
+
+/// One result line, the error in place of a time.
+static void Report( const char* name, const char* extra ) {
+    std::printf( "{ \"bench\": \"fast_math_error\", \"name\": \"%s\", \"target\": \"%s\", %s }\n",
+        name, bench::Target(), extra );
+}
+
+static void Check( bool ok, const char* what ) {
+    if( !ok ) {
+        std::printf( "{ \"bench\": \"fast_math_error\", \"fail\": \"%s\" }\n", what );
+        ++failures;
+    }
+}
+
+int main() {
+    const double bound = 3.4e-7;
+    bench::Header( "fast_math_error" );
+
+    // NOTE(alicia): squared lengths are log uniform from 1e-30 to 1e30,
+    // well inside Min..Max. the odd count runs the scalar tail too.
+    std::mt19937 rng( 1234 );
+    std::uniform_real_distribution<double> exponent( -30.0, 30.0 );
+    std::uniform_real_distribution<float>  mantissa( 1.0f, 2.0f );
+    const size_t count = ( (size_t)1 << 20 ) + 3;
+    std::vector<float> lengthSqr( count ), inverse( count );
+    for( size_t i = 0; i < count; ++i ) {
+        lengthSqr[i] = (float)std::pow( 10.0, exponent( rng ) ) * mantissa( rng );
+    }
+    SoAStream::InverseLengthFast( lengthSqr.data(), inverse.data(), count );
+    double worst = 0.0, worstTail = 0.0;
+    for( size_t i = 0; i < count; ++i ) {
+        double exact = 1.0 / std::sqrt( (double)lengthSqr[i] );
+        double error = std::fabs( inverse[i] / exact - 1.0 );
+        if( i >= count - count % 4 ) {
+            worstTail = error > worstTail ? error : worstTail;
+        } else {
+            worst = error > worst ? error : worst;
+        }
+    }
+    char extra[128];
+    std::snprintf( extra, sizeof(extra), "\"error\": %.3g, \"bound\": %.3g, \"count\": %zu", worst, bound, count );
+    Report( "InverseLengthFast", extra );
+    std::snprintf( extra, sizeof(extra), "\"error\": %.3g, \"bound\": %.3g, \"count\": %zu", worstTail, bound, count % 4 );
+    Report( "InverseLengthFast tail", extra );
+    Check( worst <= bound, "InverseLengthFast over the bound" );
+    Check( worstTail <= bound, "InverseLengthFast tail over the bound" );
+
+    // 1 below Min, 0 above Max, in the wide loop and in the tail.
+    const float special[] = { 0.0f, 1e-39f, FastMath::Min, FLT_MAX, INFINITY, 0.0f, 1e-39f, INFINITY };
+    float out[8];
+    SoAStream::InverseLengthFast( special, out, 8 );
+    for( int i = 0; i < 8; i += 5 ) {
+        Check( out[i] == 1.0f && out[i + 1] == 1.0f, "InverseLengthFast below Min is not 1" );
+    }
+    Check( out[2] > 0.0f && std::isfinite( out[2] ), "InverseLengthFast at Min" );
+    Check( out[3] > 0.0f, "InverseLengthFast at Max" );
+    Check( out[4] == 0.0f && out[7] == 0.0f, "InverseLengthFast of inf is not 0" );
+
+    std::printf( "{ \"bench\": \"fast_math_error\", \"failures\": %d }\n", failures );
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,115 @@
+/**
+ * @file   mat4_multiply.cpp
+ * @brief  Mat4 multiply kernels against raymath.h MatrixMultiply.
+ *
+ * Build (-I the folder with raymath.h):
+ *   g++ -O2 bench/mat4_multiply.cpp -o mat4_multiply
+ *   g++ -O2 -mavx2 -mfma bench/mat4_multiply.cpp -o mat4_multiply_avx2
+ *   g++ -O2 -DRAYMATH_CPP_RUNTIME_DISPATCH bench/mat4_multiply.cpp -o mat4_multiply_dispatch
+ * "ns" is per product over 128 independent pairs that fit in L1,
+ * "speedup" is relative to MatrixMultiply and "max_ulp" the biggest
+ * difference of any element from Mat4MultiplyScalar. Elements are
+ * positive, so no result is a cancellation close to 0 where any
+ * rounding difference would be thousands of ulps.
+*/
+#include "bench.hpp"
+#include <cstring>
+
+static const int Count  = 128;
+static const int Repeat = 64;
+
+static Matrix left[Count], right[Count], out[Count], reference[Count];
+
+static unsigned int seed = 2024;
+static float Random( float lo, float hi ) {
+    seed = seed * 1664525u + 1013904223u;
+    return lo + ( hi - lo ) * (float)( seed >> 8 ) * ( 1.0f / 16777216.0f );
+}
+
+/// Distance in representable floats, 0 for the same bits.
+static unsigned int Ulp( float a, float b ) {
+    int ia, ib;
+    std::memcpy( &ia, &a, sizeof(ia) );
+    std::memcpy( &ib, &b, sizeof(ib) );
+    ia = ia < 0 ? (int)( 0x80000000u - (unsigned int)ia ) : ia;
+    ib = ib < 0 ? (int)( 0x80000000u - (unsigned int)ib ) : ib;
+    return ia > ib ? (unsigned int)ia - (unsigned int)ib : (unsigned int)ib - (unsigned int)ia;
+}
+static unsigned int MaxUlp() {
+    unsigned int worst = 0;
+    for( int i = 0; i < Count; ++i ) {
+        const float* a = &out[i].m0;
+        const float* b = &reference[i].m0;
+        for( int k = 0; k < 16; ++k ) {
+            unsigned int ulp = Ulp( a[k], b[k] );
+            worst = ulp > worst ? ulp : worst;
+        }
+    }
+    return worst;
+}
+
+typedef void (*Kernel)( const Matrix& left, const Matrix& right, Matrix* out );
+
+static void Time( const char* name, Kernel kernel, double raw ) {
+    double ns = bench::Best( [&]() {
+        for( int r = 0; r < Repeat; ++r ) {
+            for( int i = 0; i < Count; ++i ) {
+                kernel( left[i], right[i], out + i );
+            }
+            bench::Clobber();
+        }
+    }, (double)( Count * Repeat ), 15 );
+    char extra[96];
+    std::snprintf( extra, sizeof(extra), "\"speedup\": %.2f, \"max_ulp\": %u", raw / ns, MaxUlp() );
+    bench::Print( "mat4_multiply", name, ns, extra );
+}
+
+int main() {
+    for( int i = 0; i < Count; ++i ) {
+        float* l = &left[i].m0;
+        float* r = &right[i].m0;
+        for( int k = 0; k < 16; ++k ) {
+            l[k] = Random( 0.5f, 2.0f );
+            r[k] = Random( 0.5f, 2.0f );
+        }
+        Mat4MultiplyScalar( left[i], right[i], reference + i );
+    }
+
+    bench::Header( "mat4_multiply" );
+    double raw = bench::Best( [&]() {
+        for( int r = 0; r < Repeat; ++r ) {
+            for( int i = 0; i < Count; ++i ) {
+                out[i] = MatrixMultiply( left[i], right[i] );
+            }
+            bench::Clobber();
+        }
+    }, (double)( Count * Repeat ), 15 );
+    char extra[96];
+    std::snprintf( extra, sizeof(extra), "\"speedup\": 1.00, \"max_ulp\": %u", MaxUlp() );
+    bench::Print( "mat4_multiply", "MatrixMultiply", raw, extra );
+
+    // NOTE(alicia): the kernels are called through a pointer like the
+    // runtime dispatch does, Mat4::Multiply below is inlined.
+    Time( "Mat4MultiplyScalar", Mat4MultiplyScalar, raw );
+#if defined(RAYMATH_CPP_SSE2) || defined(RAYMATH_CPP_DISPATCH)
+    Time( "Mat4MultiplySSE2", Mat4MultiplySSE2, raw );
+#endif
+#if defined(RAYMATH_CPP_AVX) || defined(RAYMATH_CPP_DISPATCH)
+#if defined(RAYMATH_CPP_DISPATCH)
+    if( __builtin_cpu_supports( "avx" ) && __builtin_cpu_supports( "fma" ) )
+#endif
+    Time( "Mat4MultiplyAVX", Mat4MultiplyAVX, raw );
+#endif
+
+    double ns = bench::Best( [&]() {
+        for( int r = 0; r < Repeat; ++r ) {
+            for( int i = 0; i < Count; ++i ) {
+                out[i] = Mat4( left[i] ).Multiply( right[i] );
+            }
+            bench::Clobber();
+        }
+    }, (double)( Count * Repeat ), 15 );
+    std::snprintf( extra, sizeof(extra), "\"speedup\": %.2f, \"max_ulp\": %u", raw / ns, MaxUlp() );
+    bench::Print( "mat4_multiply", "Mat4::Multiply", ns, extra );
+    return 0;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file   parallel_scaling.cpp
+ * @brief  ThreadPool batch overloads from 1 to N threads.
+ *
+ * Build (-I the folder with raymath.h):
+ *   g++ -O2 -pthread bench/parallel_scaling.cpp -o parallel_scaling
+ *   ./parallel_scaling [max threads] [elements]
+ * Max threads defaults to std::thread::hardware_concurrency(),
+ * elements to 4M (48MB of Vector3 in, 48MB out).
+ * "threads": 0 is the regular single threaded call, "speedup" is
+ * relative to it.
+*/
+#if !defined(RAYMATH_CPP_PARALLEL)
+#define RAYMATH_CPP_PARALLEL
+#endif
+#include "bench.hpp"
+#include <cstdlib>
+#include <vector>
+
+int main( int argc, char** argv ) {
+    unsigned maxThreads = argc > 1 ? (unsigned)std::atoi( argv[1] ) : std::thread::hardware_concurrency();
+    size_t   count      = argc > 2 ? (size_t)std::atoll( argv[2] ) : (size_t)1 << 22;
+    if( !maxThreads ) {
+        maxThreads = 1;
+    }
+
+    std::vector<Vector3> v( count ), w( count ), out( count );
+    std::vector<Vector4> v4( count ), out4( count );
+    for( size_t i = 0; i < count; ++i ) {
+        v[i]  = Vector3{ (float)( i % 97 ) - 40.0f, (float)( i % 13 ) * 0.5f + 1.0f, (float)( i % 7 ) - 3.0f };
+        w[i]  = Vector3{ 1.0f, (float)i * 1e-3f, 2.0f };
+        v4[i] = Vector4{ v[i].x, v[i].y, v[i].z, 1.0f };
+    }
+    Matrix m = MatrixMultiply( MatrixRotateXYZ( Vector3{ 0.3f, 0.7f, -1.1f } ), MatrixTranslate( 1, 2, 3 ) );
+    m.m3 = 0.01f;
+    Matrix viewProj = MatrixMultiply(
+        MatrixLookAt( Vector3{ 0, 0, 100 }, Vector3{ 0, 0, 0 }, Vector3{ 0, 1, 0 } ),
+        MatrixPerspective( 1.0, 1.5, 0.1, 1000.0 ) );
+
+    bench::Header( "parallel_scaling" );
+
+    // NOTE(alicia): each kernel is timed with no pool first, then
+    // with 1..maxThreads. the pool is built outside the timing.
+    struct Kernel {
+        const char* name;
+        void (*serial)( void* );
+        void (*parallel)( ThreadPool&, void* );
+    };
+    struct Data {
+        const Vector3* v;
+        const Vector3* w;
+        Vector3*       out;
+        const Vector4* v4;
+        Vector4*       out4;
+        Matrix         m;
+        Matrix         viewProj;
+        size_t         count;
+    } data = { v.data(), w.data(), out.data(), v4.data(), out4.data(), m, viewProj, count };
+
+    const Kernel kernels[] = {
+        { "Transform",
+            []( void* p ) { Data& d = *(Data*)p; Transform( d.v, d.m, d.out, d.count ); },
+            []( ThreadPool& pool, void* p ) { Data& d = *(Data*)p; Transform( pool, d.v, d.m, d.out, d.count ); } },
+        { "TransformDirection",
+            []( void* p ) { Data& d = *(Data*)p; TransformDirection( d.v, d.m, d.out, d.count ); },
+            []( ThreadPool& pool, void* p ) { Data& d = *(Data*)p; TransformDirection( pool, d.v, d.m, d.out, d.count ); } },
+        { "TransformProject",
+            []( void* p ) { Data& d = *(Data*)p; TransformProject( d.v, d.viewProj, d.out, d.count ); },
+            []( ThreadPool& pool, void* p ) { Data& d = *(Data*)p; TransformProject( pool, d.v, d.viewProj, d.out, d.count ); } },
+        { "Normalize",
+            []( void* p ) { Data& d = *(Data*)p; Normalize( d.v, d.out, d.count ); },
+            []( ThreadPool& pool, void* p ) { Data& d = *(Data*)p; Normalize( pool, d.v, d.out, d.count ); } },
+        { "Lerp",
+            []( void* p ) { Data& d = *(Data*)p; Lerp( d.v, d.w, 0.3f, d.out, d.count ); },
+            []( ThreadPool& pool, void* p ) { Data& d = *(Data*)p; Lerp( pool, d.v, d.w, 0.3f, d.out, d.count ); } },
+        { "Transform(Vector4)",
+            []( void* p ) { Data& d = *(Data*)p; Transform( d.v4, d.m, d.out4, d.count ); },
+            []( ThreadPool& pool, void* p ) { Data& d = *(Data*)p; Transform( pool, d.v4, d.m, d.out4, d.count ); } },
+    };
+
+    char extra[128];
+    for( const Kernel& kernel : kernels ) {
+        double serial = bench::Best( [&]() {
+            kernel.serial( &data );
+            bench::Clobber();
+        }, (double)count, 5 );
+        std::snprintf( extra, sizeof(extra), "\"threads\": 0, \"count\": %zu, \"speedup\": 1.000", count );
+        bench::Print( "parallel_scaling", kernel.name, serial, extra );
+
+        for( unsigned threads = 1; threads <= maxThreads; ++threads ) {
+            ThreadPool pool( threads );
+            double ns = bench::Best( [&]() {
+                kernel.parallel( pool, &data );
+                bench::Clobber();
+            }, (double)count, 5 );
+            std::snprintf( extra, sizeof(extra), "\"threads\": %u, \"count\": %zu, \"speedup\": %.3f",
+                threads, count, serial / ns );
+            bench::Print( "parallel_scaling", kernel.name, ns, extra );
+        }
+    }
+    return 0;
+}
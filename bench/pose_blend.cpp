@@ -0,0 +1,95 @@
+/**
+ * @file   pose_blend.cpp
+ * @brief  Array Slerp, Nlerp and SlerpFast against QuaternionSlerp per bone.
+ *
+ * Build (-I the folder with raymath.h):
+ *   g++ -O2 bench/pose_blend.cpp -o pose_blend
+ *   g++ -O2 -DRAYMATH_CPP_PARALLEL -pthread bench/pose_blend.cpp -o pose_blend_parallel
+ *   ./pose_blend [bones]
+ * Bones default to 64 characters of 256, 16K quaternions per pose.
+ * "ns" is per bone, "bones_per_s" the same as a rate and "speedup" is
+ * relative to QuaternionSlerp. With RAYMATH_CPP_PARALLEL the ThreadPool
+ * overloads run on the default pool as well.
+*/
+#include "bench.hpp"
+#include <cstdlib>
+#include <vector>
+
+static unsigned int seed = 31;
+static float Random( float lo, float hi ) {
+    seed = seed * 1664525u + 1013904223u;
+    return lo + ( hi - lo ) * (float)( seed >> 8 ) * ( 1.0f / 16777216.0f );
+}
+
+static double raw = 0.0;
+static void Report( const char* name, double ns ) {
+    char extra[96];
+    std::snprintf( extra, sizeof(extra), "\"bones_per_s\": %.4g, \"speedup\": %.2f", 1e9 / ns, raw / ns );
+    bench::Print( "pose_blend", name, ns, extra );
+}
+
+int main( int argc, char** argv ) {
+    size_t count = argc > 1 ? (size_t)std::atoll( argv[1] ) : 64 * 256;
+
+    // NOTE(alicia): the layer is the pose turned by up to about 100
+    // degrees, half of them with the sign flipped so the shortest arc
+    // correction runs too.
+    std::vector<Quaternion> pose( count ), layer( count ), out( count );
+    std::vector<float> mask( count );
+    for( size_t i = 0; i < count; ++i ) {
+        pose[i] = QuaternionNormalize( Quaternion{ Random( -1, 1 ), Random( -1, 1 ), Random( -1, 1 ), Random( -1, 1 ) } );
+        Quaternion turn = QuaternionFromAxisAngle(
+            Vector3Normalize( Vector3{ Random( -1, 1 ), Random( -1, 1 ), Random( -1, 1 ) } ), Random( 0.0f, 1.75f ) );
+        layer[i] = QuaternionMultiply( pose[i], turn );
+        if( i % 2 ) {
+            layer[i] = QuaternionScale( layer[i], -1.0f );
+        }
+        mask[i] = Random( 0.0f, 1.0f );
+    }
+    const float weight = 0.35f;
+
+    bench::Header( "pose_blend" );
+    raw = bench::Best( [&]() {
+        for( size_t i = 0; i < count; ++i ) {
+            out[i] = QuaternionSlerp( pose[i], layer[i], weight );
+        }
+        bench::Clobber();
+    }, (double)count );
+    Report( "QuaternionSlerp", raw );
+    Report( "Slerp", bench::Best( [&]() {
+        Slerp( pose.data(), layer.data(), weight, out.data(), count );
+        bench::Clobber();
+    }, (double)count ) );
+    Report( "Slerp(mask)", bench::Best( [&]() {
+        Slerp( pose.data(), layer.data(), mask.data(), out.data(), count );
+        bench::Clobber();
+    }, (double)count ) );
+    Report( "Nlerp", bench::Best( [&]() {
+        Nlerp( pose.data(), layer.data(), weight, out.data(), count );
+        bench::Clobber();
+    }, (double)count ) );
+    Report( "SlerpFast", bench::Best( [&]() {
+        SlerpFast( pose.data(), layer.data(), weight, out.data(), count );
+        bench::Clobber();
+    }, (double)count ) );
+#if defined(RAYMATH_CPP_PARALLEL)
+    ThreadPool& pool = ThreadPool::Default();
+    Report( "Slerp(pool)", bench::Best( [&]() {
+        Slerp( pool, pose.data(), layer.data(), weight, out.data(), count );
+        bench::Clobber();
+    }, (double)count ) );
+    Report( "Slerp(pool, mask)", bench::Best( [&]() {
+        Slerp( pool, pose.data(), layer.data(), mask.data(), out.data(), count );
+        bench::Clobber();
+    }, (double)count ) );
+    Report( "Nlerp(pool)", bench::Best( [&]() {
+        Nlerp( pool, pose.data(), layer.data(), weight, out.data(), count );
+        bench::Clobber();
+    }, (double)count ) );
+    Report( "SlerpFast(pool)", bench::Best( [&]() {
+        SlerpFast( pool, pose.data(), layer.data(), weight, out.data(), count );
+        bench::Clobber();
+    }, (double)count ) );
+#endif
+    return 0;
+}
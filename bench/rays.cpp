@@ -0,0 +1,140 @@
+/**
+ * @file   rays.cpp
+ * @brief  Ray3 single and batch tests against RayPacket4/8, triangles and boxes.
+ *
+ * Build (-I the folder with raymath.h):
+ *   g++ -O2 bench/rays.cpp -o rays
+ *   ./rays [primitives]
+ * Primitives default to 4K triangles and 4K boxes, 64 rays go through
+ * all of them. "ns" is per ray against one primitive, "rays_per_s"
+ * the same as a rate.
+*/
+#include "bench.hpp"
+#include <cstdlib>
+#include <vector>
+
+static unsigned int seed = 99;
+static float Random( float lo, float hi ) {
+    seed = seed * 1664525u + 1013904223u;
+    return lo + ( hi - lo ) * (float)( seed >> 8 ) * ( 1.0f / 16777216.0f );
+}
+static Vector3 RandomVector( float lo, float hi ) {
+    return Vector3{ Random( lo, hi ), Random( lo, hi ), Random( lo, hi ) };
+}
+
+static void Report( const char* name, double ns ) {
+    char extra[64];
+    std::snprintf( extra, sizeof(extra), "\"rays_per_s\": %.4g", 1e9 / ns );
+    bench::Print( "rays", name, ns, extra );
+}
+
+int main( int argc, char** argv ) {
+    size_t count = argc > 1 ? (size_t)std::atoll( argv[1] ) : 4096;
+    const size_t rayCount = 64;
+
+    // NOTE(alicia): small triangles and boxes in front of the rays,
+    // a few percent of the tests hit.
+    std::vector<Vector3> a( count ), b( count ), c( count ), min( count ), max( count );
+    for( size_t i = 0; i < count; ++i ) {
+        Vector3 center = RandomVector( -10.0f, 10.0f );
+        center.z += 30.0f;
+        a[i] = Vector3Add( center, RandomVector( -1.0f, 1.0f ) );
+        b[i] = Vector3Add( center, RandomVector( -1.0f, 1.0f ) );
+        c[i] = Vector3Add( center, RandomVector( -1.0f, 1.0f ) );
+        Vector3 extent = RandomVector( 0.1f, 1.0f );
+        min[i] = Vector3Subtract( center, extent );
+        max[i] = Vector3Add( center, extent );
+    }
+    Ray3 rays[rayCount];
+    for( size_t r = 0; r < rayCount; ++r ) {
+        rays[r] = Ray3( RandomVector( -1.0f, 1.0f ),
+            Vector3Normalize( Vector3{ Random( -0.3f, 0.3f ), Random( -0.3f, 0.3f ), 1.0f } ) );
+    }
+    RayPacket4 packets4[rayCount / 4];
+    RayPacket8 packets8[rayCount / 8];
+    for( size_t p = 0; p < rayCount / 4; ++p ) {
+        packets4[p] = RayPacket4( rays + 4 * p );
+    }
+    for( size_t p = 0; p < rayCount / 8; ++p ) {
+        packets8[p] = RayPacket8( rays + 8 * p );
+    }
+    std::vector<float> distances( count );
+    std::vector<unsigned char> hits( ( count + 7 ) / 8 );
+    double tests = (double)( rayCount * count );
+
+    bench::Header( "rays" );
+    Report( "Ray3::IntersectTriangle", bench::Best( [&]() {
+        unsigned int found = 0;
+        for( size_t r = 0; r < rayCount; ++r ) {
+            for( size_t i = 0; i < count; ++i ) {
+                float t;
+                found += rays[r].IntersectTriangle( a[i], b[i], c[i], &t );
+            }
+        }
+        bench::Use( found );
+    }, tests ) );
+    Report( "Ray3::IntersectTriangles", bench::Best( [&]() {
+        for( size_t r = 0; r < rayCount; ++r ) {
+            rays[r].IntersectTriangles( a.data(), b.data(), c.data(), distances.data(), hits.data(), count );
+            bench::Clobber();
+        }
+    }, tests ) );
+    Report( "RayPacket4::IntersectTriangle", bench::Best( [&]() {
+        unsigned int found = 0;
+        for( size_t p = 0; p < rayCount / 4; ++p ) {
+            for( size_t i = 0; i < count; ++i ) {
+                float t[4];
+                found += packets4[p].IntersectTriangle( a[i], b[i], c[i], t );
+            }
+        }
+        bench::Use( found );
+    }, tests ) );
+    Report( "RayPacket8::IntersectTriangle", bench::Best( [&]() {
+        unsigned int found = 0;
+        for( size_t p = 0; p < rayCount / 8; ++p ) {
+            for( size_t i = 0; i < count; ++i ) {
+                float t[8];
+                found += packets8[p].IntersectTriangle( a[i], b[i], c[i], t );
+            }
+        }
+        bench::Use( found );
+    }, tests ) );
+
+    Report( "Ray3::IntersectBox", bench::Best( [&]() {
+        unsigned int found = 0;
+        for( size_t r = 0; r < rayCount; ++r ) {
+            for( size_t i = 0; i < count; ++i ) {
+                float t;
+                found += rays[r].IntersectBox( min[i], max[i], &t );
+            }
+        }
+        bench::Use( found );
+    }, tests ) );
+    Report( "Ray3::IntersectBoxes", bench::Best( [&]() {
+        for( size_t r = 0; r < rayCount; ++r ) {
+            rays[r].IntersectBoxes( min.data(), max.data(), distances.data(), hits.data(), count );
+            bench::Clobber();
+        }
+    }, tests ) );
+    Report( "RayPacket4::IntersectBox", bench::Best( [&]() {
+        unsigned int found = 0;
+        for( size_t p = 0; p < rayCount / 4; ++p ) {
+            for( size_t i = 0; i < count; ++i ) {
+                float t[4];
+                found += packets4[p].IntersectBox( min[i], max[i], t );
+            }
+        }
+        bench::Use( found );
+    }, tests ) );
+    Report( "RayPacket8::IntersectBox", bench::Best( [&]() {
+        unsigned int found = 0;
+        for( size_t p = 0; p < rayCount / 8; ++p ) {
+            for( size_t i = 0; i < count; ++i ) {
+                float t[8];
+                found += packets8[p].IntersectBox( min[i], max[i], t );
+            }
+        }
+        bench::Use( found );
+    }, tests ) );
+    return 0;
+}
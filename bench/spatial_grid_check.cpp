@@ -0,0 +1,121 @@
+/**
+ * @file   spatial_grid_check.cpp
+ * @brief  SpatialGrid queries and pairs against brute force past 2^21 points.
+ *
+ * Build (-I the folder with raymath.h):
+ *   g++ -O2 bench/spatial_grid_check.cpp -o spatial_grid_check
+ *   ./spatial_grid_check [points]
+ * Points default to 2^21 + 2^19, more than the 2^21 cells a row of
+ * keys holds. Exits with 1 when a query or a point's pairs differ
+ * from testing every point, so it can run as a check.
+*/
+#include "bench.hpp"
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+static int failures = 0;
+
+/// One result line, the mismatches in place of a time.
+static void Report( const char* name, const char* extra ) {
+    std::printf( "{ \"bench\": \"spatial_grid_check\", \"name\": \"%s\", \"target\": \"%s\", %s }\n",
+        name, bench::Target(), extra );
+}
+
+static void Check( bool ok, const char* what ) {
+    if( !ok ) {
+        std::printf( "{ \"bench\": \"spatial_grid_check\", \"fail\": \"%s\" }\n", what );
+        ++failures;
+    }
+}
+
+/// Points within radius of center, and the sum of their indices.
+struct Found {
+    size_t             count = 0;
+    unsigned long long sum   = 0;
+};
+
+static Found BruteForce( const std::vector<Vector3>& points, Vector3 center, float radius, size_t skip ) {
+    Found result;
+    for( size_t i = 0; i < points.size(); ++i ) {
+        if( i != skip && Vector3DistanceSqr( center, points[i] ) <= radius * radius ) {
+            result.count++;
+            result.sum += i;
+        }
+    }
+    return result;
+}
+
+/// Queries and pairs of a built grid, name is "3D" or "2D".
+static void CheckGrid( const char* name, const SpatialGrid& grid, const std::vector<Vector3>& points,
+    float radius, std::mt19937& rng
+) {
+    // NOTE(alicia): centers sit next to random points, half of them
+    // moved to around x = 0 where the x of a key wraps from 2^21 - 1 to 0.
+    std::uniform_int_distribution<size_t> pick( 0, points.size() - 1 );
+    std::uniform_real_distribution<float> offset( -radius, radius );
+    std::uniform_real_distribution<float> nearZero( -2.0f * radius, 2.0f * radius );
+    size_t mismatches = 0;
+    for( int q = 0; q < 200; ++q ) {
+        Vector3 center = points[pick( rng )];
+        center.x = q % 2 ? nearZero( rng ) : center.x + offset( rng );
+        center.y += offset( rng );
+        Found inGrid;
+        grid.Query( center, radius, [&]( unsigned int i, float ) {
+            inGrid.count++;
+            inGrid.sum += i;
+        } );
+        Found brute = BruteForce( points, center, radius, (size_t)-1 );
+        mismatches += inGrid.count != brute.count || inGrid.sum != brute.sum;
+    }
+    char title[32], extra[128];
+    std::snprintf( title, sizeof(title), "%s Query", name );
+    std::snprintf( extra, sizeof(extra), "\"points\": %zu, \"queries\": 200, \"mismatches\": %zu",
+        points.size(), mismatches );
+    Report( title, extra );
+    Check( mismatches == 0, "Query differs from brute force" );
+
+    // NOTE(alicia): every pair counts for both of its points, a sample
+    // of points is then checked against all the others.
+    std::vector<unsigned int> pairsOf( points.size() );
+    grid.Pairs( radius, [&]( unsigned int a, unsigned int b, float ) {
+        pairsOf[a]++;
+        pairsOf[b]++;
+    } );
+    mismatches = 0;
+    for( int k = 0; k < 200; ++k ) {
+        size_t i = pick( rng );
+        mismatches += pairsOf[i] != BruteForce( points, points[i], radius, i ).count;
+    }
+    std::snprintf( title, sizeof(title), "%s Pairs", name );
+    std::snprintf( extra, sizeof(extra), "\"points\": %zu, \"sampled\": 200, \"mismatches\": %zu",
+        points.size(), mismatches );
+    Report( title, extra );
+    Check( mismatches == 0, "Pairs differs from brute force" );
+}
+
+int main( int argc, char** argv ) {
+    size_t count = argc > 1 ? (size_t)std::atoll( argv[1] ) : ( (size_t)1 << 21 ) + ( (size_t)1 << 19 );
+    bench::Header( "spatial_grid_check" );
+
+    // NOTE(alicia): a few points per cell in both, cells as wide as
+    // the radius.
+    std::mt19937 rng( 4321 );
+    std::uniform_real_distribution<float> position( -100.0f, 100.0f );
+    std::vector<Vector3> points( count ), flat( count );
+    std::vector<Vector2> points2( count );
+    for( size_t i = 0; i < count; ++i ) {
+        points[i]  = Vector3{ position( rng ), position( rng ), position( rng ) };
+        points2[i] = Vector2{ position( rng ), position( rng ) };
+        flat[i]    = Vector3{ points2[i].x, points2[i].y, 0.0f };
+    }
+
+    SpatialGrid grid;
+    Check( grid.Build( points.data(), count, 1.0f ), "3D Build failed" );
+    CheckGrid( "3D", grid, points, 1.0f, rng );
+    Check( grid.Build( points2.data(), count, 0.2f ), "2D Build failed" );
+    CheckGrid( "2D", grid, flat, 0.2f, rng );
+
+    std::printf( "{ \"bench\": \"spatial_grid_check\", \"failures\": %d }\n", failures );
+    return failures ? 1 : 0;
+}
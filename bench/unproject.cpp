@@ -0,0 +1,58 @@
+/**
+ * @file   unproject.cpp
+ * @brief  Vector3Unproject per call against Unprojector, one point and whole arrays.
+ *
+ * Build (-I the folder with raymath.h):
+ *   g++ -O2 bench/unproject.cpp -o unproject
+ *   ./unproject [points]
+ * Points default to 4K, in and out fit in L2. "ns" is per point.
+ * Vector3Unproject multiplies and inverts view * projection for every
+ * point, Unprojector once, outside the timing.
+*/
+#include "bench.hpp"
+#include <cstdlib>
+#include <vector>
+
+int main( int argc, char** argv ) {
+    size_t count = argc > 1 ? (size_t)std::atoll( argv[1] ) : 4096;
+    std::vector<Vector3> ndc( count ), out( count );
+    unsigned int seed = 7;
+    for( size_t i = 0; i < count; ++i ) {
+        float v[3];
+        for( int k = 0; k < 3; ++k ) {
+            seed = seed * 1664525u + 1013904223u;
+            v[k] = (float)( seed >> 8 ) * ( 2.0f / 16777216.0f ) - 1.0f;
+        }
+        ndc[i] = Vector3{ v[0], v[1], v[2] };
+    }
+    Matrix projection = MatrixPerspective( 1.0, 16.0 / 9.0, 0.1, 1000.0 );
+    Matrix view = MatrixLookAt( Vector3{ 3, 4, 20 }, Vector3{ 0, 1, 0 }, Vector3{ 0, 1, 0 } );
+    Unprojector unprojector( projection, view );
+
+    bench::Header( "unproject" );
+    double raw = bench::Best( [&]() {
+        for( size_t i = 0; i < count; ++i ) {
+            out[i] = Vector3Unproject( ndc[i], projection, view );
+        }
+        bench::Clobber();
+    }, (double)count );
+    bench::Print( "unproject", "Vector3Unproject", raw );
+
+    double single = bench::Best( [&]() {
+        for( size_t i = 0; i < count; ++i ) {
+            out[i] = unprojector.Unproject( ndc[i] );
+        }
+        bench::Clobber();
+    }, (double)count );
+    char extra[64];
+    std::snprintf( extra, sizeof(extra), "\"speedup\": %.1f", raw / single );
+    bench::Print( "unproject", "Unprojector::Unproject", single, extra );
+
+    double array = bench::Best( [&]() {
+        unprojector.Unproject( ndc.data(), out.data(), count );
+        bench::Clobber();
+    }, (double)count );
+    std::snprintf( extra, sizeof(extra), "\"speedup\": %.1f", raw / array );
+    bench::Print( "unproject", "Unprojector::Unproject(array)", array, extra );
+    return 0;
+}
@@ -0,0 +1,404 @@
+/**
+ * @file   wrapper_overhead.cpp
+ * @brief  Every Vec2/Vec3/Vec4/Mat4/Quat wrapper against the raymath.h call it wraps.
+ *
+ * Build it with and without optimizations (-I the folder with raymath.h):
+ *   g++ -O2 bench/wrapper_overhead.cpp -o wrapper_overhead
+ *   g++ -Og bench/wrapper_overhead.cpp -o wrapper_overhead_debug
+ * Each line has the wrapper time in "ns", the raw call in "raw_ns",
+ * the difference in "overhead_ns" and the raw call that was timed in "raw".
+ * Wrappers without a raymath.h counterpart (Compose and Decompose) are
+ * timed against what you would write with raymath.h instead.
+*/
+#include "bench.hpp"
+
+using bench::Use;
+
+// NOTE(alicia): inputs fit in L1 and every call goes through
+// Use() on both sides, so the difference is only the wrapper.
+static const int Count  = 256;
+static const int Repeat = 32;
+
+static Vector2    a2[Count], b2[Count], c2[Count];
+static Vector3    a3[Count], b3[Count], c3[Count], d3[Count];
+static Vector4    a4[Count], b4[Count];
+static Quaternion qa[Count], qb[Count];
+static Matrix     ma[Count], mb[Count];
+static float      fa[Count], fb[Count];
+
+static Vec2 A2[Count], B2[Count], C2[Count];
+static Vec3 A3[Count], B3[Count], C3[Count], D3[Count];
+static Vec4 A4[Count], B4[Count];
+static Quat QA[Count], QB[Count];
+static Mat4 MA[Count], MB[Count];
+
+static unsigned int seed = 12345;
+static float Random( float lo, float hi ) {
+    seed = seed * 1664525u + 1013904223u;
+    return lo + ( hi - lo ) * (float)( seed >> 8 ) * ( 1.0f / 16777216.0f );
+}
+static void Fill() {
+    for( int i = 0; i < Count; ++i ) {
+        a2[i] = Vector2{ Random( -2, 2 ), Random( -2, 2 ) };
+        b2[i] = Vector2{ Random( -2, 2 ), Random( -2, 2 ) };
+        c2[i] = Vector2{ Random( 0.5f, 2 ), Random( 0.5f, 2 ) };
+        a3[i] = Vector3{ Random( -2, 2 ), Random( -2, 2 ), Random( -2, 2 ) };
+        b3[i] = Vector3{ Random( -2, 2 ), Random( -2, 2 ), Random( -2, 2 ) };
+        c3[i] = Vector3{ Random( 0.5f, 2 ), Random( 0.5f, 2 ), Random( 0.5f, 2 ) };
+        d3[i] = Vector3{ Random( -2, 2 ), Random( -2, 2 ), Random( -2, 2 ) };
+        a4[i] = Vector4{ Random( -2, 2 ), Random( -2, 2 ), Random( -2, 2 ), Random( -2, 2 ) };
+        b4[i] = Vector4{ Random( -2, 2 ), Random( -2, 2 ), Random( -2, 2 ), Random( -2, 2 ) };
+        qa[i] = QuaternionFromEuler( Random( -3, 3 ), Random( -3, 3 ), Random( -3, 3 ) );
+        qb[i] = QuaternionFromEuler( Random( -3, 3 ), Random( -3, 3 ), Random( -3, 3 ) );
+        ma[i] = MatrixMultiply(
+            MatrixMultiply( MatrixScale( c3[i].x, c3[i].y, c3[i].z ), QuaternionToMatrix( qa[i] ) ),
+            MatrixTranslate( a3[i].x, a3[i].y, a3[i].z ) );
+        mb[i] = MatrixMultiply( QuaternionToMatrix( qb[i] ), MatrixTranslate( b3[i].x, b3[i].y, b3[i].z ) );
+        fa[i] = Random( 0.1f, 1 );
+        fb[i] = Random( 1.5f, 3 );
+
+        A2[i] = a2[i]; B2[i] = b2[i]; C2[i] = c2[i];
+        A3[i] = a3[i]; B3[i] = b3[i]; C3[i] = c3[i]; D3[i] = d3[i];
+        A4[i] = a4[i]; B4[i] = b4[i];
+        QA[i] = qa[i]; QB[i] = qb[i];
+        MA[i] = ma[i]; MB[i] = mb[i];
+    }
+}
+
+/// What Mat4::Compose replaces.
+static Matrix RawCompose( Vector3 translation, Quaternion rotation, Vector3 scale ) {
+    return MatrixMultiply(
+        MatrixMultiply( MatrixScale( scale.x, scale.y, scale.z ), QuaternionToMatrix( rotation ) ),
+        MatrixTranslate( translation.x, translation.y, translation.z ) );
+}
+/// What Mat4::Decompose replaces, without the mirrored and flattened cases.
+static void RawDecompose( const Matrix& mat, Vector3* translation, Quaternion* rotation, Vector3* scale ) {
+    *translation = Vector3{ mat.m12, mat.m13, mat.m14 };
+    *scale = Vector3{
+        Vector3Length( Vector3{ mat.m0, mat.m1, mat.m2 } ),
+        Vector3Length( Vector3{ mat.m4, mat.m5, mat.m6 } ),
+        Vector3Length( Vector3{ mat.m8, mat.m9, mat.m10 } ) };
+    Matrix rotationOnly = MatrixMultiply( MatrixScale( 1.0f / scale->x, 1.0f / scale->y, 1.0f / scale->z ), mat );
+    *rotation = QuaternionFromMatrix( rotationOnly );
+}
+
+static void Compare( const char* name, const char* raw, double wrapperNs, double rawNs ) {
+    char extra[512];
+    std::snprintf( extra, sizeof(extra),
+        "\"raw_ns\": %.3f, \"overhead_ns\": %.3f, \"raw\": \"%s\"",
+        rawNs, wrapperNs - rawNs, raw );
+    bench::Print( "wrapper_overhead", name, wrapperNs, extra );
+}
+
+// NOTE(alicia): both statements run once per element, i is the element.
+// raw is also printed, so it has to stay free of quotes.
+#define COMPARE( name, wrapper, raw ) do {\
+    double wrapperNs = bench::Best( [&]() {\
+        for( int r = 0; r < Repeat; ++r )\
+            for( int i = 0; i < Count; ++i ) { wrapper; }\
+    }, (double)Count * Repeat );\
+    double rawNs = bench::Best( [&]() {\
+        for( int r = 0; r < Repeat; ++r )\
+            for( int i = 0; i < Count; ++i ) { raw; }\
+    }, (double)Count * Repeat );\
+    Compare( name, #raw, wrapperNs, rawNs );\
+} while( 0 )
+
+static void BenchVec2() {
+    COMPARE( "Vec2::Vec2(Vector2)",    Use( Vec2( a2[i] ) ),                  Use( a2[i] ) );
+    COMPARE( "Vec2::operator Vector2", { Vector2 v = A2[i]; Use( v ); },      { Vector2 v = a2[i]; Use( v ); } );
+    COMPARE( "Vec2::operator[]",       Use( A2[i][i & 1] ),                   Use( ( &a2[i].x )[i & 1] ) );
+    COMPARE( "Vec2::operator+=",       { Vec2 v = A2[i]; v += B2[i]; Use( v ); }, { Vector2 v = a2[i]; v = Vector2Add( v, b2[i] ); Use( v ); } );
+    COMPARE( "Vec2::operator-=",       { Vec2 v = A2[i]; v -= B2[i]; Use( v ); }, { Vector2 v = a2[i]; v = Vector2Subtract( v, b2[i] ); Use( v ); } );
+    COMPARE( "Vec2::operator*=",       { Vec2 v = A2[i]; v *= fa[i]; Use( v ); }, { Vector2 v = a2[i]; v = Vector2Scale( v, fa[i] ); Use( v ); } );
+    COMPARE( "Vec2::operator/=",       { Vec2 v = A2[i]; v /= fa[i]; Use( v ); }, { Vector2 v = a2[i]; v = Vector2Scale( v, 1.0f / fa[i] ); Use( v ); } );
+    COMPARE( "Vec2::operator-",        Use( -A2[i] ),                         Use( Vector2Negate( a2[i] ) ) );
+    COMPARE( "Vec2::Zero",             Use( Vec2::Zero() ),                   Use( Vector2Zero() ) );
+    COMPARE( "Vec2::One",              Use( Vec2::One() ),                    Use( Vector2One() ) );
+    COMPARE( "Vec2::Add",              Use( A2[i].Add( B2[i] ) ),             Use( Vector2Add( a2[i], b2[i] ) ) );
+    COMPARE( "Vec2::AddValue",         Use( A2[i].AddValue( fa[i] ) ),        Use( Vector2AddValue( a2[i], fa[i] ) ) );
+    COMPARE( "Vec2::Subtract",         Use( A2[i].Subtract( B2[i] ) ),        Use( Vector2Subtract( a2[i], b2[i] ) ) );
+    COMPARE( "Vec2::SubtractValue",    Use( A2[i].SubtractValue( fa[i] ) ),   Use( Vector2SubtractValue( a2[i], fa[i] ) ) );
+    COMPARE( "Vec2::Length",           Use( A2[i].Length() ),                 Use( Vector2Length( a2[i] ) ) );
+    COMPARE( "Vec2::LengthSqr",        Use( A2[i].LengthSqr() ),              Use( Vector2LengthSqr( a2[i] ) ) );
+    COMPARE( "Vec2::DotProduct",       Use( A2[i].DotProduct( B2[i] ) ),      Use( Vector2DotProduct( a2[i], b2[i] ) ) );
+    COMPARE( "Vec2::Distance",         Use( A2[i].Distance( B2[i] ) ),        Use( Vector2Distance( a2[i], b2[i] ) ) );
+    COMPARE( "Vec2::DistanceSqr",      Use( A2[i].DistanceSqr( B2[i] ) ),     Use( Vector2DistanceSqr( a2[i], b2[i] ) ) );
+    COMPARE( "Vec2::Angle",            Use( A2[i].Angle( B2[i] ) ),           Use( Vector2Angle( a2[i], b2[i] ) ) );
+    COMPARE( "Vec2::Scale",            Use( A2[i].Scale( fa[i] ) ),           Use( Vector2Scale( a2[i], fa[i] ) ) );
+    COMPARE( "Vec2::Multiply",         Use( A2[i].Multiply( B2[i] ) ),        Use( Vector2Multiply( a2[i], b2[i] ) ) );
+    COMPARE( "Vec2::Negate",           Use( A2[i].Negate() ),                 Use( Vector2Negate( a2[i] ) ) );
+    COMPARE( "Vec2::Divide",           Use( A2[i].Divide( C2[i] ) ),          Use( Vector2Divide( a2[i], c2[i] ) ) );
+    COMPARE( "Vec2::Normalize",        Use( A2[i].Normalize() ),              Use( Vector2Normalize( a2[i] ) ) );
+    COMPARE( "Vec2::Transform",        Use( A2[i].Transform( MA[i] ) ),       Use( Vector2Transform( a2[i], ma[i] ) ) );
+    COMPARE( "Vec2::Lerp",             Use( A2[i].Lerp( B2[i], fa[i] ) ),     Use( Vector2Lerp( a2[i], b2[i], fa[i] ) ) );
+    COMPARE( "Vec2::Reflect",          Use( A2[i].Reflect( B2[i] ) ),         Use( Vector2Reflect( a2[i], b2[i] ) ) );
+    COMPARE( "Vec2::Rotate",           Use( A2[i].Rotate( fa[i] ) ),          Use( Vector2Rotate( a2[i], fa[i] ) ) );
+    COMPARE( "Vec2::MoveToward",       Use( A2[i].MoveToward( B2[i], fa[i] ) ), Use( Vector2MoveTowards( a2[i], b2[i], fa[i] ) ) );
+    COMPARE( "Vec2::Invert",           Use( C2[i].Invert() ),                 Use( Vector2Invert( c2[i] ) ) );
+    COMPARE( "Vec2::Clamp",            Use( A2[i].Clamp( B2[i], C2[i] ) ),    Use( Vector2Clamp( a2[i], b2[i], c2[i] ) ) );
+    COMPARE( "Vec2::ClampValue",       Use( A2[i].ClampValue( fa[i], fb[i] ) ), Use( Vector2ClampValue( a2[i], fa[i], fb[i] ) ) );
+    COMPARE( "Vec2::Equals",           Use( A2[i].Equals( B2[i] ) ),          Use( Vector2Equals( a2[i], b2[i] ) ) );
+
+    COMPARE( "operator+(Vector2)",     Use( A2[i] + B2[i] ),                  Use( Vector2Add( a2[i], b2[i] ) ) );
+    COMPARE( "operator-(Vector2)",     Use( A2[i] - B2[i] ),                  Use( Vector2Subtract( a2[i], b2[i] ) ) );
+    COMPARE( "operator*(Vector2,float)", Use( A2[i] * fa[i] ),                Use( Vector2Scale( a2[i], fa[i] ) ) );
+    COMPARE( "operator*(float,Vector2)", Use( fa[i] * A2[i] ),                Use( Vector2Scale( a2[i], fa[i] ) ) );
+    COMPARE( "operator/(Vector2,float)", Use( A2[i] / fa[i] ),                Use( Vector2Scale( a2[i], 1.0f / fa[i] ) ) );
+    COMPARE( "operator==(Vector2)",    Use( A2[i] == B2[i] ),                 Use( Vector2Equals( a2[i], b2[i] ) ) );
+    COMPARE( "operator!=(Vector2)",    Use( A2[i] != B2[i] ),                 Use( !Vector2Equals( a2[i], b2[i] ) ) );
+    COMPARE( "Length(Vector2)",        Use( Length( A2[i] ) ),                Use( Vector2Length( a2[i] ) ) );
+    COMPARE( "LengthSqr(Vector2)",     Use( LengthSqr( A2[i] ) ),             Use( Vector2LengthSqr( a2[i] ) ) );
+    COMPARE( "DotProduct(Vector2)",    Use( DotProduct( A2[i], B2[i] ) ),     Use( Vector2DotProduct( a2[i], b2[i] ) ) );
+    COMPARE( "Distance(Vector2)",      Use( Distance( A2[i], B2[i] ) ),       Use( Vector2Distance( a2[i], b2[i] ) ) );
+    COMPARE( "DistanceSqr(Vector2)",   Use( DistanceSqr( A2[i], B2[i] ) ),    Use( Vector2DistanceSqr( a2[i], b2[i] ) ) );
+    COMPARE( "Angle(Vector2)",         Use( Angle( A2[i], B2[i] ) ),          Use( Vector2Angle( a2[i], b2[i] ) ) );
+    COMPARE( "Normalize(Vector2)",     Use( Normalize( A2[i] ) ),             Use( Vector2Normalize( a2[i] ) ) );
+    COMPARE( "Lerp(Vector2)",          Use( Lerp( A2[i], B2[i], fa[i] ) ),    Use( Vector2Lerp( a2[i], b2[i], fa[i] ) ) );
+    COMPARE( "Reflect(Vector2)",       Use( Reflect( A2[i], B2[i] ) ),        Use( Vector2Reflect( a2[i], b2[i] ) ) );
+    COMPARE( "Rotate(Vector2)",        Use( Rotate( A2[i], fa[i] ) ),         Use( Vector2Rotate( a2[i], fa[i] ) ) );
+    COMPARE( "Clamp(Vector2,Vector2)", Use( Clamp( A2[i], B2[i], C2[i] ) ),   Use( Vector2Clamp( a2[i], b2[i], c2[i] ) ) );
+    COMPARE( "Clamp(Vector2,float)",   Use( Clamp( A2[i], fa[i], fb[i] ) ),   Use( Vector2ClampValue( a2[i], fa[i], fb[i] ) ) );
+
+    COMPARE( "Vec2 read .yx",          Use( Vec2( A2[i].yx ) ),               Use( Vector2{ a2[i].y, a2[i].x } ) );
+    COMPARE( "Vec2 read .xx",          Use( Vec2( A2[i].xx ) ),               Use( Vector2{ a2[i].x, a2[i].x } ) );
+    COMPARE( "Vec2 read .yx as Vector2", { Vector2 v = A2[i].yx; Use( v ); }, Use( Vector2{ a2[i].y, a2[i].x } ) );
+    COMPARE( "Vec2 write .yx",         { Vec2 v = A2[i]; v.yx = B2[i]; Use( v ); }, { Vector2 v = a2[i]; v.y = b2[i].x; v.x = b2[i].y; Use( v ); } );
+}
+
+static void BenchVec3() {
+    COMPARE( "Vec3::Vec3(Vector3)",    Use( Vec3( a3[i] ) ),                  Use( a3[i] ) );
+    COMPARE( "Vec3::operator Vector3", { Vector3 v = A3[i]; Use( v ); },      { Vector3 v = a3[i]; Use( v ); } );
+    COMPARE( "Vec3::operator[]",       Use( A3[i][i % 3] ),                   Use( ( &a3[i].x )[i % 3] ) );
+    COMPARE( "Vec3::operator+=",       { Vec3 v = A3[i]; v += B3[i]; Use( v ); }, { Vector3 v = a3[i]; v = Vector3Add( v, b3[i] ); Use( v ); } );
+    COMPARE( "Vec3::operator-=",       { Vec3 v = A3[i]; v -= B3[i]; Use( v ); }, { Vector3 v = a3[i]; v = Vector3Subtract( v, b3[i] ); Use( v ); } );
+    COMPARE( "Vec3::operator*=",       { Vec3 v = A3[i]; v *= fa[i]; Use( v ); }, { Vector3 v = a3[i]; v = Vector3Scale( v, fa[i] ); Use( v ); } );
+    COMPARE( "Vec3::operator/=",       { Vec3 v = A3[i]; v /= fa[i]; Use( v ); }, { Vector3 v = a3[i]; v = Vector3Scale( v, 1.0f / fa[i] ); Use( v ); } );
+    COMPARE( "Vec3::operator-",        Use( -A3[i] ),                         Use( Vector3Negate( a3[i] ) ) );
+    COMPARE( "Vec3::Zero",             Use( Vec3::Zero() ),                   Use( Vector3Zero() ) );
+    COMPARE( "Vec3::One",              Use( Vec3::One() ),                    Use( Vector3One() ) );
+    COMPARE( "Vec3::Add",              Use( A3[i].Add( B3[i] ) ),             Use( Vector3Add( a3[i], b3[i] ) ) );
+    COMPARE( "Vec3::AddValue",         Use( A3[i].AddValue( fa[i] ) ),        Use( Vector3AddValue( a3[i], fa[i] ) ) );
+    COMPARE( "Vec3::Subtract",         Use( A3[i].Subtract( B3[i] ) ),        Use( Vector3Subtract( a3[i], b3[i] ) ) );
+    COMPARE( "Vec3::SubtractValue",    Use( A3[i].SubtractValue( fa[i] ) ),   Use( Vector3SubtractValue( a3[i], fa[i] ) ) );
+    COMPARE( "Vec3::Scale",            Use( A3[i].Scale( fa[i] ) ),           Use( Vector3Scale( a3[i], fa[i] ) ) );
+    COMPARE( "Vec3::Multiply",         Use( A3[i].Multiply( B3[i] ) ),        Use( Vector3Multiply( a3[i], b3[i] ) ) );
+    COMPARE( "Vec3::CrossProduct",     Use( A3[i].CrossProduct( B3[i] ) ),    Use( Vector3CrossProduct( a3[i], b3[i] ) ) );
+    COMPARE( "Vec3::Perpendicular",    Use( A3[i].Perpendicular() ),          Use( Vector3Perpendicular( a3[i] ) ) );
+    COMPARE( "Vec3::Length",           Use( A3[i].Length() ),                 Use( Vector3Length( a3[i] ) ) );
+    COMPARE( "Vec3::LengthSqr",        Use( A3[i].LengthSqr() ),              Use( Vector3LengthSqr( a3[i] ) ) );
+    COMPARE( "Vec3::DotProduct",       Use( A3[i].DotProduct( B3[i] ) ),      Use( Vector3DotProduct( a3[i], b3[i] ) ) );
+    COMPARE( "Vec3::Distance",         Use( A3[i].Distance( B3[i] ) ),        Use( Vector3Distance( a3[i], b3[i] ) ) );
+    COMPARE( "Vec3::DistanceSqr",      Use( A3[i].DistanceSqr( B3[i] ) ),     Use( Vector3DistanceSqr( a3[i], b3[i] ) ) );
+    COMPARE( "Vec3::Angle",            Use( A3[i].Angle( B3[i] ) ),           Use( Vector3Angle( a3[i], b3[i] ) ) );
+    COMPARE( "Vec3::Negate",           Use( A3[i].Negate() ),                 Use( Vector3Negate( a3[i] ) ) );
+    COMPARE( "Vec3::Divide",           Use( A3[i].Divide( C3[i] ) ),          Use( Vector3Divide( a3[i], c3[i] ) ) );
+    COMPARE( "Vec3::Normalize",        Use( A3[i].Normalize() ),              Use( Vector3Normalize( a3[i] ) ) );
+    COMPARE( "Vec3::OrthoNormalize",   { Vec3 v = A3[i]; Vector3 t = b3[i]; v.OrthoNormalize( &t ); Use( v ); Use( t ); },
+                                       { Vector3 v = a3[i]; Vector3 t = b3[i]; Vector3OrthoNormalize( &v, &t ); Use( v ); Use( t ); } );
+    COMPARE( "Vec3::Transform",        Use( A3[i].Transform( MA[i] ) ),       Use( Vector3Transform( a3[i], ma[i] ) ) );
+    COMPARE( "Vec3::Rotate(Quaternion)", Use( A3[i].Rotate( QA[i] ) ),        Use( Vector3RotateByQuaternion( a3[i], qa[i] ) ) );
+    COMPARE( "Vec3::Rotate(axis,angle)", Use( A3[i].Rotate( C3[i], fa[i] ) ), Use( Vector3RotateByAxisAngle( a3[i], c3[i], fa[i] ) ) );
+    COMPARE( "Vec3::MoveTowards",      Use( A3[i].MoveTowards( B3[i], fa[i] ) ), Use( Vector3MoveTowards( a3[i], b3[i], fa[i] ) ) );
+    COMPARE( "Vec3::Lerp",             Use( A3[i].Lerp( B3[i], fa[i] ) ),     Use( Vector3Lerp( a3[i], b3[i], fa[i] ) ) );
+    COMPARE( "Vec3::Reflect",          Use( A3[i].Reflect( B3[i] ) ),         Use( Vector3Reflect( a3[i], b3[i] ) ) );
+    COMPARE( "Vec3::Min",              Use( A3[i].Min( B3[i] ) ),             Use( Vector3Min( a3[i], b3[i] ) ) );
+    COMPARE( "Vec3::Max",              Use( A3[i].Max( B3[i] ) ),             Use( Vector3Max( a3[i], b3[i] ) ) );
+    COMPARE( "Vec3::Barycenter",       Use( A3[i].Barycenter( B3[i], C3[i], D3[i] ) ), Use( Vector3Barycenter( a3[i], b3[i], c3[i], d3[i] ) ) );
+    COMPARE( "Vec3::Unproject",        Use( A3[i].Unproject( MA[i], MB[i] ) ), Use( Vector3Unproject( a3[i], ma[i], mb[i] ) ) );
+    COMPARE( "Vec3::ToFloatV",         Use( A3[i].ToFloatV() ),               Use( Vector3ToFloatV( a3[i] ) ) );
+    COMPARE( "Vec3::Invert",           Use( C3[i].Invert() ),                 Use( Vector3Invert( c3[i] ) ) );
+    COMPARE( "Vec3::Clamp",            Use( A3[i].Clamp( B3[i], C3[i] ) ),    Use( Vector3Clamp( a3[i], b3[i], c3[i] ) ) );
+    COMPARE( "Vec3::ClampValue",       Use( A3[i].ClampValue( fa[i], fb[i] ) ), Use( Vector3ClampValue( a3[i], fa[i], fb[i] ) ) );
+    COMPARE( "Vec3::Equals",           Use( A3[i].Equals( B3[i] ) ),          Use( Vector3Equals( a3[i], b3[i] ) ) );
+    COMPARE( "Vec3::Refract",          Use( A3[i].Refract( B3[i], fa[i] ) ),  Use( Vector3Refract( a3[i], b3[i], fa[i] ) ) );
+
+    COMPARE( "operator+(Vector3)",     Use( A3[i] + B3[i] ),                  Use( Vector3Add( a3[i], b3[i] ) ) );
+    COMPARE( "operator-(Vector3)",     Use( A3[i] - B3[i] ),                  Use( Vector3Subtract( a3[i], b3[i] ) ) );
+    COMPARE( "operator*(Vector3,float)", Use( A3[i] * fa[i] ),                Use( Vector3Scale( a3[i], fa[i] ) ) );
+    COMPARE( "operator*(float,Vector3)", Use( fa[i] * A3[i] ),                Use( Vector3Scale( a3[i], fa[i] ) ) );
+    COMPARE( "operator*(Vector3,Matrix)", Use( A3[i] * MA[i] ),               Use( Vector3Transform( a3[i], ma[i] ) ) );
+    COMPARE( "operator/(Vector3,float)", Use( A3[i] / fa[i] ),                Use( Vector3Scale( a3[i], 1.0f / fa[i] ) ) );
+    COMPARE( "operator==(Vector3)",    Use( A3[i] == B3[i] ),                 Use( Vector3Equals( a3[i], b3[i] ) ) );
+    COMPARE( "operator!=(Vector3)",    Use( A3[i] != B3[i] ),                 Use( !Vector3Equals( a3[i], b3[i] ) ) );
+    COMPARE( "Length(Vector3)",        Use( Length( A3[i] ) ),                Use( Vector3Length( a3[i] ) ) );
+    COMPARE( "LengthSqr(Vector3)",     Use( LengthSqr( A3[i] ) ),             Use( Vector3LengthSqr( a3[i] ) ) );
+    COMPARE( "DotProduct(Vector3)",    Use( DotProduct( A3[i], B3[i] ) ),     Use( Vector3DotProduct( a3[i], b3[i] ) ) );
+    COMPARE( "CrossProduct(Vector3)",  Use( CrossProduct( A3[i], B3[i] ) ),   Use( Vector3CrossProduct( a3[i], b3[i] ) ) );
+    COMPARE( "Distance(Vector3)",      Use( Distance( A3[i], B3[i] ) ),       Use( Vector3Distance( a3[i], b3[i] ) ) );
+    COMPARE( "DistanceSqr(Vector3)",   Use( DistanceSqr( A3[i], B3[i] ) ),    Use( Vector3DistanceSqr( a3[i], b3[i] ) ) );
+    COMPARE( "Angle(Vector3)",         Use( Angle( A3[i], B3[i] ) ),          Use( Vector3Angle( a3[i], b3[i] ) ) );
+    COMPARE( "Normalize(Vector3)",     Use( Normalize( A3[i] ) ),             Use( Vector3Normalize( a3[i] ) ) );
+    COMPARE( "MoveTowards(Vector3)",   Use( MoveTowards( A3[i], B3[i], fa[i] ) ), Use( Vector3MoveTowards( a3[i], b3[i], fa[i] ) ) );
+    COMPARE( "Lerp(Vector3)",          Use( Lerp( A3[i], B3[i], fa[i] ) ),    Use( Vector3Lerp( a3[i], b3[i], fa[i] ) ) );
+    COMPARE( "Reflect(Vector3)",       Use( Reflect( A3[i], B3[i] ) ),        Use( Vector3Reflect( a3[i], b3[i] ) ) );
+    COMPARE( "Rotate(Vector3,Quaternion)", Use( Rotate( A3[i], QA[i] ) ),     Use( Vector3RotateByQuaternion( a3[i], qa[i] ) ) );
+    COMPARE( "Rotate(Vector3,axis,angle)", Use( Rotate( A3[i], C3[i], fa[i] ) ), Use( Vector3RotateByAxisAngle( a3[i], c3[i], fa[i] ) ) );
+    COMPARE( "Clamp(Vector3,Vector3)", Use( Clamp( A3[i], B3[i], C3[i] ) ),   Use( Vector3Clamp( a3[i], b3[i], c3[i] ) ) );
+    COMPARE( "Clamp(Vector3,float)",   Use( Clamp( A3[i], fa[i], fb[i] ) ),   Use( Vector3ClampValue( a3[i], fa[i], fb[i] ) ) );
+
+    COMPARE( "Vec3 read .zyx",         Use( Vec3( A3[i].zyx ) ),              Use( Vector3{ a3[i].z, a3[i].y, a3[i].x } ) );
+    COMPARE( "Vec3 read .xxx",         Use( Vec3( A3[i].xxx ) ),              Use( Vector3{ a3[i].x, a3[i].x, a3[i].x } ) );
+    COMPARE( "Vec3 read .yx",          Use( Vec2( A3[i].yx ) ),               Use( Vector2{ a3[i].y, a3[i].x } ) );
+    COMPARE( "Vec3 read .zxy as Vector3", { Vector3 v = A3[i].zxy; Use( v ); }, Use( Vector3{ a3[i].z, a3[i].x, a3[i].y } ) );
+    COMPARE( "Vec3 read .yzx into Add", Use( Vector3Add( A3[i].yzx, b3[i] ) ), Use( Vector3Add( Vector3{ a3[i].y, a3[i].z, a3[i].x }, b3[i] ) ) );
+    COMPARE( "Vec3 write .zyx",        { Vec3 v = A3[i]; v.zyx = B3[i]; Use( v ); },
+                                       { Vector3 v = a3[i]; v.z = b3[i].x; v.y = b3[i].y; v.x = b3[i].z; Use( v ); } );
+    COMPARE( "Vec3 write .yx",         { Vec3 v = A3[i]; v.yx = B2[i]; Use( v ); }, { Vector3 v = a3[i]; v.y = b2[i].x; v.x = b2[i].y; Use( v ); } );
+}
+
+static void BenchVec4() {
+    COMPARE( "Vec4::Vec4(Vector4)",    Use( Vec4( a4[i] ) ),                  Use( a4[i] ) );
+    COMPARE( "Vec4::operator Vector4", { Vector4 v = A4[i]; Use( v ); },      { Vector4 v = a4[i]; Use( v ); } );
+    COMPARE( "Vec4::operator[]",       Use( A4[i][i & 3] ),                   Use( ( &a4[i].x )[i & 3] ) );
+    COMPARE( "Vec4::operator+=",       { Vec4 v = A4[i]; v += B4[i]; Use( v ); }, { Vector4 v = a4[i]; v = Vector4Add( v, b4[i] ); Use( v ); } );
+    COMPARE( "Vec4::operator-=",       { Vec4 v = A4[i]; v -= B4[i]; Use( v ); }, { Vector4 v = a4[i]; v = Vector4Subtract( v, b4[i] ); Use( v ); } );
+    COMPARE( "Vec4::operator*=",       { Vec4 v = A4[i]; v *= fa[i]; Use( v ); }, { Vector4 v = a4[i]; v = Vector4Scale( v, fa[i] ); Use( v ); } );
+    COMPARE( "Vec4::operator/=",       { Vec4 v = A4[i]; v /= fa[i]; Use( v ); }, { Vector4 v = a4[i]; v = Vector4Scale( v, 1.0f / fa[i] ); Use( v ); } );
+    COMPARE( "Vec4::operator-",        Use( -A4[i] ),                         Use( Vector4Negate( a4[i] ) ) );
+    COMPARE( "Vec4::Zero",             Use( Vec4::Zero() ),                   Use( Vector4Zero() ) );
+    COMPARE( "Vec4::One",              Use( Vec4::One() ),                    Use( Vector4One() ) );
+    COMPARE( "Vec4::Add",              Use( A4[i].Add( B4[i] ) ),             Use( Vector4Add( a4[i], b4[i] ) ) );
+    COMPARE( "Vec4::AddValue",         Use( A4[i].AddValue( fa[i] ) ),        Use( Vector4AddValue( a4[i], fa[i] ) ) );
+    COMPARE( "Vec4::Subtract",         Use( A4[i].Subtract( B4[i] ) ),        Use( Vector4Subtract( a4[i], b4[i] ) ) );
+    COMPARE( "Vec4::SubtractValue",    Use( A4[i].SubtractValue( fa[i] ) ),   Use( Vector4SubtractValue( a4[i], fa[i] ) ) );
+    COMPARE( "Vec4::Scale",            Use( A4[i].Scale( fa[i] ) ),           Use( Vector4Scale( a4[i], fa[i] ) ) );
+    COMPARE( "Vec4::Multiply",         Use( A4[i].Multiply( B4[i] ) ),        Use( Vector4Multiply( a4[i], b4[i] ) ) );
+    COMPARE( "Vec4::Length",           Use( A4[i].Length() ),                 Use( Vector4Length( a4[i] ) ) );
+    COMPARE( "Vec4::LengthSqr",        Use( A4[i].LengthSqr() ),              Use( Vector4LengthSqr( a4[i] ) ) );
+    COMPARE( "Vec4::DotProduct",       Use( A4[i].DotProduct( B4[i] ) ),      Use( Vector4DotProduct( a4[i], b4[i] ) ) );
+    COMPARE( "Vec4::Distance",         Use( A4[i].Distance( B4[i] ) ),        Use( Vector4Distance( a4[i], b4[i] ) ) );
+    COMPARE( "Vec4::DistanceSqr",      Use( A4[i].DistanceSqr( B4[i] ) ),     Use( Vector4DistanceSqr( a4[i], b4[i] ) ) );
+    COMPARE( "Vec4::Negate",           Use( A4[i].Negate() ),                 Use( Vector4Negate( a4[i] ) ) );
+    COMPARE( "Vec4::Divide",           Use( A4[i].Divide( B4[i] ) ),          Use( Vector4Divide( a4[i], b4[i] ) ) );
+    COMPARE( "Vec4::Normalize",        Use( A4[i].Normalize() ),              Use( Vector4Normalize( a4[i] ) ) );
+    COMPARE( "Vec4::OrthoNormalize",   { Vec4 v = A4[i]; Vector3 t = b3[i]; v.OrthoNormalize( &t ); Use( v ); Use( t ); },
+                                       { Vector4 v = a4[i]; Vector3 t = b3[i]; Vector3OrthoNormalize( (Vector3*)&v, &t ); Use( v ); Use( t ); } );
+    COMPARE( "Vec4::MoveTowards",      Use( A4[i].MoveTowards( B4[i], fa[i] ) ), Use( Vector4MoveTowards( a4[i], b4[i], fa[i] ) ) );
+    COMPARE( "Vec4::Lerp",             Use( A4[i].Lerp( B4[i], fa[i] ) ),     Use( Vector4Lerp( a4[i], b4[i], fa[i] ) ) );
+    COMPARE( "Vec4::Min",              Use( A4[i].Min( B4[i] ) ),             Use( Vector4Min( a4[i], b4[i] ) ) );
+    COMPARE( "Vec4::Max",              Use( A4[i].Max( B4[i] ) ),             Use( Vector4Max( a4[i], b4[i] ) ) );
+    COMPARE( "Vec4::Invert",           Use( A4[i].Invert() ),                 Use( Vector4Invert( a4[i] ) ) );
+    COMPARE( "Vec4::Equals",           Use( A4[i].Equals( B4[i] ) ),          Use( Vector4Equals( a4[i], b4[i] ) ) );
+
+    COMPARE( "operator+(Vec4)",        Use( A4[i] + B4[i] ),                  Use( Vector4Add( a4[i], b4[i] ) ) );
+    COMPARE( "operator-(Vec4)",        Use( A4[i] - B4[i] ),                  Use( Vector4Subtract( a4[i], b4[i] ) ) );
+    COMPARE( "operator*(Vec4,float)",  Use( A4[i] * fa[i] ),                  Use( Vector4Scale( a4[i], fa[i] ) ) );
+    COMPARE( "operator*(float,Vec4)",  Use( fa[i] * A4[i] ),                  Use( Vector4Scale( a4[i], fa[i] ) ) );
+    COMPARE( "operator/(Vec4,float)",  Use( A4[i] / fa[i] ),                  Use( Vector4Scale( a4[i], 1.0f / fa[i] ) ) );
+    COMPARE( "operator==(Vec4)",       Use( A4[i] == B4[i] ),                 Use( Vector4Equals( a4[i], b4[i] ) ) );
+    COMPARE( "operator!=(Vec4)",       Use( A4[i] != B4[i] ),                 Use( !Vector4Equals( a4[i], b4[i] ) ) );
+    COMPARE( "Length(Vector4)",        Use( Length( A4[i] ) ),                Use( Vector4Length( a4[i] ) ) );
+    COMPARE( "LengthSqr(Vector4)",     Use( LengthSqr( A4[i] ) ),             Use( Vector4LengthSqr( a4[i] ) ) );
+    COMPARE( "DotProduct(Vector4)",    Use( DotProduct( A4[i], B4[i] ) ),     Use( Vector4DotProduct( a4[i], b4[i] ) ) );
+    COMPARE( "Distance(Vector4)",      Use( Distance( A4[i], B4[i] ) ),       Use( Vector4Distance( a4[i], b4[i] ) ) );
+    COMPARE( "DistanceSqr(Vector4)",   Use( DistanceSqr( A4[i], B4[i] ) ),    Use( Vector4DistanceSqr( a4[i], b4[i] ) ) );
+    COMPARE( "Normalize(Vector4)",     Use( Normalize( A4[i] ) ),             Use( Vector4Normalize( a4[i] ) ) );
+    COMPARE( "MoveTowards(Vector4)",   Use( MoveTowards( A4[i], B4[i], fa[i] ) ), Use( Vector4MoveTowards( a4[i], b4[i], fa[i] ) ) );
+    COMPARE( "Lerp(Vector4)",          Use( Lerp( A4[i], B4[i], fa[i] ) ),    Use( Vector4Lerp( a4[i], b4[i], fa[i] ) ) );
+
+    COMPARE( "Vec4 read .wzyx",        Use( Vec4( A4[i].wzyx ) ),             Use( Vector4{ a4[i].w, a4[i].z, a4[i].y, a4[i].x } ) );
+    COMPARE( "Vec4 read .xyz",         Use( Vec3( A4[i].xyz ) ),              Use( Vector3{ a4[i].x, a4[i].y, a4[i].z } ) );
+    COMPARE( "Vec4 read .zw",          Use( Vec2( A4[i].zw ) ),               Use( Vector2{ a4[i].z, a4[i].w } ) );
+    COMPARE( "Vec4 read .xxyy as Vector4", { Vector4 v = A4[i].xxyy; Use( v ); }, Use( Vector4{ a4[i].x, a4[i].x, a4[i].y, a4[i].y } ) );
+    COMPARE( "Vec4 write .wzyx",       { Vec4 v = A4[i]; v.wzyx = B4[i]; Use( v ); },
+                                       { Vector4 v = a4[i]; v.w = b4[i].x; v.z = b4[i].y; v.y = b4[i].z; v.x = b4[i].w; Use( v ); } );
+    COMPARE( "Vec4 write .xyz",        { Vec4 v = A4[i]; v.xyz = B3[i]; Use( v ); },
+                                       { Vector4 v = a4[i]; v.x = b3[i].x; v.y = b3[i].y; v.z = b3[i].z; Use( v ); } );
+    COMPARE( "Vec4 write .zw",         { Vec4 v = A4[i]; v.zw = B2[i]; Use( v ); }, { Vector4 v = a4[i]; v.z = b2[i].x; v.w = b2[i].y; Use( v ); } );
+}
+
+static void BenchMat4() {
+    COMPARE( "Mat4::Mat4(Matrix)",     Use( Mat4( ma[i] ) ),                  Use( ma[i] ) );
+    COMPARE( "Mat4::operator const Matrix&", Use( MatrixTrace( MA[i] ) ),     Use( MatrixTrace( ma[i] ) ) );
+    COMPARE( "Mat4::operator Matrix&", { Mat4 m = MA[i]; Matrix& r = m; r.m12 = fa[i]; Use( m ); }, { Matrix m = ma[i]; m.m12 = fa[i]; Use( m ); } );
+    COMPARE( "Mat4::operator[]",       Use( MA[i][i & 15] ),                  Use( ( &ma[i].m0 )[i & 15] ) );
+    COMPARE( "Mat4::Identity",         Use( Mat4::Identity() ),               Use( MatrixIdentity() ) );
+    COMPARE( "Mat4::Translate(x,y,z)", Use( Mat4::Translate( fa[i], fb[i], fa[i] ) ), Use( MatrixTranslate( fa[i], fb[i], fa[i] ) ) );
+    COMPARE( "Mat4::Translate(Vector3)", Use( Mat4::Translate( A3[i] ) ),     Use( MatrixTranslate( a3[i].x, a3[i].y, a3[i].z ) ) );
+    COMPARE( "Mat4::Rotate",           Use( Mat4::Rotate( C3[i], fa[i] ) ),   Use( MatrixRotate( c3[i], fa[i] ) ) );
+    COMPARE( "Mat4::RotateX",          Use( Mat4::RotateX( fa[i] ) ),         Use( MatrixRotateX( fa[i] ) ) );
+    COMPARE( "Mat4::RotateY",          Use( Mat4::RotateY( fa[i] ) ),         Use( MatrixRotateY( fa[i] ) ) );
+    COMPARE( "Mat4::RotateZ",          Use( Mat4::RotateZ( fa[i] ) ),         Use( MatrixRotateZ( fa[i] ) ) );
+    COMPARE( "Mat4::RotateXYZ",        Use( Mat4::RotateXYZ( A3[i] ) ),       Use( MatrixRotateXYZ( a3[i] ) ) );
+    COMPARE( "Mat4::RotateZYX",        Use( Mat4::RotateZYX( A3[i] ) ),       Use( MatrixRotateZYX( a3[i] ) ) );
+    COMPARE( "Mat4::Scale(x,y,z)",     Use( Mat4::Scale( fa[i], fb[i], fa[i] ) ), Use( MatrixScale( fa[i], fb[i], fa[i] ) ) );
+    COMPARE( "Mat4::Scale(Vector3)",   Use( Mat4::Scale( C3[i] ) ),           Use( MatrixScale( c3[i].x, c3[i].y, c3[i].z ) ) );
+    COMPARE( "Mat4::Frustum",          Use( Mat4::Frustum( -fa[i], fa[i], -fb[i], fb[i], 0.1, 100.0 ) ),
+                                       Use( MatrixFrustum( -fa[i], fa[i], -fb[i], fb[i], 0.1, 100.0 ) ) );
+    COMPARE( "Mat4::Perspective",      Use( Mat4::Perspective( fa[i], fb[i], 0.1, 100.0 ) ), Use( MatrixPerspective( fa[i], fb[i], 0.1, 100.0 ) ) );
+    COMPARE( "Mat4::Ortho",            Use( Mat4::Ortho( -fa[i], fa[i], -fb[i], fb[i], 0.1, 100.0 ) ),
+                                       Use( MatrixOrtho( -fa[i], fa[i], -fb[i], fb[i], 0.1, 100.0 ) ) );
+    COMPARE( "Mat4::LookAt",           Use( Mat4::LookAt( A3[i], B3[i], C3[i] ) ), Use( MatrixLookAt( a3[i], b3[i], c3[i] ) ) );
+    COMPARE( "Mat4::Compose",          Use( Mat4::Compose( A3[i], QA[i], C3[i] ) ), Use( RawCompose( a3[i], qa[i], c3[i] ) ) );
+    COMPARE( "Mat4::Determinant",      Use( MA[i].Determinant() ),            Use( MatrixDeterminant( ma[i] ) ) );
+    COMPARE( "Mat4::Trace",            Use( MA[i].Trace() ),                  Use( MatrixTrace( ma[i] ) ) );
+    COMPARE( "Mat4::Transpose",        Use( MA[i].Transpose() ),              Use( MatrixTranspose( ma[i] ) ) );
+    COMPARE( "Mat4::Invert",           Use( MA[i].Invert() ),                 Use( MatrixInvert( ma[i] ) ) );
+    COMPARE( "Mat4::Decompose",        { Vector3 t; Quaternion q; Vector3 s; MA[i].Decompose( &t, &q, &s ); Use( t ); Use( q ); Use( s ); },
+                                       { Vector3 t; Quaternion q; Vector3 s; RawDecompose( ma[i], &t, &q, &s ); Use( t ); Use( q ); Use( s ); } );
+    COMPARE( "Mat4::Add",              Use( MA[i].Add( MB[i] ) ),             Use( MatrixAdd( ma[i], mb[i] ) ) );
+    COMPARE( "Mat4::Subtract",         Use( MA[i].Subtract( MB[i] ) ),        Use( MatrixSubtract( ma[i], mb[i] ) ) );
+    COMPARE( "Mat4::Multiply",         Use( MA[i].Multiply( MB[i] ) ),        Use( MatrixMultiply( ma[i], mb[i] ) ) );
+    COMPARE( "Mat4::ToFloatV",         Use( MA[i].ToFloatV() ),               Use( MatrixToFloatV( ma[i] ) ) );
+    COMPARE( "operator+(Matrix)",      Use( MA[i] + MB[i] ),                  Use( MatrixAdd( ma[i], mb[i] ) ) );
+    COMPARE( "operator-(Matrix)",      Use( MA[i] - MB[i] ),                  Use( MatrixSubtract( ma[i], mb[i] ) ) );
+    COMPARE( "operator*(Matrix)",      Use( MA[i] * MB[i] ),                  Use( MatrixMultiply( ma[i], mb[i] ) ) );
+}
+
+static void BenchQuat() {
+    COMPARE( "Quat::Quat(Quaternion)", Use( Quat( qa[i] ) ),                 Use( qa[i] ) );
+    COMPARE( "Quat::Quat(pitch,yaw,roll)", Use( Quat( fa[i], fb[i], fa[i] ) ), Use( QuaternionFromEuler( fa[i], fb[i], fa[i] ) ) );
+    COMPARE( "Quat::Quat(from,to)",    Use( Quat( A3[i], B3[i] ) ),           Use( QuaternionFromVector3ToVector3( a3[i], b3[i] ) ) );
+    COMPARE( "Quat::Quat(axis,angle)", Use( Quat( C3[i], fa[i] ) ),           Use( QuaternionFromAxisAngle( c3[i], fa[i] ) ) );
+    COMPARE( "Quat::Quat(Matrix)",     Use( Quat( MB[i] ) ),                  Use( QuaternionFromMatrix( mb[i] ) ) );
+    COMPARE( "Quat::operator Quaternion", { Quaternion q = QA[i]; Use( q ); }, { Quaternion q = qa[i]; Use( q ); } );
+    COMPARE( "Quat::operator[]",       Use( QA[i][i & 3] ),                   Use( ( &qa[i].x )[i & 3] ) );
+    COMPARE( "Quat::Identity",         Use( Quat::Identity() ),               Use( QuaternionIdentity() ) );
+    COMPARE( "Quat::FromVector3ToVector3", Use( Quat::FromVector3ToVector3( A3[i], B3[i] ) ), Use( QuaternionFromVector3ToVector3( a3[i], b3[i] ) ) );
+    COMPARE( "Quat::FromMatrix",       Use( Quat::FromMatrix( MB[i] ) ),      Use( QuaternionFromMatrix( mb[i] ) ) );
+    COMPARE( "Quat::FromAxisAngle",    Use( Quat::FromAxisAngle( C3[i], fa[i] ) ), Use( QuaternionFromAxisAngle( c3[i], fa[i] ) ) );
+    COMPARE( "Quat::FromEuler",        Use( Quat::FromEuler( fa[i], fb[i], fa[i] ) ), Use( QuaternionFromEuler( fa[i], fb[i], fa[i] ) ) );
+    COMPARE( "Quat::Add",              Use( QA[i].Add( QB[i] ) ),             Use( QuaternionAdd( qa[i], qb[i] ) ) );
+    COMPARE( "Quat::AddValue",         Use( QA[i].AddValue( fa[i] ) ),        Use( QuaternionAddValue( qa[i], fa[i] ) ) );
+    COMPARE( "Quat::Subtract",         Use( QA[i].Subtract( QB[i] ) ),        Use( QuaternionSubtract( qa[i], qb[i] ) ) );
+    COMPARE( "Quat::SubtractValue",    Use( QA[i].SubtractValue( fa[i] ) ),   Use( QuaternionSubtractValue( qa[i], fa[i] ) ) );
+    COMPARE( "Quat::Length",           Use( QA[i].Length() ),                 Use( QuaternionLength( qa[i] ) ) );
+    COMPARE( "Quat::Normalize",        Use( QA[i].Normalize() ),              Use( QuaternionNormalize( qa[i] ) ) );
+    COMPARE( "Quat::Invert",           Use( QA[i].Invert() ),                 Use( QuaternionInvert( qa[i] ) ) );
+    COMPARE( "Quat::Multiply",         Use( QA[i].Multiply( QB[i] ) ),        Use( QuaternionMultiply( qa[i], qb[i] ) ) );
+    COMPARE( "Quat::Scale",            Use( QA[i].Scale( fa[i] ) ),           Use( QuaternionScale( qa[i], fa[i] ) ) );
+    COMPARE( "Quat::Divide",           Use( QA[i].Divide( QB[i] ) ),          Use( QuaternionDivide( qa[i], qb[i] ) ) );
+    COMPARE( "Quat::Lerp",             Use( QA[i].Lerp( QB[i], fa[i] ) ),     Use( QuaternionLerp( qa[i], qb[i], fa[i] ) ) );
+    COMPARE( "Quat::Nlerp",            Use( QA[i].Nlerp( QB[i], fa[i] ) ),    Use( QuaternionNlerp( qa[i], qb[i], fa[i] ) ) );
+    COMPARE( "Quat::Slerp",            Use( QA[i].Slerp( QB[i], fa[i] ) ),    Use( QuaternionSlerp( qa[i], qb[i], fa[i] ) ) );
+    COMPARE( "Quat::ToMatrix",         Use( QA[i].ToMatrix() ),               Use( QuaternionToMatrix( qa[i] ) ) );
+    COMPARE( "Quat::ToAxisAngle(Vector3*)", { Vector3 axis; float angle; QA[i].ToAxisAngle( &axis, &angle ); Use( axis ); Use( angle ); },
+                                       { Vector3 axis; float angle; QuaternionToAxisAngle( qa[i], &axis, &angle ); Use( axis ); Use( angle ); } );
+    COMPARE( "Quat::ToAxisAngle(Vec3*)", { Vec3 axis; float angle; QA[i].ToAxisAngle( &axis, &angle ); Use( axis ); Use( angle ); },
+                                       { Vector3 axis; float angle; QuaternionToAxisAngle( qa[i], &axis, &angle ); Use( axis ); Use( angle ); } );
+    COMPARE( "Quat::ToEuler",          Use( QA[i].ToEuler() ),                Use( QuaternionToEuler( qa[i] ) ) );
+    COMPARE( "Quat::Transform",        Use( QA[i].Transform( MA[i] ) ),       Use( QuaternionTransform( qa[i], ma[i] ) ) );
+    COMPARE( "Quat::Equals",           Use( QA[i].Equals( QB[i] ) ),          Use( QuaternionEquals( qa[i], qb[i] ) ) );
+    COMPARE( "operator+(Quaternion)",  Use( QA[i] + QB[i] ),                  Use( QuaternionAdd( qa[i], qb[i] ) ) );
+    COMPARE( "operator-(Quaternion)",  Use( QA[i] - QB[i] ),                  Use( QuaternionSubtract( qa[i], qb[i] ) ) );
+    COMPARE( "operator*(Quaternion,float)", Use( QA[i] * fa[i] ),             Use( QuaternionScale( qa[i], fa[i] ) ) );
+    COMPARE( "operator*(float,Quaternion)", Use( fa[i] * QA[i] ),             Use( QuaternionScale( qa[i], fa[i] ) ) );
+    COMPARE( "operator*(Quaternion,Matrix)", Use( QA[i] * MA[i] ),            Use( QuaternionTransform( qa[i], ma[i] ) ) );
+    COMPARE( "operator/(Quaternion,float)", Use( QA[i] / fa[i] ),             Use( QuaternionScale( qa[i], 1.0f / fa[i] ) ) );
+    COMPARE( "operator==(Quaternion)", Use( QA[i] == QB[i] ),                 Use( QuaternionEquals( qa[i], qb[i] ) ) );
+    COMPARE( "operator!=(Quaternion)", Use( QA[i] != QB[i] ),                 Use( !QuaternionEquals( qa[i], qb[i] ) ) );
+    COMPARE( "Nlerp(Quaternion)",      Use( Nlerp( QA[i], QB[i], fa[i] ) ),   Use( QuaternionNlerp( qa[i], qb[i], fa[i] ) ) );
+    COMPARE( "Slerp(Quaternion)",      Use( Slerp( QA[i], QB[i], fa[i] ) ),   Use( QuaternionSlerp( qa[i], qb[i], fa[i] ) ) );
+}
+
+int main() {
+    Fill();
+    bench::Header( "wrapper_overhead" );
+    BenchVec2();
+    BenchVec3();
+    BenchVec4();
+    BenchMat4();
+    BenchQuat();
+    return 0;
+}
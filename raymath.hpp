@@ -6,1162 +6,11578 @@
  * @author Alicia Amarilla (smushyaa@gmail.com)
  * @date   October 16, 2024
 */
-#include <raymath.h>
-#if !defined(RAYMATH_CPP_NO_STDLIB)
-    #include <utility>
+#if defined(RAYMATH_CPP_NATIVE)
+// NOTE(alicia): native mode.
+// raymath.h is not included, the raymath types and the raymath
+// functions this header uses are defined here as constexpr ports
+// (same formulas, same order of operations) so matrices and
+// quaternions can be computed at compile time.
+// at runtime the libm functions are called so results match raymath.h,
+// during constant evaluation double precision series are used instead.
+// do not include raymath.h in the same translation unit,
+// raylib.h is fine as long as it is included first.
+#if !( __cplusplus >= 201402L || ( defined(_MSVC_LANG) && _MSVC_LANG >= 201402L ) )
+    #error "RAYMATH_CPP_NATIVE requires C++14"
 #endif
+#include <math.h>
+#include <stddef.h>
 
-template<typename V, typename RLV, int...Indexes>
-class Swizzler {
-    static const int Count = sizeof...(Indexes);
-    float v[Count];
-public:
-    V& operator=( const V& rhs ) {
-        int indexes[] = { Indexes... };
-        for( int i = 0; i < Count; ++i ) {
-            v[indexes[i]] = rhs[i];
-        }
-        return *(V*)this;
-    }
-    operator
-    V() const {
-        return V( v[Indexes]... );
-    }
-    operator
-    RLV() const {
-        return RLV{ v[Indexes]... };
-    }
-};
+#define RAYMATH_CPP_CONSTEXPR constexpr
+#if defined(__GNUC__) || defined(__clang__) || ( defined(_MSC_VER) && _MSC_VER >= 1925 )
+    #define RAYMATH_CPP_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+    // NOTE(alicia): no way to tell, always take the constexpr path.
+    #define RAYMATH_CPP_CONSTANT_EVALUATED() true
+#endif
 
-struct Vec2 {
-    union {
-        float array[2];
-        struct { float x = 0.0f, y = 0.0f; };
-        Swizzler<Vec2, Vector2, 0, 0> xx;
-        Swizzler<Vec2, Vector2, 1, 1> yy;
-        Swizzler<Vec2, Vector2, 0, 1> xy;
-        Swizzler<Vec2, Vector2, 1, 0> yx;
-    };
+#if !defined(PI)
+    #define PI 3.14159265358979323846f
+#endif
+#if !defined(EPSILON)
+    #define EPSILON 0.000001f
+#endif
+#if !defined(DEG2RAD)
+    #define DEG2RAD (PI/180.0f)
+#endif
+#if !defined(RAD2DEG)
+    #define RAD2DEG (180.0f/PI)
+#endif
 
-    Vec2() {}
-    Vec2( float x, float y ) : x(x), y(y) {}
-    Vec2( const Vector2& v ) : Vec2( v.x, v.y ) {}
+#if !defined(RL_VECTOR2_TYPE)
+typedef struct Vector2 {
+    float x;
+    float y;
+} Vector2;
+#define RL_VECTOR2_TYPE
+#endif
+#if !defined(RL_VECTOR3_TYPE)
+typedef struct Vector3 {
+    float x;
+    float y;
+    float z;
+} Vector3;
+#define RL_VECTOR3_TYPE
+#endif
+#if !defined(RL_VECTOR4_TYPE)
+typedef struct Vector4 {
+    float x;
+    float y;
+    float z;
+    float w;
+} Vector4;
+#define RL_VECTOR4_TYPE
+#endif
+#if !defined(RL_QUATERNION_TYPE)
+typedef Vector4 Quaternion;
+#define RL_QUATERNION_TYPE
+#endif
+#if !defined(RL_MATRIX_TYPE)
+typedef struct Matrix {
+    float m0, m4, m8, m12;
+    float m1, m5, m9, m13;
+    float m2, m6, m10, m14;
+    float m3, m7, m11, m15;
+} Matrix;
+#define RL_MATRIX_TYPE
+#endif
+typedef struct float3 {
+    float v[3];
+} float3;
+typedef struct float16 {
+    float v[16];
+} float16;
 
-    inline
-    operator Vector2() const {
-        return *(Vector2*)this;
-    }
-    inline
-    float operator[]( size_t idx ) const {
-        return array[idx];
-    }
-    inline
-    float& operator[]( size_t idx ) {
-        return array[idx];
-    }
+struct NativeMath {
+    static constexpr double Pi = 3.14159265358979323846;
 
-    inline
-    Vec2& operator+=( Vector2 v2 ) {
-        return *this = this->Add( v2 );
-    }
-    inline
-    Vec2& operator-=( Vector2 v2 ) {
-        return *this = this->Subtract( v2 );
-    }
-    inline
-    Vec2& operator*=( float value ) {
-        return *this = this->Scale( value );
-    }
-    inline
-    Vec2& operator/=( float value ) {
-        return *this = this->Scale( 1.0f / value );
+    static constexpr inline
+    double SqrtD( double x ) {
+        if( !( x > 0.0 ) ) {
+            return 0.0;
+        }
+        // NOTE(alicia): newton from above converges monotonically.
+        double result = x > 1.0 ? x : 1.0;
+        for( int i = 0; i < 128; ++i ) {
+            double next = 0.5 * ( result + x / result );
+            if( next >= result ) {
+                break;
+            }
+            result = next;
+        }
+        return result;
     }
-    inline
-    Vec2 operator-() const {
-        return this->Negate();
+    static constexpr inline
+    double FloorD( double x ) {
+        double result = (double)(long long)x;
+        return result > x ? result - 1.0 : result;
+    }
+    static constexpr inline
+    double WrapPi( double x ) {
+        double turns = FloorD( x / ( 2.0 * Pi ) + 0.5 );
+        return x - turns * 2.0 * Pi;
+    }
+    static constexpr inline
+    double SinD( double x ) {
+        x = WrapPi( x );
+        double term = x;
+        double sum  = x;
+        for( int i = 1; i < 32; ++i ) {
+            term *= -x * x / ( ( 2.0 * i ) * ( 2.0 * i + 1.0 ) );
+            sum  += term;
+        }
+        return sum;
+    }
+    static constexpr inline
+    double CosD( double x ) {
+        x = WrapPi( x );
+        double term = 1.0;
+        double sum  = 1.0;
+        for( int i = 1; i < 32; ++i ) {
+            term *= -x * x / ( ( 2.0 * i - 1.0 ) * ( 2.0 * i ) );
+            sum  += term;
+        }
+        return sum;
     }
-
-    static inline
-    Vec2 Zero() {
-        return Vector2Zero();
+    static constexpr inline
+    double AtanD( double x ) {
+        if( x < 0.0 ) {
+            return -AtanD( -x );
+        }
+        if( x > 1.0 ) {
+            return Pi * 0.5 - AtanD( 1.0 / x );
+        }
+        // NOTE(alicia): halve the angle twice, series converges fast below 0.2.
+        x = x / ( 1.0 + SqrtD( 1.0 + x * x ) );
+        x = x / ( 1.0 + SqrtD( 1.0 + x * x ) );
+        double term = x;
+        double sum  = x;
+        for( int i = 1; i < 40; ++i ) {
+            term *= -x * x;
+            sum  += term / ( 2.0 * i + 1.0 );
+        }
+        return sum * 4.0;
     }
-    static inline
-    Vec2 One() {
-        return Vector2One();
+    static constexpr inline
+    double Atan2D( double y, double x ) {
+        if( x > 0.0 ) {
+            return AtanD( y / x );
+        }
+        if( x < 0.0 ) {
+            return y >= 0.0 ? AtanD( y / x ) + Pi : AtanD( y / x ) - Pi;
+        }
+        return y > 0.0 ? Pi * 0.5 : ( y < 0.0 ? -Pi * 0.5 : 0.0 );
     }
 
-    inline
-    Vec2 Add( Vector2 v2 ) const {
-        return Vector2Add( *this, v2 );
-    }
-    inline
-    Vec2 AddValue( float add ) const {
-        return Vector2AddValue( *this, add );
-    }
-    inline
-    Vec2 Subtract( Vector2 v2 ) const {
-        return Vector2Subtract( *this, v2 );
-    }
-    inline
-    Vec2 SubtractValue( float sub ) const {
-        return Vector2SubtractValue( *this, sub );
-    }
-    inline
-    float Length() const {
-        return Vector2Length( *this );
-    }
-    inline
-    float LengthSqr() const {
-        return Vector2LengthSqr( *this );
-    }
-    inline
-    float DotProduct( Vector2 v2 ) const {
-        return Vector2DotProduct( *this, v2 );
-    }
-    inline
-    float Distance( Vector2 v2 ) const {
-        return Vector2Distance( *this, v2 );
-    }
-    inline
-    float DistanceSqr( Vector2 v2 ) const {
-        return Vector2DistanceSqr( *this, v2 );
-    }
-    inline
-    float Angle( Vector2 v2 ) const {
-        return Vector2Angle( *this, v2 );
-    }
-    inline
-    Vec2 Scale( float scale ) const {
-        return Vector2Scale( *this, scale );
-    }
-    inline
-    Vec2 Multiply( Vector2 v2 ) const {
-        return Vector2Multiply( *this, v2 );
-    }
-    inline
-    Vec2 Negate() const {
-        return Vector2Negate( *this );
-    }
-    inline
-    Vec2 Divide( Vector2 v2 ) const {
-        return Vector2Divide( *this, v2 );
+    static constexpr inline
+    float Sqrt( float x ) {
+        return RAYMATH_CPP_CONSTANT_EVALUATED() ? (float)SqrtD( x ) : sqrtf( x );
     }
-    inline
-    Vec2 Normalize() const {
-        return Vector2Normalize( *this );
+    static constexpr inline
+    float Sin( float x ) {
+        return RAYMATH_CPP_CONSTANT_EVALUATED() ? (float)SinD( x ) : sinf( x );
     }
-    inline
-    Vec2 Transform( const Matrix& mat ) const {
-        return Vector2Transform( *this, mat );
+    static constexpr inline
+    float Cos( float x ) {
+        return RAYMATH_CPP_CONSTANT_EVALUATED() ? (float)CosD( x ) : cosf( x );
     }
-    inline
-    Vec2 Lerp( Vector2 v2, float amount ) const {
-        return Vector2Lerp( *this, v2, amount );
+    static constexpr inline
+    double Tan( double x ) {
+        return RAYMATH_CPP_CONSTANT_EVALUATED() ? SinD( x ) / CosD( x ) : tan( x );
     }
-    inline
-    Vec2 Reflect( Vector2 normal ) const {
-        return Vector2Reflect( *this, normal );
+    static constexpr inline
+    float Atan2( float y, float x ) {
+        return RAYMATH_CPP_CONSTANT_EVALUATED() ? (float)Atan2D( y, x ) : atan2f( y, x );
     }
-    inline
-    Vec2 Rotate( float angle ) const {
-        return Vector2Rotate( *this, angle );
+    static constexpr inline
+    float Asin( float x ) {
+        return RAYMATH_CPP_CONSTANT_EVALUATED() ?
+            (float)Atan2D( x, SqrtD( 1.0 - (double)x * x ) ) : asinf( x );
     }
-    inline
-    Vec2 MoveToward( Vector2 target, float maxDistance ) const {
-        return Vector2MoveTowards( *this, target, maxDistance );
+    static constexpr inline
+    float Acos( float x ) {
+        return RAYMATH_CPP_CONSTANT_EVALUATED() ?
+            (float)Atan2D( SqrtD( 1.0 - (double)x * x ), x ) : acosf( x );
     }
-    inline
-    Vec2 Invert() const {
-        return Vector2Invert( *this );
+    static constexpr inline
+    float Floor( float x ) {
+        return RAYMATH_CPP_CONSTANT_EVALUATED() ? (float)FloorD( x ) : floorf( x );
     }
-    inline
-    Vec2 Clamp( Vector2 min, Vector2 max ) const {
-        return Vector2Clamp( *this, min, max );
+    static constexpr inline
+    float Fabs( float x ) {
+        return x < 0.0f ? -x : x;
     }
-    inline
-    Vec2 ClampValue( float min, float max ) const {
-        return Vector2ClampValue( *this, min, max );
+    static constexpr inline
+    float Fmin( float a, float b ) {
+        return a != a ? b : ( b != b ? a : ( b < a ? b : a ) );
     }
-    inline
-    bool Equals( Vector2 q ) const {
-        return Vector2Equals( *this, q );
+    static constexpr inline
+    float Fmax( float a, float b ) {
+        return a != a ? b : ( b != b ? a : ( b > a ? b : a ) );
     }
 };
-inline
-Vec2 operator+( Vector2 v1, Vector2 v2 ) {
-    return Vector2Add( v1, v2 );
+
+constexpr inline
+float Clamp( float value, float min, float max ) {
+    float result = ( value < min ) ? min : value;
+    if( result > max ) {
+        result = max;
+    }
+    return result;
 }
-inline
-Vec2 operator-( Vector2 v1, Vector2 v2 ) {
-    return Vector2Subtract( v1, v2 );
+constexpr inline
+float Lerp( float start, float end, float amount ) {
+    return start + amount * ( end - start );
 }
-inline
-Vec2 operator*( Vector2 v1, float scale ) {
-    return Vector2Scale( v1, scale );
+constexpr inline
+float Normalize( float value, float start, float end ) {
+    return ( value - start ) / ( end - start );
 }
-inline
-Vec2 operator*( float scale, Vector2 v1 ) {
-    return Vector2Scale( v1, scale );
+constexpr inline
+float Remap(
+    float value, float inputStart, float inputEnd,
+    float outputStart, float outputEnd
+) {
+    return ( value - inputStart ) / ( inputEnd - inputStart ) *
+        ( outputEnd - outputStart ) + outputStart;
 }
-inline
-Vec2 operator/( Vector2 v1, float scale ) {
-    return Vector2Scale( v1, 1.0f / scale );
+constexpr inline
+float Wrap( float value, float min, float max ) {
+    return value - ( max - min ) * NativeMath::Floor( ( value - min ) / ( max - min ) );
 }
-inline
-bool operator==( Vector2 p, Vector2 q ) {
-    return Vector2Equals( p, q );
+constexpr inline
+int FloatEquals( float x, float y ) {
+    return NativeMath::Fabs( x - y ) <= EPSILON *
+        NativeMath::Fmax( 1.0f, NativeMath::Fmax( NativeMath::Fabs( x ), NativeMath::Fabs( y ) ) );
 }
-inline
-bool operator!=( Vector2 p, Vector2 q ) {
-    return !( p == q );
+
+constexpr inline
+Vector2 Vector2Zero() {
+    return Vector2{ 0.0f, 0.0f };
 }
-inline
-float Length( Vector2 v ) {
-    return Vector2Length( v );
+constexpr inline
+Vector2 Vector2One() {
+    return Vector2{ 1.0f, 1.0f };
 }
-inline
-float LengthSqr( Vector2 v ) {
-    return Vector2LengthSqr( v );
+constexpr inline
+Vector2 Vector2Add( Vector2 v1, Vector2 v2 ) {
+    return Vector2{ v1.x + v2.x, v1.y + v2.y };
 }
-inline
-float DotProduct( Vector2 v1, Vector2 v2 ) {
-    return Vector2DotProduct( v1, v2 );
+constexpr inline
+Vector2 Vector2AddValue( Vector2 v, float add ) {
+    return Vector2{ v.x + add, v.y + add };
 }
-inline
-float Distance( Vector2 v1, Vector2 v2 ) {
-    return Vector2Distance( v1, v2 );
+constexpr inline
+Vector2 Vector2Subtract( Vector2 v1, Vector2 v2 ) {
+    return Vector2{ v1.x - v2.x, v1.y - v2.y };
 }
-inline
-float DistanceSqr( Vector2 v1, Vector2 v2 ) {
-    return Vector2DistanceSqr( v1, v2 );
+constexpr inline
+Vector2 Vector2SubtractValue( Vector2 v, float sub ) {
+    return Vector2{ v.x - sub, v.y - sub };
 }
-inline
-float Angle( Vector2 v1, Vector2 v2 ) {
-    return Vector2Angle( v1, v2 );
+constexpr inline
+float Vector2Length( Vector2 v ) {
+    return NativeMath::Sqrt( ( v.x*v.x ) + ( v.y*v.y ) );
 }
-inline
-Vec2 Normalize( Vector2 v ) {
-    return Vector2Normalize( v );
+constexpr inline
+float Vector2LengthSqr( Vector2 v ) {
+    return ( v.x*v.x ) + ( v.y*v.y );
 }
-inline
-Vec2 Lerp( Vector2 v1, Vector2 v2, float amount ) {
-    return Vector2Lerp( v1, v2, amount );
+constexpr inline
+float Vector2DotProduct( Vector2 v1, Vector2 v2 ) {
+    return ( v1.x*v2.x + v1.y*v2.y );
 }
-inline
-Vec2 Reflect( Vector2 v, Vector2 normal ) {
-    return Vector2Reflect( v, normal );
+constexpr inline
+float Vector2Distance( Vector2 v1, Vector2 v2 ) {
+    return NativeMath::Sqrt( ( v1.x - v2.x )*( v1.x - v2.x ) + ( v1.y - v2.y )*( v1.y - v2.y ) );
 }
-inline
-Vec2 Rotate( Vector2 v, float angle ) {
-    return Vector2Rotate( v, angle );
+constexpr inline
+float Vector2DistanceSqr( Vector2 v1, Vector2 v2 ) {
+    return ( ( v1.x - v2.x )*( v1.x - v2.x ) + ( v1.y - v2.y )*( v1.y - v2.y ) );
 }
-inline
-Vec2 Clamp( Vector2 v, Vector2 min, Vector2 max ) {
-    return Vector2Clamp( v, min, max );
+constexpr inline
+float Vector2Angle( Vector2 v1, Vector2 v2 ) {
+    float dot = v1.x*v2.x + v1.y*v2.y;
+    float det = v1.x*v2.y - v1.y*v2.x;
+    return NativeMath::Atan2( det, dot );
 }
-inline
-Vec2 Clamp( Vector2 v, float min, float max ) {
-    return Vector2ClampValue( v, min, max );
+constexpr inline
+Vector2 Vector2Scale( Vector2 v, float scale ) {
+    return Vector2{ v.x*scale, v.y*scale };
+}
+constexpr inline
+Vector2 Vector2Multiply( Vector2 v1, Vector2 v2 ) {
+    return Vector2{ v1.x*v2.x, v1.y*v2.y };
+}
+constexpr inline
+Vector2 Vector2Negate( Vector2 v ) {
+    return Vector2{ -v.x, -v.y };
+}
+constexpr inline
+Vector2 Vector2Divide( Vector2 v1, Vector2 v2 ) {
+    return Vector2{ v1.x/v2.x, v1.y/v2.y };
+}
+constexpr inline
+Vector2 Vector2Normalize( Vector2 v ) {
+    Vector2 result = {};
+    float length = NativeMath::Sqrt( ( v.x*v.x ) + ( v.y*v.y ) );
+    if( length > 0 ) {
+        float ilength = 1.0f/length;
+        result.x = v.x*ilength;
+        result.y = v.y*ilength;
+    }
+    return result;
+}
+constexpr inline
+Vector2 Vector2Transform( Vector2 v, Matrix mat ) {
+    float x = v.x;
+    float y = v.y;
+    float z = 0;
+    return Vector2{
+        mat.m0*x + mat.m4*y + mat.m8*z + mat.m12,
+        mat.m1*x + mat.m5*y + mat.m9*z + mat.m13 };
+}
+constexpr inline
+Vector2 Vector2Lerp( Vector2 v1, Vector2 v2, float amount ) {
+    return Vector2{ v1.x + amount*( v2.x - v1.x ), v1.y + amount*( v2.y - v1.y ) };
+}
+constexpr inline
+Vector2 Vector2Reflect( Vector2 v, Vector2 normal ) {
+    float dotProduct = ( v.x*normal.x + v.y*normal.y );
+    return Vector2{
+        v.x - ( 2.0f*normal.x )*dotProduct,
+        v.y - ( 2.0f*normal.y )*dotProduct };
+}
+constexpr inline
+Vector2 Vector2Rotate( Vector2 v, float angle ) {
+    float cosres = NativeMath::Cos( angle );
+    float sinres = NativeMath::Sin( angle );
+    return Vector2{ v.x*cosres - v.y*sinres, v.x*sinres + v.y*cosres };
+}
+constexpr inline
+Vector2 Vector2MoveTowards( Vector2 v, Vector2 target, float maxDistance ) {
+    float dx    = target.x - v.x;
+    float dy    = target.y - v.y;
+    float value = ( dx*dx ) + ( dy*dy );
+    if( ( value == 0 ) || ( ( maxDistance >= 0 ) && ( value <= maxDistance*maxDistance ) ) ) {
+        return target;
+    }
+    float dist = NativeMath::Sqrt( value );
+    return Vector2{ v.x + dx/dist*maxDistance, v.y + dy/dist*maxDistance };
+}
+constexpr inline
+Vector2 Vector2Invert( Vector2 v ) {
+    return Vector2{ 1.0f/v.x, 1.0f/v.y };
+}
+constexpr inline
+Vector2 Vector2Clamp( Vector2 v, Vector2 min, Vector2 max ) {
+    return Vector2{
+        NativeMath::Fmin( max.x, NativeMath::Fmax( min.x, v.x ) ),
+        NativeMath::Fmin( max.y, NativeMath::Fmax( min.y, v.y ) ) };
+}
+constexpr inline
+Vector2 Vector2ClampValue( Vector2 v, float min, float max ) {
+    Vector2 result = v;
+    float length = ( v.x*v.x ) + ( v.y*v.y );
+    if( length > 0.0f ) {
+        length = NativeMath::Sqrt( length );
+        float scale = 1;
+        if( length < min ) {
+            scale = min/length;
+        } else if( length > max ) {
+            scale = max/length;
+        }
+        result.x = v.x*scale;
+        result.y = v.y*scale;
+    }
+    return result;
+}
+constexpr inline
+int Vector2Equals( Vector2 p, Vector2 q ) {
+    return FloatEquals( p.x, q.x ) && FloatEquals( p.y, q.y );
 }
 
-struct Vec3 {
-    union {
-        float array[3];
-        struct { float x = 0.0f, y = 0.0f, z = 0.0f; };
-
-        Swizzler<Vec2, Vector2, 0, 0> xx;
-        Swizzler<Vec2, Vector2, 1, 1> yy;
-        Swizzler<Vec2, Vector2, 0, 1> xy;
+constexpr inline
+Vector3 Vector3Zero() {
+    return Vector3{ 0.0f, 0.0f, 0.0f };
+}
+constexpr inline
+Vector3 Vector3One() {
+    return Vector3{ 1.0f, 1.0f, 1.0f };
+}
+constexpr inline
+Vector3 Vector3Add( Vector3 v1, Vector3 v2 ) {
+    return Vector3{ v1.x + v2.x, v1.y + v2.y, v1.z + v2.z };
+}
+constexpr inline
+Vector3 Vector3AddValue( Vector3 v, float add ) {
+    return Vector3{ v.x + add, v.y + add, v.z + add };
+}
+constexpr inline
+Vector3 Vector3Subtract( Vector3 v1, Vector3 v2 ) {
+    return Vector3{ v1.x - v2.x, v1.y - v2.y, v1.z - v2.z };
+}
+constexpr inline
+Vector3 Vector3SubtractValue( Vector3 v, float sub ) {
+    return Vector3{ v.x - sub, v.y - sub, v.z - sub };
+}
+constexpr inline
+Vector3 Vector3Scale( Vector3 v, float scalar ) {
+    return Vector3{ v.x*scalar, v.y*scalar, v.z*scalar };
+}
+constexpr inline
+Vector3 Vector3Multiply( Vector3 v1, Vector3 v2 ) {
+    return Vector3{ v1.x*v2.x, v1.y*v2.y, v1.z*v2.z };
+}
+constexpr inline
+Vector3 Vector3CrossProduct( Vector3 v1, Vector3 v2 ) {
+    return Vector3{
+        v1.y*v2.z - v1.z*v2.y,
+        v1.z*v2.x - v1.x*v2.z,
+        v1.x*v2.y - v1.y*v2.x };
+}
+constexpr inline
+Vector3 Vector3Perpendicular( Vector3 v ) {
+    float min = NativeMath::Fabs( v.x );
+    Vector3 cardinalAxis = { 1.0f, 0.0f, 0.0f };
+    if( NativeMath::Fabs( v.y ) < min ) {
+        min = NativeMath::Fabs( v.y );
+        cardinalAxis = Vector3{ 0.0f, 1.0f, 0.0f };
+    }
+    if( NativeMath::Fabs( v.z ) < min ) {
+        cardinalAxis = Vector3{ 0.0f, 0.0f, 1.0f };
+    }
+    return Vector3CrossProduct( v, cardinalAxis );
+}
+constexpr inline
+float Vector3Length( const Vector3 v ) {
+    return NativeMath::Sqrt( v.x*v.x + v.y*v.y + v.z*v.z );
+}
+constexpr inline
+float Vector3LengthSqr( const Vector3 v ) {
+    return v.x*v.x + v.y*v.y + v.z*v.z;
+}
+constexpr inline
+float Vector3DotProduct( Vector3 v1, Vector3 v2 ) {
+    return ( v1.x*v2.x + v1.y*v2.y + v1.z*v2.z );
+}
+constexpr inline
+float Vector3Distance( Vector3 v1, Vector3 v2 ) {
+    float dx = v2.x - v1.x;
+    float dy = v2.y - v1.y;
+    float dz = v2.z - v1.z;
+    return NativeMath::Sqrt( dx*dx + dy*dy + dz*dz );
+}
+constexpr inline
+float Vector3DistanceSqr( Vector3 v1, Vector3 v2 ) {
+    float dx = v2.x - v1.x;
+    float dy = v2.y - v1.y;
+    float dz = v2.z - v1.z;
+    return dx*dx + dy*dy + dz*dz;
+}
+constexpr inline
+float Vector3Angle( Vector3 v1, Vector3 v2 ) {
+    Vector3 cross = Vector3CrossProduct( v1, v2 );
+    float len = NativeMath::Sqrt( cross.x*cross.x + cross.y*cross.y + cross.z*cross.z );
+    float dot = ( v1.x*v2.x + v1.y*v2.y + v1.z*v2.z );
+    return NativeMath::Atan2( len, dot );
+}
+constexpr inline
+Vector3 Vector3Negate( Vector3 v ) {
+    return Vector3{ -v.x, -v.y, -v.z };
+}
+constexpr inline
+Vector3 Vector3Divide( Vector3 v1, Vector3 v2 ) {
+    return Vector3{ v1.x/v2.x, v1.y/v2.y, v1.z/v2.z };
+}
+constexpr inline
+Vector3 Vector3Normalize( Vector3 v ) {
+    Vector3 result = v;
+    float length = NativeMath::Sqrt( v.x*v.x + v.y*v.y + v.z*v.z );
+    if( length != 0.0f ) {
+        float ilength = 1.0f/length;
+        result.x *= ilength;
+        result.y *= ilength;
+        result.z *= ilength;
+    }
+    return result;
+}
+constexpr inline
+void Vector3OrthoNormalize( Vector3* v1, Vector3* v2 ) {
+    float length  = NativeMath::Sqrt( v1->x*v1->x + v1->y*v1->y + v1->z*v1->z );
+    if( length == 0.0f ) {
+        length = 1.0f;
+    }
+    float ilength = 1.0f/length;
+    v1->x *= ilength;
+    v1->y *= ilength;
+    v1->z *= ilength;
+
+    Vector3 vn1 = Vector3CrossProduct( *v1, *v2 );
+    length = NativeMath::Sqrt( vn1.x*vn1.x + vn1.y*vn1.y + vn1.z*vn1.z );
+    if( length == 0.0f ) {
+        length = 1.0f;
+    }
+    ilength = 1.0f/length;
+    vn1.x *= ilength;
+    vn1.y *= ilength;
+    vn1.z *= ilength;
+
+    *v2 = Vector3CrossProduct( vn1, *v1 );
+}
+constexpr inline
+Vector3 Vector3Transform( Vector3 v, Matrix mat ) {
+    float x = v.x;
+    float y = v.y;
+    float z = v.z;
+    return Vector3{
+        mat.m0*x + mat.m4*y + mat.m8*z + mat.m12,
+        mat.m1*x + mat.m5*y + mat.m9*z + mat.m13,
+        mat.m2*x + mat.m6*y + mat.m10*z + mat.m14 };
+}
+constexpr inline
+Vector3 Vector3RotateByQuaternion( Vector3 v, Quaternion q ) {
+    return Vector3{
+        v.x*( q.x*q.x + q.w*q.w - q.y*q.y - q.z*q.z ) + v.y*( 2*q.x*q.y - 2*q.w*q.z ) + v.z*( 2*q.x*q.z + 2*q.w*q.y ),
+        v.x*( 2*q.w*q.z + 2*q.x*q.y ) + v.y*( q.w*q.w - q.x*q.x + q.y*q.y - q.z*q.z ) + v.z*( -2*q.w*q.x + 2*q.y*q.z ),
+        v.x*( -2*q.w*q.y + 2*q.x*q.z ) + v.y*( 2*q.w*q.x + 2*q.y*q.z ) + v.z*( q.w*q.w - q.x*q.x - q.y*q.y + q.z*q.z ) };
+}
+constexpr inline
+Vector3 Vector3RotateByAxisAngle( Vector3 v, Vector3 axis, float angle ) {
+    // NOTE(alicia): Euler-Rodrigues, as in raymath.
+    Vector3 result = v;
+    float length = NativeMath::Sqrt( axis.x*axis.x + axis.y*axis.y + axis.z*axis.z );
+    if( length == 0.0f ) {
+        length = 1.0f;
+    }
+    float ilength = 1.0f/length;
+    axis.x *= ilength;
+    axis.y *= ilength;
+    axis.z *= ilength;
+
+    angle /= 2.0f;
+    float a = NativeMath::Sin( angle );
+    float b = axis.x*a;
+    float c = axis.y*a;
+    float d = axis.z*a;
+    a = NativeMath::Cos( angle );
+    Vector3 w   = { b, c, d };
+    Vector3 wv  = Vector3CrossProduct( w, v );
+    Vector3 wwv = Vector3CrossProduct( w, wv );
+
+    a *= 2;
+    wv.x *= a;
+    wv.y *= a;
+    wv.z *= a;
+
+    wwv.x *= 2;
+    wwv.y *= 2;
+    wwv.z *= 2;
+
+    result.x += wv.x;
+    result.y += wv.y;
+    result.z += wv.z;
+
+    result.x += wwv.x;
+    result.y += wwv.y;
+    result.z += wwv.z;
+    return result;
+}
+constexpr inline
+Vector3 Vector3MoveTowards( Vector3 v, Vector3 target, float maxDistance ) {
+    float dx    = target.x - v.x;
+    float dy    = target.y - v.y;
+    float dz    = target.z - v.z;
+    float value = ( dx*dx ) + ( dy*dy ) + ( dz*dz );
+    if( ( value == 0 ) || ( ( maxDistance >= 0 ) && ( value <= maxDistance*maxDistance ) ) ) {
+        return target;
+    }
+    float dist = NativeMath::Sqrt( value );
+    return Vector3{
+        v.x + dx/dist*maxDistance,
+        v.y + dy/dist*maxDistance,
+        v.z + dz/dist*maxDistance };
+}
+constexpr inline
+Vector3 Vector3Lerp( Vector3 v1, Vector3 v2, float amount ) {
+    return Vector3{
+        v1.x + amount*( v2.x - v1.x ),
+        v1.y + amount*( v2.y - v1.y ),
+        v1.z + amount*( v2.z - v1.z ) };
+}
+constexpr inline
+Vector3 Vector3Reflect( Vector3 v, Vector3 normal ) {
+    float dotProduct = ( v.x*normal.x + v.y*normal.y + v.z*normal.z );
+    return Vector3{
+        v.x - ( 2.0f*normal.x )*dotProduct,
+        v.y - ( 2.0f*normal.y )*dotProduct,
+        v.z - ( 2.0f*normal.z )*dotProduct };
+}
+constexpr inline
+Vector3 Vector3Min( Vector3 v1, Vector3 v2 ) {
+    return Vector3{
+        NativeMath::Fmin( v1.x, v2.x ),
+        NativeMath::Fmin( v1.y, v2.y ),
+        NativeMath::Fmin( v1.z, v2.z ) };
+}
+constexpr inline
+Vector3 Vector3Max( Vector3 v1, Vector3 v2 ) {
+    return Vector3{
+        NativeMath::Fmax( v1.x, v2.x ),
+        NativeMath::Fmax( v1.y, v2.y ),
+        NativeMath::Fmax( v1.z, v2.z ) };
+}
+constexpr inline
+Vector3 Vector3Barycenter( Vector3 p, Vector3 a, Vector3 b, Vector3 c ) {
+    Vector3 v0 = Vector3Subtract( b, a );
+    Vector3 v1 = Vector3Subtract( c, a );
+    Vector3 v2 = Vector3Subtract( p, a );
+    float d00 = ( v0.x*v0.x + v0.y*v0.y + v0.z*v0.z );
+    float d01 = ( v0.x*v1.x + v0.y*v1.y + v0.z*v1.z );
+    float d11 = ( v1.x*v1.x + v1.y*v1.y + v1.z*v1.z );
+    float d20 = ( v2.x*v0.x + v2.y*v0.y + v2.z*v0.z );
+    float d21 = ( v2.x*v1.x + v2.y*v1.y + v2.z*v1.z );
+
+    float denom = d00*d11 - d01*d01;
+
+    Vector3 result = {};
+    result.y = ( d11*d20 - d01*d21 )/denom;
+    result.z = ( d00*d21 - d01*d20 )/denom;
+    result.x = 1.0f - ( result.z + result.y );
+    return result;
+}
+constexpr inline
+float3 Vector3ToFloatV( Vector3 v ) {
+    float3 buffer = {};
+    buffer.v[0] = v.x;
+    buffer.v[1] = v.y;
+    buffer.v[2] = v.z;
+    return buffer;
+}
+constexpr inline
+Vector3 Vector3Invert( Vector3 v ) {
+    return Vector3{ 1.0f/v.x, 1.0f/v.y, 1.0f/v.z };
+}
+constexpr inline
+Vector3 Vector3Clamp( Vector3 v, Vector3 min, Vector3 max ) {
+    return Vector3{
+        NativeMath::Fmin( max.x, NativeMath::Fmax( min.x, v.x ) ),
+        NativeMath::Fmin( max.y, NativeMath::Fmax( min.y, v.y ) ),
+        NativeMath::Fmin( max.z, NativeMath::Fmax( min.z, v.z ) ) };
+}
+constexpr inline
+Vector3 Vector3ClampValue( Vector3 v, float min, float max ) {
+    Vector3 result = v;
+    float length = ( v.x*v.x ) + ( v.y*v.y ) + ( v.z*v.z );
+    if( length > 0.0f ) {
+        length = NativeMath::Sqrt( length );
+        float scale = 1;
+        if( length < min ) {
+            scale = min/length;
+        } else if( length > max ) {
+            scale = max/length;
+        }
+        result.x = v.x*scale;
+        result.y = v.y*scale;
+        result.z = v.z*scale;
+    }
+    return result;
+}
+constexpr inline
+int Vector3Equals( Vector3 p, Vector3 q ) {
+    return FloatEquals( p.x, q.x ) && FloatEquals( p.y, q.y ) && FloatEquals( p.z, q.z );
+}
+constexpr inline
+Vector3 Vector3Refract( Vector3 v, Vector3 n, float r ) {
+    Vector3 result = {};
+    float dot = v.x*n.x + v.y*n.y + v.z*n.z;
+    float d   = 1.0f - r*r*( 1.0f - dot*dot );
+    if( d >= 0.0f ) {
+        d = NativeMath::Sqrt( d );
+        v.x = r*v.x - ( r*dot + d )*n.x;
+        v.y = r*v.y - ( r*dot + d )*n.y;
+        v.z = r*v.z - ( r*dot + d )*n.z;
+        result = v;
+    }
+    return result;
+}
+
+constexpr inline
+Vector4 Vector4Zero() {
+    return Vector4{ 0.0f, 0.0f, 0.0f, 0.0f };
+}
+constexpr inline
+Vector4 Vector4One() {
+    return Vector4{ 1.0f, 1.0f, 1.0f, 1.0f };
+}
+constexpr inline
+Vector4 Vector4Add( Vector4 v1, Vector4 v2 ) {
+    return Vector4{ v1.x + v2.x, v1.y + v2.y, v1.z + v2.z, v1.w + v2.w };
+}
+constexpr inline
+Vector4 Vector4AddValue( Vector4 v, float add ) {
+    return Vector4{ v.x + add, v.y + add, v.z + add, v.w + add };
+}
+constexpr inline
+Vector4 Vector4Subtract( Vector4 v1, Vector4 v2 ) {
+    return Vector4{ v1.x - v2.x, v1.y - v2.y, v1.z - v2.z, v1.w - v2.w };
+}
+constexpr inline
+Vector4 Vector4SubtractValue( Vector4 v, float sub ) {
+    return Vector4{ v.x - sub, v.y - sub, v.z - sub, v.w - sub };
+}
+constexpr inline
+float Vector4Length( Vector4 v ) {
+    return NativeMath::Sqrt( ( v.x*v.x ) + ( v.y*v.y ) + ( v.z*v.z ) + ( v.w*v.w ) );
+}
+constexpr inline
+float Vector4LengthSqr( Vector4 v ) {
+    return ( v.x*v.x ) + ( v.y*v.y ) + ( v.z*v.z ) + ( v.w*v.w );
+}
+constexpr inline
+float Vector4DotProduct( Vector4 v1, Vector4 v2 ) {
+    return ( v1.x*v2.x + v1.y*v2.y + v1.z*v2.z + v1.w*v2.w );
+}
+constexpr inline
+float Vector4DistanceSqr( Vector4 v1, Vector4 v2 ) {
+    return
+        ( v1.x - v2.x )*( v1.x - v2.x ) + ( v1.y - v2.y )*( v1.y - v2.y ) +
+        ( v1.z - v2.z )*( v1.z - v2.z ) + ( v1.w - v2.w )*( v1.w - v2.w );
+}
+constexpr inline
+float Vector4Distance( Vector4 v1, Vector4 v2 ) {
+    return NativeMath::Sqrt( Vector4DistanceSqr( v1, v2 ) );
+}
+constexpr inline
+Vector4 Vector4Scale( Vector4 v, float scale ) {
+    return Vector4{ v.x*scale, v.y*scale, v.z*scale, v.w*scale };
+}
+constexpr inline
+Vector4 Vector4Multiply( Vector4 v1, Vector4 v2 ) {
+    return Vector4{ v1.x*v2.x, v1.y*v2.y, v1.z*v2.z, v1.w*v2.w };
+}
+constexpr inline
+Vector4 Vector4Negate( Vector4 v ) {
+    return Vector4{ -v.x, -v.y, -v.z, -v.w };
+}
+constexpr inline
+Vector4 Vector4Divide( Vector4 v1, Vector4 v2 ) {
+    return Vector4{ v1.x/v2.x, v1.y/v2.y, v1.z/v2.z, v1.w/v2.w };
+}
+constexpr inline
+Vector4 Vector4Normalize( Vector4 v ) {
+    Vector4 result = {};
+    float length = NativeMath::Sqrt( ( v.x*v.x ) + ( v.y*v.y ) + ( v.z*v.z ) + ( v.w*v.w ) );
+    if( length > 0 ) {
+        float ilength = 1.0f/length;
+        result.x = v.x*ilength;
+        result.y = v.y*ilength;
+        result.z = v.z*ilength;
+        result.w = v.w*ilength;
+    }
+    return result;
+}
+constexpr inline
+Vector4 Vector4Min( Vector4 v1, Vector4 v2 ) {
+    return Vector4{
+        NativeMath::Fmin( v1.x, v2.x ), NativeMath::Fmin( v1.y, v2.y ),
+        NativeMath::Fmin( v1.z, v2.z ), NativeMath::Fmin( v1.w, v2.w ) };
+}
+constexpr inline
+Vector4 Vector4Max( Vector4 v1, Vector4 v2 ) {
+    return Vector4{
+        NativeMath::Fmax( v1.x, v2.x ), NativeMath::Fmax( v1.y, v2.y ),
+        NativeMath::Fmax( v1.z, v2.z ), NativeMath::Fmax( v1.w, v2.w ) };
+}
+constexpr inline
+Vector4 Vector4Lerp( Vector4 v1, Vector4 v2, float amount ) {
+    return Vector4{
+        v1.x + amount*( v2.x - v1.x ),
+        v1.y + amount*( v2.y - v1.y ),
+        v1.z + amount*( v2.z - v1.z ),
+        v1.w + amount*( v2.w - v1.w ) };
+}
+constexpr inline
+Vector4 Vector4MoveTowards( Vector4 v, Vector4 target, float maxDistance ) {
+    float dx    = target.x - v.x;
+    float dy    = target.y - v.y;
+    float dz    = target.z - v.z;
+    float dw    = target.w - v.w;
+    float value = ( dx*dx ) + ( dy*dy ) + ( dz*dz ) + ( dw*dw );
+    if( ( value == 0 ) || ( ( maxDistance >= 0 ) && ( value <= maxDistance*maxDistance ) ) ) {
+        return target;
+    }
+    float dist = NativeMath::Sqrt( value );
+    return Vector4{
+        v.x + dx/dist*maxDistance,
+        v.y + dy/dist*maxDistance,
+        v.z + dz/dist*maxDistance,
+        v.w + dw/dist*maxDistance };
+}
+constexpr inline
+Vector4 Vector4Invert( Vector4 v ) {
+    return Vector4{ 1.0f/v.x, 1.0f/v.y, 1.0f/v.z, 1.0f/v.w };
+}
+constexpr inline
+int Vector4Equals( Vector4 p, Vector4 q ) {
+    return
+        FloatEquals( p.x, q.x ) && FloatEquals( p.y, q.y ) &&
+        FloatEquals( p.z, q.z ) && FloatEquals( p.w, q.w );
+}
+
+constexpr inline
+float MatrixDeterminant( Matrix mat ) {
+    float a00 = mat.m0,  a01 = mat.m1,  a02 = mat.m2,  a03 = mat.m3;
+    float a10 = mat.m4,  a11 = mat.m5,  a12 = mat.m6,  a13 = mat.m7;
+    float a20 = mat.m8,  a21 = mat.m9,  a22 = mat.m10, a23 = mat.m11;
+    float a30 = mat.m12, a31 = mat.m13, a32 = mat.m14, a33 = mat.m15;
+
+    return
+        a30*a21*a12*a03 - a20*a31*a12*a03 - a30*a11*a22*a03 + a10*a31*a22*a03 +
+        a20*a11*a32*a03 - a10*a21*a32*a03 - a30*a21*a02*a13 + a20*a31*a02*a13 +
+        a30*a01*a22*a13 - a00*a31*a22*a13 - a20*a01*a32*a13 + a00*a21*a32*a13 +
+        a30*a11*a02*a23 - a10*a31*a02*a23 - a30*a01*a12*a23 + a00*a31*a12*a23 +
+        a10*a01*a32*a23 - a00*a11*a32*a23 - a20*a11*a02*a33 + a10*a21*a02*a33 +
+        a20*a01*a12*a33 - a00*a21*a12*a33 - a10*a01*a22*a33 + a00*a11*a22*a33;
+}
+constexpr inline
+float MatrixTrace( Matrix mat ) {
+    return ( mat.m0 + mat.m5 + mat.m10 + mat.m15 );
+}
+constexpr inline
+Matrix MatrixTranspose( Matrix mat ) {
+    return Matrix{
+        mat.m0,  mat.m1,  mat.m2,  mat.m3,
+        mat.m4,  mat.m5,  mat.m6,  mat.m7,
+        mat.m8,  mat.m9,  mat.m10, mat.m11,
+        mat.m12, mat.m13, mat.m14, mat.m15 };
+}
+constexpr inline
+Matrix MatrixInvert( Matrix mat ) {
+    Matrix result = {};
+
+    float a00 = mat.m0,  a01 = mat.m1,  a02 = mat.m2,  a03 = mat.m3;
+    float a10 = mat.m4,  a11 = mat.m5,  a12 = mat.m6,  a13 = mat.m7;
+    float a20 = mat.m8,  a21 = mat.m9,  a22 = mat.m10, a23 = mat.m11;
+    float a30 = mat.m12, a31 = mat.m13, a32 = mat.m14, a33 = mat.m15;
+
+    float b00 = a00*a11 - a01*a10;
+    float b01 = a00*a12 - a02*a10;
+    float b02 = a00*a13 - a03*a10;
+    float b03 = a01*a12 - a02*a11;
+    float b04 = a01*a13 - a03*a11;
+    float b05 = a02*a13 - a03*a12;
+    float b06 = a20*a31 - a21*a30;
+    float b07 = a20*a32 - a22*a30;
+    float b08 = a20*a33 - a23*a30;
+    float b09 = a21*a32 - a22*a31;
+    float b10 = a21*a33 - a23*a31;
+    float b11 = a22*a33 - a23*a32;
+
+    float invDet = 1.0f/( b00*b11 - b01*b10 + b02*b09 + b03*b08 - b04*b07 + b05*b06 );
+
+    result.m0  = (  a11*b11 - a12*b10 + a13*b09 )*invDet;
+    result.m1  = ( -a01*b11 + a02*b10 - a03*b09 )*invDet;
+    result.m2  = (  a31*b05 - a32*b04 + a33*b03 )*invDet;
+    result.m3  = ( -a21*b05 + a22*b04 - a23*b03 )*invDet;
+    result.m4  = ( -a10*b11 + a12*b08 - a13*b07 )*invDet;
+    result.m5  = (  a00*b11 - a02*b08 + a03*b07 )*invDet;
+    result.m6  = ( -a30*b05 + a32*b02 - a33*b01 )*invDet;
+    result.m7  = (  a20*b05 - a22*b02 + a23*b01 )*invDet;
+    result.m8  = (  a10*b10 - a11*b08 + a13*b06 )*invDet;
+    result.m9  = ( -a00*b10 + a01*b08 - a03*b06 )*invDet;
+    result.m10 = (  a30*b04 - a31*b02 + a33*b00 )*invDet;
+    result.m11 = ( -a20*b04 + a21*b02 - a23*b00 )*invDet;
+    result.m12 = ( -a10*b09 + a11*b07 - a12*b06 )*invDet;
+    result.m13 = (  a00*b09 - a01*b07 + a02*b06 )*invDet;
+    result.m14 = ( -a30*b03 + a31*b01 - a32*b00 )*invDet;
+    result.m15 = (  a20*b03 - a21*b01 + a22*b00 )*invDet;
+
+    return result;
+}
+constexpr inline
+Matrix MatrixIdentity() {
+    return Matrix{
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f };
+}
+constexpr inline
+Matrix MatrixAdd( Matrix left, Matrix right ) {
+    return Matrix{
+        left.m0 + right.m0, left.m4 + right.m4, left.m8  + right.m8,  left.m12 + right.m12,
+        left.m1 + right.m1, left.m5 + right.m5, left.m9  + right.m9,  left.m13 + right.m13,
+        left.m2 + right.m2, left.m6 + right.m6, left.m10 + right.m10, left.m14 + right.m14,
+        left.m3 + right.m3, left.m7 + right.m7, left.m11 + right.m11, left.m15 + right.m15 };
+}
+constexpr inline
+Matrix MatrixSubtract( Matrix left, Matrix right ) {
+    return Matrix{
+        left.m0 - right.m0, left.m4 - right.m4, left.m8  - right.m8,  left.m12 - right.m12,
+        left.m1 - right.m1, left.m5 - right.m5, left.m9  - right.m9,  left.m13 - right.m13,
+        left.m2 - right.m2, left.m6 - right.m6, left.m10 - right.m10, left.m14 - right.m14,
+        left.m3 - right.m3, left.m7 - right.m7, left.m11 - right.m11, left.m15 - right.m15 };
+}
+constexpr inline
+Matrix MatrixMultiply( Matrix left, Matrix right ) {
+    Matrix result = {};
+    result.m0 = left.m0*right.m0 + left.m1*right.m4 + left.m2*right.m8 + left.m3*right.m12;
+    result.m1 = left.m0*right.m1 + left.m1*right.m5 + left.m2*right.m9 + left.m3*right.m13;
+    result.m2 = left.m0*right.m2 + left.m1*right.m6 + left.m2*right.m10 + left.m3*right.m14;
+    result.m3 = left.m0*right.m3 + left.m1*right.m7 + left.m2*right.m11 + left.m3*right.m15;
+    result.m4 = left.m4*right.m0 + left.m5*right.m4 + left.m6*right.m8 + left.m7*right.m12;
+    result.m5 = left.m4*right.m1 + left.m5*right.m5 + left.m6*right.m9 + left.m7*right.m13;
+    result.m6 = left.m4*right.m2 + left.m5*right.m6 + left.m6*right.m10 + left.m7*right.m14;
+    result.m7 = left.m4*right.m3 + left.m5*right.m7 + left.m6*right.m11 + left.m7*right.m15;
+    result.m8 = left.m8*right.m0 + left.m9*right.m4 + left.m10*right.m8 + left.m11*right.m12;
+    result.m9 = left.m8*right.m1 + left.m9*right.m5 + left.m10*right.m9 + left.m11*right.m13;
+    result.m10 = left.m8*right.m2 + left.m9*right.m6 + left.m10*right.m10 + left.m11*right.m14;
+    result.m11 = left.m8*right.m3 + left.m9*right.m7 + left.m10*right.m11 + left.m11*right.m15;
+    result.m12 = left.m12*right.m0 + left.m13*right.m4 + left.m14*right.m8 + left.m15*right.m12;
+    result.m13 = left.m12*right.m1 + left.m13*right.m5 + left.m14*right.m9 + left.m15*right.m13;
+    result.m14 = left.m12*right.m2 + left.m13*right.m6 + left.m14*right.m10 + left.m15*right.m14;
+    result.m15 = left.m12*right.m3 + left.m13*right.m7 + left.m14*right.m11 + left.m15*right.m15;
+    return result;
+}
+constexpr inline
+Matrix MatrixTranslate( float x, float y, float z ) {
+    return Matrix{
+        1.0f, 0.0f, 0.0f, x,
+        0.0f, 1.0f, 0.0f, y,
+        0.0f, 0.0f, 1.0f, z,
+        0.0f, 0.0f, 0.0f, 1.0f };
+}
+constexpr inline
+Matrix MatrixRotate( Vector3 axis, float angle ) {
+    Matrix result = {};
+
+    float x = axis.x, y = axis.y, z = axis.z;
+    float lengthSquared = x*x + y*y + z*z;
+    if( ( lengthSquared != 1.0f ) && ( lengthSquared != 0.0f ) ) {
+        float ilength = 1.0f/NativeMath::Sqrt( lengthSquared );
+        x *= ilength;
+        y *= ilength;
+        z *= ilength;
+    }
+
+    float sinres = NativeMath::Sin( angle );
+    float cosres = NativeMath::Cos( angle );
+    float t = 1.0f - cosres;
+
+    result.m0 = x*x*t + cosres;
+    result.m1 = y*x*t + z*sinres;
+    result.m2 = z*x*t - y*sinres;
+    result.m3 = 0.0f;
+
+    result.m4 = x*y*t - z*sinres;
+    result.m5 = y*y*t + cosres;
+    result.m6 = z*y*t + x*sinres;
+    result.m7 = 0.0f;
+
+    result.m8  = x*z*t + y*sinres;
+    result.m9  = y*z*t - x*sinres;
+    result.m10 = z*z*t + cosres;
+    result.m11 = 0.0f;
+
+    result.m12 = 0.0f;
+    result.m13 = 0.0f;
+    result.m14 = 0.0f;
+    result.m15 = 1.0f;
+
+    return result;
+}
+constexpr inline
+Matrix MatrixRotateX( float angle ) {
+    Matrix result = MatrixIdentity();
+    float cosres = NativeMath::Cos( angle );
+    float sinres = NativeMath::Sin( angle );
+    result.m5  = cosres;
+    result.m6  = sinres;
+    result.m9  = -sinres;
+    result.m10 = cosres;
+    return result;
+}
+constexpr inline
+Matrix MatrixRotateY( float angle ) {
+    Matrix result = MatrixIdentity();
+    float cosres = NativeMath::Cos( angle );
+    float sinres = NativeMath::Sin( angle );
+    result.m0  = cosres;
+    result.m2  = -sinres;
+    result.m8  = sinres;
+    result.m10 = cosres;
+    return result;
+}
+constexpr inline
+Matrix MatrixRotateZ( float angle ) {
+    Matrix result = MatrixIdentity();
+    float cosres = NativeMath::Cos( angle );
+    float sinres = NativeMath::Sin( angle );
+    result.m0 = cosres;
+    result.m1 = sinres;
+    result.m4 = -sinres;
+    result.m5 = cosres;
+    return result;
+}
+constexpr inline
+Matrix MatrixRotateXYZ( Vector3 angle ) {
+    Matrix result = MatrixIdentity();
+
+    float cosz = NativeMath::Cos( -angle.z );
+    float sinz = NativeMath::Sin( -angle.z );
+    float cosy = NativeMath::Cos( -angle.y );
+    float siny = NativeMath::Sin( -angle.y );
+    float cosx = NativeMath::Cos( -angle.x );
+    float sinx = NativeMath::Sin( -angle.x );
+
+    result.m0 = cosz*cosy;
+    result.m1 = ( cosz*siny*sinx ) - ( sinz*cosx );
+    result.m2 = ( cosz*siny*cosx ) + ( sinz*sinx );
+
+    result.m4 = sinz*cosy;
+    result.m5 = ( sinz*siny*sinx ) + ( cosz*cosx );
+    result.m6 = ( sinz*siny*cosx ) - ( cosz*sinx );
+
+    result.m8  = -siny;
+    result.m9  = cosy*sinx;
+    result.m10 = cosy*cosx;
+
+    return result;
+}
+constexpr inline
+Matrix MatrixRotateZYX( Vector3 angle ) {
+    Matrix result = {};
+
+    float cz = NativeMath::Cos( angle.z );
+    float sz = NativeMath::Sin( angle.z );
+    float cy = NativeMath::Cos( angle.y );
+    float sy = NativeMath::Sin( angle.y );
+    float cx = NativeMath::Cos( angle.x );
+    float sx = NativeMath::Sin( angle.x );
+
+    result.m0  = cz*cy;
+    result.m4  = cz*sy*sx - cx*sz;
+    result.m8  = sz*sx + cz*cx*sy;
+    result.m12 = 0;
+
+    result.m1  = cy*sz;
+    result.m5  = cz*cx + sz*sy*sx;
+    result.m9  = cx*sz*sy - cz*sx;
+    result.m13 = 0;
+
+    result.m2  = -sy;
+    result.m6  = cy*sx;
+    result.m10 = cy*cx;
+    result.m14 = 0;
+
+    result.m3  = 0;
+    result.m7  = 0;
+    result.m11 = 0;
+    result.m15 = 1;
+
+    return result;
+}
+constexpr inline
+Matrix MatrixScale( float x, float y, float z ) {
+    return Matrix{
+        x,    0.0f, 0.0f, 0.0f,
+        0.0f, y,    0.0f, 0.0f,
+        0.0f, 0.0f, z,    0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f };
+}
+constexpr inline
+Matrix MatrixFrustum(
+    double left, double right,
+    double bottom, double top,
+    double nearPlane, double farPlane
+) {
+    Matrix result = {};
+
+    float rl = (float)( right - left );
+    float tb = (float)( top - bottom );
+    float fn = (float)( farPlane - nearPlane );
+
+    result.m0 = ( (float)nearPlane*2.0f )/rl;
+    result.m5 = ( (float)nearPlane*2.0f )/tb;
+
+    result.m8  = ( (float)right + (float)left )/rl;
+    result.m9  = ( (float)top + (float)bottom )/tb;
+    result.m10 = -( (float)farPlane + (float)nearPlane )/fn;
+    result.m11 = -1.0f;
+
+    result.m14 = -( (float)farPlane*(float)nearPlane*2.0f )/fn;
+
+    return result;
+}
+constexpr inline
+Matrix MatrixPerspective( double fovY, double aspect, double nearPlane, double farPlane ) {
+    double top    = nearPlane*NativeMath::Tan( fovY*0.5 );
+    double bottom = -top;
+    double right  = top*aspect;
+    double left   = -right;
+    return MatrixFrustum( left, right, bottom, top, nearPlane, farPlane );
+}
+constexpr inline
+Matrix MatrixOrtho(
+    double left, double right,
+    double bottom, double top,
+    double nearPlane, double farPlane
+) {
+    Matrix result = {};
+
+    float rl = (float)( right - left );
+    float tb = (float)( top - bottom );
+    float fn = (float)( farPlane - nearPlane );
+
+    result.m0  = 2.0f/rl;
+    result.m5  = 2.0f/tb;
+    result.m10 = -2.0f/fn;
+    result.m12 = -( (float)left + (float)right )/rl;
+    result.m13 = -( (float)top + (float)bottom )/tb;
+    result.m14 = -( (float)farPlane + (float)nearPlane )/fn;
+    result.m15 = 1.0f;
+
+    return result;
+}
+constexpr inline
+Matrix MatrixLookAt( Vector3 eye, Vector3 target, Vector3 up ) {
+    Matrix result = {};
+
+    float length  = 0.0f;
+    float ilength = 0.0f;
+
+    Vector3 vz = Vector3Subtract( eye, target );
+    length = NativeMath::Sqrt( vz.x*vz.x + vz.y*vz.y + vz.z*vz.z );
+    if( length == 0.0f ) {
+        length = 1.0f;
+    }
+    ilength = 1.0f/length;
+    vz.x *= ilength;
+    vz.y *= ilength;
+    vz.z *= ilength;
+
+    Vector3 vx = Vector3CrossProduct( up, vz );
+    length = NativeMath::Sqrt( vx.x*vx.x + vx.y*vx.y + vx.z*vx.z );
+    if( length == 0.0f ) {
+        length = 1.0f;
+    }
+    ilength = 1.0f/length;
+    vx.x *= ilength;
+    vx.y *= ilength;
+    vx.z *= ilength;
+
+    Vector3 vy = Vector3CrossProduct( vz, vx );
+
+    result.m0 = vx.x;
+    result.m1 = vy.x;
+    result.m2 = vz.x;
+    result.m3 = 0.0f;
+    result.m4 = vx.y;
+    result.m5 = vy.y;
+    result.m6 = vz.y;
+    result.m7 = 0.0f;
+    result.m8 = vx.z;
+    result.m9 = vy.z;
+    result.m10 = vz.z;
+    result.m11 = 0.0f;
+    result.m12 = -( vx.x*eye.x + vx.y*eye.y + vx.z*eye.z );
+    result.m13 = -( vy.x*eye.x + vy.y*eye.y + vy.z*eye.z );
+    result.m14 = -( vz.x*eye.x + vz.y*eye.y + vz.z*eye.z );
+    result.m15 = 1.0f;
+
+    return result;
+}
+constexpr inline
+float16 MatrixToFloatV( Matrix mat ) {
+    float16 result = {};
+    result.v[0]  = mat.m0;
+    result.v[1]  = mat.m1;
+    result.v[2]  = mat.m2;
+    result.v[3]  = mat.m3;
+    result.v[4]  = mat.m4;
+    result.v[5]  = mat.m5;
+    result.v[6]  = mat.m6;
+    result.v[7]  = mat.m7;
+    result.v[8]  = mat.m8;
+    result.v[9]  = mat.m9;
+    result.v[10] = mat.m10;
+    result.v[11] = mat.m11;
+    result.v[12] = mat.m12;
+    result.v[13] = mat.m13;
+    result.v[14] = mat.m14;
+    result.v[15] = mat.m15;
+    return result;
+}
+constexpr inline
+Vector3 Vector3Unproject( Vector3 source, Matrix projection, Matrix view ) {
+    Matrix matViewProjInv = MatrixInvert( MatrixMultiply( view, projection ) );
+    Quaternion quat = { source.x, source.y, source.z, 1.0f };
+    Quaternion qtransformed = {
+        matViewProjInv.m0*quat.x + matViewProjInv.m4*quat.y + matViewProjInv.m8*quat.z + matViewProjInv.m12*quat.w,
+        matViewProjInv.m1*quat.x + matViewProjInv.m5*quat.y + matViewProjInv.m9*quat.z + matViewProjInv.m13*quat.w,
+        matViewProjInv.m2*quat.x + matViewProjInv.m6*quat.y + matViewProjInv.m10*quat.z + matViewProjInv.m14*quat.w,
+        matViewProjInv.m3*quat.x + matViewProjInv.m7*quat.y + matViewProjInv.m11*quat.z + matViewProjInv.m15*quat.w };
+    return Vector3{
+        qtransformed.x/qtransformed.w,
+        qtransformed.y/qtransformed.w,
+        qtransformed.z/qtransformed.w };
+}
+
+constexpr inline
+Quaternion QuaternionAdd( Quaternion q1, Quaternion q2 ) {
+    return Vector4Add( q1, q2 );
+}
+constexpr inline
+Quaternion QuaternionAddValue( Quaternion q, float add ) {
+    return Vector4AddValue( q, add );
+}
+constexpr inline
+Quaternion QuaternionSubtract( Quaternion q1, Quaternion q2 ) {
+    return Vector4Subtract( q1, q2 );
+}
+constexpr inline
+Quaternion QuaternionSubtractValue( Quaternion q, float sub ) {
+    return Vector4SubtractValue( q, sub );
+}
+constexpr inline
+Quaternion QuaternionIdentity() {
+    return Quaternion{ 0.0f, 0.0f, 0.0f, 1.0f };
+}
+constexpr inline
+float QuaternionLength( Quaternion q ) {
+    return NativeMath::Sqrt( q.x*q.x + q.y*q.y + q.z*q.z + q.w*q.w );
+}
+constexpr inline
+Quaternion QuaternionNormalize( Quaternion q ) {
+    float length = NativeMath::Sqrt( q.x*q.x + q.y*q.y + q.z*q.z + q.w*q.w );
+    if( length == 0.0f ) {
+        length = 1.0f;
+    }
+    float ilength = 1.0f/length;
+    return Quaternion{ q.x*ilength, q.y*ilength, q.z*ilength, q.w*ilength };
+}
+constexpr inline
+Quaternion QuaternionInvert( Quaternion q ) {
+    Quaternion result = q;
+    float lengthSq = q.x*q.x + q.y*q.y + q.z*q.z + q.w*q.w;
+    if( lengthSq != 0.0f ) {
+        float invLength = 1.0f/lengthSq;
+        result.x *= -invLength;
+        result.y *= -invLength;
+        result.z *= -invLength;
+        result.w *= invLength;
+    }
+    return result;
+}
+constexpr inline
+Quaternion QuaternionMultiply( Quaternion q1, Quaternion q2 ) {
+    float qax = q1.x, qay = q1.y, qaz = q1.z, qaw = q1.w;
+    float qbx = q2.x, qby = q2.y, qbz = q2.z, qbw = q2.w;
+    return Quaternion{
+        qax*qbw + qaw*qbx + qay*qbz - qaz*qby,
+        qay*qbw + qaw*qby + qaz*qbx - qax*qbz,
+        qaz*qbw + qaw*qbz + qax*qby - qay*qbx,
+        qaw*qbw - qax*qbx - qay*qby - qaz*qbz };
+}
+constexpr inline
+Quaternion QuaternionScale( Quaternion q, float mul ) {
+    return Vector4Scale( q, mul );
+}
+constexpr inline
+Quaternion QuaternionDivide( Quaternion q1, Quaternion q2 ) {
+    return Vector4Divide( q1, q2 );
+}
+constexpr inline
+Quaternion QuaternionLerp( Quaternion q1, Quaternion q2, float amount ) {
+    return Vector4Lerp( q1, q2, amount );
+}
+constexpr inline
+Quaternion QuaternionNlerp( Quaternion q1, Quaternion q2, float amount ) {
+    return QuaternionNormalize( QuaternionLerp( q1, q2, amount ) );
+}
+constexpr inline
+Quaternion QuaternionSlerp( Quaternion q1, Quaternion q2, float amount ) {
+    Quaternion result = {};
+
+    float cosHalfTheta = q1.x*q2.x + q1.y*q2.y + q1.z*q2.z + q1.w*q2.w;
+    if( cosHalfTheta < 0 ) {
+        q2.x = -q2.x;
+        q2.y = -q2.y;
+        q2.z = -q2.z;
+        q2.w = -q2.w;
+        cosHalfTheta = -cosHalfTheta;
+    }
+
+    if( NativeMath::Fabs( cosHalfTheta ) >= 1.0f ) {
+        result = q1;
+    } else if( cosHalfTheta > 0.95f ) {
+        result = QuaternionNlerp( q1, q2, amount );
+    } else {
+        float halfTheta    = NativeMath::Acos( cosHalfTheta );
+        float sinHalfTheta = NativeMath::Sqrt( 1.0f - cosHalfTheta*cosHalfTheta );
+
+        if( NativeMath::Fabs( sinHalfTheta ) < EPSILON ) {
+            result.x = ( q1.x*0.5f + q2.x*0.5f );
+            result.y = ( q1.y*0.5f + q2.y*0.5f );
+            result.z = ( q1.z*0.5f + q2.z*0.5f );
+            result.w = ( q1.w*0.5f + q2.w*0.5f );
+        } else {
+            float ratioA = NativeMath::Sin( ( 1 - amount )*halfTheta )/sinHalfTheta;
+            float ratioB = NativeMath::Sin( amount*halfTheta )/sinHalfTheta;
+
+            result.x = ( q1.x*ratioA + q2.x*ratioB );
+            result.y = ( q1.y*ratioA + q2.y*ratioB );
+            result.z = ( q1.z*ratioA + q2.z*ratioB );
+            result.w = ( q1.w*ratioA + q2.w*ratioB );
+        }
+    }
+    return result;
+}
+constexpr inline
+Quaternion QuaternionFromVector3ToVector3( Vector3 from, Vector3 to ) {
+    float cos2Theta = ( from.x*to.x + from.y*to.y + from.z*to.z );
+    Vector3 cross   = Vector3CrossProduct( from, to );
+    return QuaternionNormalize( Quaternion{ cross.x, cross.y, cross.z, 1.0f + cos2Theta } );
+}
+constexpr inline
+Quaternion QuaternionFromMatrix( Matrix mat ) {
+    Quaternion result = {};
+
+    float fourWSquaredMinus1 = mat.m0  + mat.m5 + mat.m10;
+    float fourXSquaredMinus1 = mat.m0  - mat.m5 - mat.m10;
+    float fourYSquaredMinus1 = mat.m5  - mat.m0 - mat.m10;
+    float fourZSquaredMinus1 = mat.m10 - mat.m0 - mat.m5;
+
+    int biggestIndex = 0;
+    float fourBiggestSquaredMinus1 = fourWSquaredMinus1;
+    if( fourXSquaredMinus1 > fourBiggestSquaredMinus1 ) {
+        fourBiggestSquaredMinus1 = fourXSquaredMinus1;
+        biggestIndex = 1;
+    }
+    if( fourYSquaredMinus1 > fourBiggestSquaredMinus1 ) {
+        fourBiggestSquaredMinus1 = fourYSquaredMinus1;
+        biggestIndex = 2;
+    }
+    if( fourZSquaredMinus1 > fourBiggestSquaredMinus1 ) {
+        fourBiggestSquaredMinus1 = fourZSquaredMinus1;
+        biggestIndex = 3;
+    }
+
+    float biggestVal = NativeMath::Sqrt( fourBiggestSquaredMinus1 + 1.0f )*0.5f;
+    float mult = 0.25f/biggestVal;
+
+    switch( biggestIndex ) {
+        case 0: {
+            result.w = biggestVal;
+            result.x = ( mat.m6 - mat.m9 )*mult;
+            result.y = ( mat.m8 - mat.m2 )*mult;
+            result.z = ( mat.m1 - mat.m4 )*mult;
+        } break;
+        case 1: {
+            result.x = biggestVal;
+            result.w = ( mat.m6 - mat.m9 )*mult;
+            result.y = ( mat.m1 + mat.m4 )*mult;
+            result.z = ( mat.m8 + mat.m2 )*mult;
+        } break;
+        case 2: {
+            result.y = biggestVal;
+            result.w = ( mat.m8 - mat.m2 )*mult;
+            result.x = ( mat.m1 + mat.m4 )*mult;
+            result.z = ( mat.m6 + mat.m9 )*mult;
+        } break;
+        default: {
+            result.z = biggestVal;
+            result.w = ( mat.m1 - mat.m4 )*mult;
+            result.x = ( mat.m8 + mat.m2 )*mult;
+            result.y = ( mat.m6 + mat.m9 )*mult;
+        } break;
+    }
+
+    return result;
+}
+constexpr inline
+Matrix QuaternionToMatrix( Quaternion q ) {
+    Matrix result = MatrixIdentity();
+
+    float a2 = q.x*q.x;
+    float b2 = q.y*q.y;
+    float c2 = q.z*q.z;
+    float ac = q.x*q.z;
+    float ab = q.x*q.y;
+    float bc = q.y*q.z;
+    float ad = q.w*q.x;
+    float bd = q.w*q.y;
+    float cd = q.w*q.z;
+
+    result.m0 = 1 - 2*( b2 + c2 );
+    result.m1 = 2*( ab + cd );
+    result.m2 = 2*( ac - bd );
+
+    result.m4 = 2*( ab - cd );
+    result.m5 = 1 - 2*( a2 + c2 );
+    result.m6 = 2*( bc + ad );
+
+    result.m8  = 2*( ac + bd );
+    result.m9  = 2*( bc - ad );
+    result.m10 = 1 - 2*( a2 + b2 );
+
+    return result;
+}
+constexpr inline
+Quaternion QuaternionFromAxisAngle( Vector3 axis, float angle ) {
+    Quaternion result = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+    float axisLength = NativeMath::Sqrt( axis.x*axis.x + axis.y*axis.y + axis.z*axis.z );
+    if( axisLength != 0.0f ) {
+        angle *= 0.5f;
+
+        float ilength = 1.0f/axisLength;
+        axis.x *= ilength;
+        axis.y *= ilength;
+        axis.z *= ilength;
+
+        float sinres = NativeMath::Sin( angle );
+        float cosres = NativeMath::Cos( angle );
+
+        result.x = axis.x*sinres;
+        result.y = axis.y*sinres;
+        result.z = axis.z*sinres;
+        result.w = cosres;
+
+        result = QuaternionNormalize( result );
+    }
+    return result;
+}
+constexpr inline
+void QuaternionToAxisAngle( Quaternion q, Vector3* outAxis, float* outAngle ) {
+    if( NativeMath::Fabs( q.w ) > 1.0f ) {
+        q = QuaternionNormalize( q );
+    }
+
+    Vector3 resAxis = { 0.0f, 0.0f, 0.0f };
+    float resAngle  = 2.0f*NativeMath::Acos( q.w );
+    float den       = NativeMath::Sqrt( 1.0f - q.w*q.w );
+
+    if( den > EPSILON ) {
+        resAxis.x = q.x/den;
+        resAxis.y = q.y/den;
+        resAxis.z = q.z/den;
+    } else {
+        // NOTE(alicia): angle is zero, any normalized axis works.
+        resAxis.x = 1.0f;
+    }
+
+    *outAxis  = resAxis;
+    *outAngle = resAngle;
+}
+constexpr inline
+Quaternion QuaternionFromEuler( float pitch, float yaw, float roll ) {
+    float x0 = NativeMath::Cos( pitch*0.5f );
+    float x1 = NativeMath::Sin( pitch*0.5f );
+    float y0 = NativeMath::Cos( yaw*0.5f );
+    float y1 = NativeMath::Sin( yaw*0.5f );
+    float z0 = NativeMath::Cos( roll*0.5f );
+    float z1 = NativeMath::Sin( roll*0.5f );
+
+    return Quaternion{
+        x1*y0*z0 - x0*y1*z1,
+        x0*y1*z0 + x1*y0*z1,
+        x0*y0*z1 - x1*y1*z0,
+        x0*y0*z0 + x1*y1*z1 };
+}
+constexpr inline
+Vector3 QuaternionToEuler( Quaternion q ) {
+    Vector3 result = {};
+
+    float x0 = 2.0f*( q.w*q.x + q.y*q.z );
+    float x1 = 1.0f - 2.0f*( q.x*q.x + q.y*q.y );
+    result.x = NativeMath::Atan2( x0, x1 );
+
+    float y0 = 2.0f*( q.w*q.y - q.z*q.x );
+    y0 = y0 > 1.0f ? 1.0f : y0;
+    y0 = y0 < -1.0f ? -1.0f : y0;
+    result.y = NativeMath::Asin( y0 );
+
+    float z0 = 2.0f*( q.w*q.z + q.x*q.y );
+    float z1 = 1.0f - 2.0f*( q.y*q.y + q.z*q.z );
+    result.z = NativeMath::Atan2( z0, z1 );
+
+    return result;
+}
+constexpr inline
+Quaternion QuaternionTransform( Quaternion q, Matrix mat ) {
+    return Quaternion{
+        mat.m0*q.x + mat.m4*q.y + mat.m8*q.z + mat.m12*q.w,
+        mat.m1*q.x + mat.m5*q.y + mat.m9*q.z + mat.m13*q.w,
+        mat.m2*q.x + mat.m6*q.y + mat.m10*q.z + mat.m14*q.w,
+        mat.m3*q.x + mat.m7*q.y + mat.m11*q.z + mat.m15*q.w };
+}
+constexpr inline
+int QuaternionEquals( Quaternion p, Quaternion q ) {
+    return Vector4Equals( p, q ) || Vector4Equals( p, Vector4Negate( q ) );
+}
+#else
+    #include <raymath.h>
+    #define RAYMATH_CPP_CONSTEXPR
+    #define RAYMATH_CPP_CONSTANT_EVALUATED() false
+#endif
+#if !defined(RAYMATH_CPP_NO_STDLIB)
+    #include <utility>
+    #include <type_traits>
+    #include <cstdlib>
+    #if defined(__has_include)
+        #if __has_include(<span>) &&\
+            ( __cplusplus >= 202002L || ( defined(_MSVC_LANG) && _MSVC_LANG >= 202002L ) )
+            #include <span>
+            #define RAYMATH_CPP_SPAN
+        #endif
+    #endif
+    #if defined(RAYMATH_CPP_PARALLEL)
+        #include <thread>
+        #include <mutex>
+        #include <condition_variable>
+        #include <atomic>
+        #include <vector>
+    #endif
+#elif defined(RAYMATH_CPP_PARALLEL)
+    #error "RAYMATH_CPP_PARALLEL requires the standard library"
+#endif
+
+// NOTE(alicia): SIMD level is picked up from compiler flags
+// (-msse2, -msse4.1, -mavx, -mavx2 -mfma, /arch:AVX2 ...).
+// RAYMATH_CPP_NO_SIMD        forces the scalar paths.
+// RAYMATH_CPP_NO_FMA         keeps the SIMD kernels on separate mul/add.
+//                            the scalar paths only match them bit for bit
+//                            if the compiler doesn't fuse a*b + c either,
+//                            GCC/Clang need -ffp-contract=off for that.
+// RAYMATH_CPP_RUNTIME_DISPATCH picks the widest kernel the running
+//                            cpu supports (GCC/Clang, x86 only).
+#if !defined(RAYMATH_CPP_NO_SIMD)
+    #if defined(__AVX2__)
+        #define RAYMATH_CPP_AVX2
+    #endif
+    #if defined(__AVX__) || defined(RAYMATH_CPP_AVX2)
+        #define RAYMATH_CPP_AVX
+    #endif
+    #if defined(__SSE4_1__) || defined(RAYMATH_CPP_AVX)
+        #define RAYMATH_CPP_SSE4_1
+    #endif
+    #if defined(__SSE2__) || defined(_M_X64) ||\
+        ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 ) ||\
+        defined(RAYMATH_CPP_SSE4_1)
+        #define RAYMATH_CPP_SSE2
+    #endif
+    #if !defined(RAYMATH_CPP_FMA) && !defined(RAYMATH_CPP_NO_FMA) &&\
+        ( defined(__FMA__) || ( defined(_MSC_VER) && defined(__AVX2__) ) )
+        #define RAYMATH_CPP_FMA
+    #endif
+    #if defined(RAYMATH_CPP_AVX) &&\
+        ( defined(__F16C__) || ( defined(_MSC_VER) && defined(__AVX2__) ) )
+        #define RAYMATH_CPP_F16C
+    #endif
+    #if defined(RAYMATH_CPP_RUNTIME_DISPATCH) &&\
+        ( defined(__GNUC__) || defined(__clang__) ) &&\
+        ( defined(__x86_64__) || defined(__i386__) )
+        #define RAYMATH_CPP_DISPATCH
+        #define RAYMATH_CPP_TARGET( isa ) __attribute__((target(isa)))
+    #else
+        #define RAYMATH_CPP_TARGET( isa )
+    #endif
+    #if defined(RAYMATH_CPP_SSE2) || defined(RAYMATH_CPP_DISPATCH)
+        #include <immintrin.h>
+    #endif
+#endif
+#if !defined(RAYMATH_CPP_TARGET)
+    #define RAYMATH_CPP_TARGET( isa )
+#endif
+
+#if defined(RAYMATH_CPP_SSE2)
+// NOTE(alicia): 4-wide helpers for the batch paths.
+// loads transpose 4 AoS vectors into one register per component,
+// stores transpose them back.
+struct Simd4 {
+    static inline
+    void Load( const Vector2* v, __m128* x, __m128* y ) {
+        const float* p = (const float*)v;
+        __m128 a = _mm_loadu_ps( p + 0 );
+        __m128 b = _mm_loadu_ps( p + 4 );
+        *x = _mm_shuffle_ps( a, b, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+        *y = _mm_shuffle_ps( a, b, _MM_SHUFFLE( 3, 1, 3, 1 ) );
+    }
+    static inline
+    void Store( Vector2* v, __m128 x, __m128 y ) {
+        float* p = (float*)v;
+        _mm_storeu_ps( p + 0, _mm_unpacklo_ps( x, y ) );
+        _mm_storeu_ps( p + 4, _mm_unpackhi_ps( x, y ) );
+    }
+    static inline
+    void Load( const Vector3* v, __m128* x, __m128* y, __m128* z ) {
+        const float* p = (const float*)v;
+        __m128 a = _mm_loadu_ps( p + 0 ); // x0 y0 z0 x1
+        __m128 b = _mm_loadu_ps( p + 4 ); // y1 z1 x2 y2
+        __m128 c = _mm_loadu_ps( p + 8 ); // z2 x3 y3 z3
+
+        __m128 t = _mm_shuffle_ps( b, c, _MM_SHUFFLE( 1, 1, 2, 2 ) );
+        *x = _mm_shuffle_ps( a, t, _MM_SHUFFLE( 2, 0, 3, 0 ) );
+
+        __m128 t0 = _mm_shuffle_ps( a, b, _MM_SHUFFLE( 0, 0, 1, 1 ) );
+        __m128 t1 = _mm_shuffle_ps( b, c, _MM_SHUFFLE( 2, 2, 3, 3 ) );
+        *y = _mm_shuffle_ps( t0, t1, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+
+        t = _mm_shuffle_ps( a, b, _MM_SHUFFLE( 1, 1, 2, 2 ) );
+        *z = _mm_shuffle_ps( t, c, _MM_SHUFFLE( 3, 0, 2, 0 ) );
+    }
+#if defined(RAYMATH_CPP_AVX)
+    /// 8 Vector3, two 4-wide loads in the low and high lanes.
+    static inline
+    void Load( const Vector3* v, __m256* x, __m256* y, __m256* z ) {
+        __m128 x0, y0, z0, x1, y1, z1;
+        Load( v + 0, &x0, &y0, &z0 );
+        Load( v + 4, &x1, &y1, &z1 );
+        *x = _mm256_insertf128_ps( _mm256_castps128_ps256( x0 ), x1, 1 );
+        *y = _mm256_insertf128_ps( _mm256_castps128_ps256( y0 ), y1, 1 );
+        *z = _mm256_insertf128_ps( _mm256_castps128_ps256( z0 ), z1, 1 );
+    }
+#endif
+    static inline
+    void Store( Vector3* v, __m128 x, __m128 y, __m128 z ) {
+        float* p = (float*)v;
+        __m128 t0 = _mm_shuffle_ps( x, y, _MM_SHUFFLE( 0, 0, 0, 0 ) );
+        __m128 t1 = _mm_shuffle_ps( z, x, _MM_SHUFFLE( 1, 1, 0, 0 ) );
+        _mm_storeu_ps( p + 0, _mm_shuffle_ps( t0, t1, _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+
+        t0 = _mm_shuffle_ps( y, z, _MM_SHUFFLE( 1, 1, 1, 1 ) );
+        t1 = _mm_shuffle_ps( x, y, _MM_SHUFFLE( 2, 2, 2, 2 ) );
+        _mm_storeu_ps( p + 4, _mm_shuffle_ps( t0, t1, _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+
+        t0 = _mm_shuffle_ps( z, x, _MM_SHUFFLE( 3, 3, 2, 2 ) );
+        t1 = _mm_shuffle_ps( y, z, _MM_SHUFFLE( 3, 3, 3, 3 ) );
+        _mm_storeu_ps( p + 8, _mm_shuffle_ps( t0, t1, _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+    }
+    static inline
+    void Load( const Vector4* v, __m128* x, __m128* y, __m128* z, __m128* w ) {
+        const float* p = (const float*)v;
+        __m128 a = _mm_loadu_ps( p + 0 );
+        __m128 b = _mm_loadu_ps( p + 4 );
+        __m128 c = _mm_loadu_ps( p + 8 );
+        __m128 d = _mm_loadu_ps( p + 12 );
+        _MM_TRANSPOSE4_PS( a, b, c, d );
+        *x = a; *y = b; *z = c; *w = d;
+    }
+    static inline
+    void Store( Vector4* v, __m128 x, __m128 y, __m128 z, __m128 w ) {
+        float* p = (float*)v;
+        _MM_TRANSPOSE4_PS( x, y, z, w );
+        _mm_storeu_ps( p + 0,  x );
+        _mm_storeu_ps( p + 4,  y );
+        _mm_storeu_ps( p + 8,  z );
+        _mm_storeu_ps( p + 12, w );
+    }
+
+    /// Matrix columns ( m0, m1, m2, m3 ) ... ( m12, m13, m14, m15 ).
+    static inline
+    void Columns( const Matrix& mat, __m128* c0, __m128* c1, __m128* c2, __m128* c3 ) {
+        const float* p = &mat.m0;
+        __m128 a = _mm_loadu_ps( p + 0 );
+        __m128 b = _mm_loadu_ps( p + 4 );
+        __m128 c = _mm_loadu_ps( p + 8 );
+        __m128 d = _mm_loadu_ps( p + 12 );
+        _MM_TRANSPOSE4_PS( a, b, c, d );
+        *c0 = a; *c1 = b; *c2 = c; *c3 = d;
+    }
+    /// Pack the xyz of 4 registers into 3 Vector3.
+    static inline
+    void Store3( Vector3* v, __m128 r0, __m128 r1, __m128 r2, __m128 r3 ) {
+        float* p = (float*)v;
+        __m128 t = _mm_shuffle_ps( r0, r1, _MM_SHUFFLE( 0, 0, 2, 2 ) );
+        _mm_storeu_ps( p + 0, _mm_shuffle_ps( r0, t, _MM_SHUFFLE( 2, 0, 1, 0 ) ) );
+        _mm_storeu_ps( p + 4, _mm_shuffle_ps( r1, r2, _MM_SHUFFLE( 1, 0, 2, 1 ) ) );
+        t = _mm_shuffle_ps( r2, r3, _MM_SHUFFLE( 0, 0, 2, 2 ) );
+        _mm_storeu_ps( p + 8, _mm_shuffle_ps( t, r3, _MM_SHUFFLE( 2, 1, 2, 0 ) ) );
+    }
+    template<int Lane> static inline
+    __m128 Broadcast( __m128 v ) {
+        return _mm_shuffle_ps( v, v, _MM_SHUFFLE( Lane, Lane, Lane, Lane ) );
+    }
+
+    /// mask ? a : b
+    static inline
+    __m128 Select( __m128 mask, __m128 a, __m128 b ) {
+        return _mm_or_ps( _mm_and_ps( mask, a ), _mm_andnot_ps( mask, b ) );
+    }
+    /// 1 / sqrt( lengthSqr ), 1 for zero so zero vectors stay unchanged.
+    static inline
+    __m128 InverseLength( __m128 lengthSqr ) {
+        __m128 one = _mm_set1_ps( 1.0f );
+        return Select(
+            _mm_cmpeq_ps( lengthSqr, _mm_setzero_ps() ),
+            one, _mm_div_ps( one, _mm_sqrt_ps( lengthSqr ) ) );
+    }
+    /// Scale applied by Vector2ClampValue/Vector3ClampValue.
+    static inline
+    __m128 ClampLengthScale( __m128 lengthSqr, __m128 min, __m128 max ) {
+        __m128 one    = _mm_set1_ps( 1.0f );
+        __m128 length = _mm_sqrt_ps( lengthSqr );
+        __m128 scale  = Select( _mm_cmpgt_ps( length, max ), _mm_div_ps( max, length ), one );
+        scale = Select( _mm_cmplt_ps( length, min ), _mm_div_ps( min, length ), scale );
+        return Select( _mm_cmpgt_ps( lengthSqr, _mm_setzero_ps() ), scale, one );
+    }
+};
+#endif
+
+// NOTE(alicia): approximate 1 / length, 4 at a time.
+// with SSE2, 1/sqrt( x ) is rsqrtps (12 bits) refined by one newton
+// step. max relative error is 3.4e-7, checked over 1M squared lengths
+// from 1e-30 to 1e30 by bench/fast_math_error.cpp. without SSE2 it is
+// 1.0f / sqrtf( x ), bit tricks like 0x5F375A86 are slower than a
+// hardware square root.
+// one value at a time the estimate is slower than sqrtss (and divss),
+// so there are no fast versions of Length, Distance or Normalize, the
+// only user is SoAStream::InverseLengthFast. the scalar InverseSqrt is
+// still the estimate, for the tails of the 4-wide loops.
+// below FLT_MIN (1.2e-38) 1 / length is 1, zero included, and above
+// FLT_MAX it is 0, like 1.0f / sqrtf( INFINITY ).
+struct FastMath {
+    /// Smallest squared length handled by the estimate.
+    static constexpr float Min = 1.17549435e-38f;
+    /// Largest squared length handled by the estimate.
+    static constexpr float Max = 3.40282347e+38f;
+
+    /// 1 / sqrt( x ) for Min <= x <= Max.
+    static inline
+    float InverseSqrt( float x ) {
+#if defined(RAYMATH_CPP_SSE2)
+        float y = _mm_cvtss_f32( _mm_rsqrt_ss( _mm_set_ss( x ) ) );
+        return y * ( 1.5f - ( 0.5f * x ) * y * y );
+#else
+        return 1.0f / sqrtf( x );
+#endif
+    }
+    /// 1 / length from the squared length, 1 below Min.
+    static inline
+    float InverseLength( float lengthSqr ) {
+        if( lengthSqr < Min ) {
+            return 1.0f;
+        }
+        return lengthSqr <= Max ? InverseSqrt( lengthSqr ) : 0.0f;
+    }
+#if defined(RAYMATH_CPP_SSE2)
+    static inline
+    __m128 InverseSqrt( __m128 x ) {
+        __m128 y = _mm_rsqrt_ps( x );
+        return _mm_mul_ps( y, _mm_sub_ps( _mm_set1_ps( 1.5f ),
+            _mm_mul_ps( _mm_mul_ps( _mm_mul_ps( _mm_set1_ps( 0.5f ), x ), y ), y ) ) );
+    }
+    /// Like Simd4::InverseLength, 1 below Min and 0 above Max.
+    static inline
+    __m128 InverseLength( __m128 lengthSqr ) {
+        __m128 inverse = _mm_and_ps( InverseSqrt( lengthSqr ),
+            _mm_cmple_ps( lengthSqr, _mm_set1_ps( Max ) ) );
+        return Simd4::Select( _mm_cmpge_ps( lengthSqr, _mm_set1_ps( Min ) ),
+            inverse, _mm_set1_ps( 1.0f ) );
+    }
+#endif
+};
+
+// NOTE(alicia): Indexes are positions in the parent vector,
+// the swizzle only spans the parent floats up to the highest index.
+template<int...Indexes>
+struct SwizzleSpan;
+template<int I>
+struct SwizzleSpan<I> {
+    static const int Value = I + 1;
+};
+template<int I, int...Rest>
+struct SwizzleSpan<I, Rest...> {
+    static const int Value =
+        I + 1 > SwizzleSpan<Rest...>::Value ? I + 1 : SwizzleSpan<Rest...>::Value;
+};
+template<int...Positions>
+struct SwizzleSequence {};
+template<int N, int...Positions>
+struct SwizzleMakeSequence : SwizzleMakeSequence<N - 1, N - 1, Positions...> {};
+template<int...Positions>
+struct SwizzleMakeSequence<0, Positions...> {
+    typedef SwizzleSequence<Positions...> Type;
+};
+
+// NOTE(alicia): reads and writes expand to one move per component,
+// no index table or loop, so they compile like hand written access.
+// 4 component swizzles of a 4 component vector are one shufps.
+// rhs is taken by value so p.yx = p doesn't read what it just wrote.
+// kept out of Swizzler so its 300+ instantiations stay small.
+struct SwizzleOps {
+    template<typename V, int...Indexes, int...Positions> static inline
+    void Assign(
+        float* v, const V rhs,
+        SwizzleSequence<Indexes...>, SwizzleSequence<Positions...>
+    ) {
+        int expand[] = { ( v[Indexes] = rhs[Positions], 0 )... };
+        (void)expand;
+    }
+    template<typename V, int N, int...Indexes> static inline
+    V Read( const float (&v)[N], SwizzleSequence<Indexes...> ) {
+        return V( v[Indexes]... );
+    }
+#if defined(RAYMATH_CPP_SSE2)
+    template<typename V, int A, int B, int C, int D> static inline
+    V Read( const float (&v)[4], SwizzleSequence<A, B, C, D> ) {
+        __m128 a = _mm_loadu_ps( v );
+        float result[4];
+        _mm_storeu_ps( result, _mm_shuffle_ps( a, a, _MM_SHUFFLE( D, C, B, A ) ) );
+        return V( result[0], result[1], result[2], result[3] );
+    }
+#endif
+};
+
+template<typename V, typename RLV, int...Indexes>
+class Swizzler {
+    float v[SwizzleSpan<Indexes...>::Value];
+public:
+    V& operator=( const V& rhs ) {
+        SwizzleOps::Assign( v, rhs,
+            SwizzleSequence<Indexes...>(),
+            typename SwizzleMakeSequence<sizeof...(Indexes)>::Type() );
+        return *(V*)this;
+    }
+    operator
+    V() const {
+        return SwizzleOps::Read<V>( v, SwizzleSequence<Indexes...>() );
+    }
+    operator
+    RLV() const {
+        return RLV{ v[Indexes]... };
+    }
+};
+
+struct Vec2 {
+    union {
+        float array[2];
+        struct { float x = 0.0f, y = 0.0f; };
+        Swizzler<Vec2, Vector2, 0, 0> xx;
+        Swizzler<Vec2, Vector2, 1, 1> yy;
+        Swizzler<Vec2, Vector2, 0, 1> xy;
+        Swizzler<Vec2, Vector2, 1, 0> yx;
+    };
+
+    RAYMATH_CPP_CONSTEXPR Vec2() {}
+    RAYMATH_CPP_CONSTEXPR Vec2( float x, float y ) : x(x), y(y) {}
+    RAYMATH_CPP_CONSTEXPR Vec2( const Vector2& v ) : Vec2( v.x, v.y ) {}
+
+    RAYMATH_CPP_CONSTEXPR inline
+    operator Vector2() const {
+        return Vector2{ x, y };
+    }
+    inline
+    float operator[]( size_t idx ) const {
+        return array[idx];
+    }
+    inline
+    float& operator[]( size_t idx ) {
+        return array[idx];
+    }
+
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2& operator+=( Vector2 v2 ) {
+        return *this = this->Add( v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2& operator-=( Vector2 v2 ) {
+        return *this = this->Subtract( v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2& operator*=( float value ) {
+        return *this = this->Scale( value );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2& operator/=( float value ) {
+        return *this = this->Scale( 1.0f / value );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2 operator-() const {
+        return this->Negate();
+    }
+
+    static RAYMATH_CPP_CONSTEXPR inline
+    Vec2 Zero() {
+        return Vector2Zero();
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Vec2 One() {
+        return Vector2One();
+    }
+
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2 Add( Vector2 v2 ) const {
+        return Vector2Add( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2 AddValue( float add ) const {
+        return Vector2AddValue( *this, add );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2 Subtract( Vector2 v2 ) const {
+        return Vector2Subtract( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2 SubtractValue( float sub ) const {
+        return Vector2SubtractValue( *this, sub );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float Length() const {
+        return Vector2Length( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float LengthSqr() const {
+        return Vector2LengthSqr( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float DotProduct( Vector2 v2 ) const {
+        return Vector2DotProduct( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float Distance( Vector2 v2 ) const {
+        return Vector2Distance( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float DistanceSqr( Vector2 v2 ) const {
+        return Vector2DistanceSqr( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float Angle( Vector2 v2 ) const {
+        return Vector2Angle( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2 Scale( float scale ) const {
+        return Vector2Scale( *this, scale );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2 Multiply( Vector2 v2 ) const {
+        return Vector2Multiply( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2 Negate() const {
+        return Vector2Negate( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2 Divide( Vector2 v2 ) const {
+        return Vector2Divide( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2 Normalize() const {
+        return Vector2Normalize( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2 Transform( const Matrix& mat ) const {
+        return Vector2Transform( *this, mat );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2 Lerp( Vector2 v2, float amount ) const {
+        return Vector2Lerp( *this, v2, amount );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2 Reflect( Vector2 normal ) const {
+        return Vector2Reflect( *this, normal );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2 Rotate( float angle ) const {
+        return Vector2Rotate( *this, angle );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2 MoveToward( Vector2 target, float maxDistance ) const {
+        return Vector2MoveTowards( *this, target, maxDistance );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2 Invert() const {
+        return Vector2Invert( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2 Clamp( Vector2 min, Vector2 max ) const {
+        return Vector2Clamp( *this, min, max );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec2 ClampValue( float min, float max ) const {
+        return Vector2ClampValue( *this, min, max );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    bool Equals( Vector2 q ) const {
+        return Vector2Equals( *this, q );
+    }
+};
+RAYMATH_CPP_CONSTEXPR inline
+Vec2 operator+( Vector2 v1, Vector2 v2 ) {
+    return Vector2Add( v1, v2 );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec2 operator-( Vector2 v1, Vector2 v2 ) {
+    return Vector2Subtract( v1, v2 );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec2 operator*( Vector2 v1, float scale ) {
+    return Vector2Scale( v1, scale );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec2 operator*( float scale, Vector2 v1 ) {
+    return Vector2Scale( v1, scale );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec2 operator/( Vector2 v1, float scale ) {
+    return Vector2Scale( v1, 1.0f / scale );
+}
+RAYMATH_CPP_CONSTEXPR inline
+bool operator==( Vector2 p, Vector2 q ) {
+    return Vector2Equals( p, q );
+}
+RAYMATH_CPP_CONSTEXPR inline
+bool operator!=( Vector2 p, Vector2 q ) {
+    return !( p == q );
+}
+RAYMATH_CPP_CONSTEXPR inline
+float Length( Vector2 v ) {
+    return Vector2Length( v );
+}
+RAYMATH_CPP_CONSTEXPR inline
+float LengthSqr( Vector2 v ) {
+    return Vector2LengthSqr( v );
+}
+RAYMATH_CPP_CONSTEXPR inline
+float DotProduct( Vector2 v1, Vector2 v2 ) {
+    return Vector2DotProduct( v1, v2 );
+}
+RAYMATH_CPP_CONSTEXPR inline
+float Distance( Vector2 v1, Vector2 v2 ) {
+    return Vector2Distance( v1, v2 );
+}
+RAYMATH_CPP_CONSTEXPR inline
+float DistanceSqr( Vector2 v1, Vector2 v2 ) {
+    return Vector2DistanceSqr( v1, v2 );
+}
+RAYMATH_CPP_CONSTEXPR inline
+float Angle( Vector2 v1, Vector2 v2 ) {
+    return Vector2Angle( v1, v2 );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec2 Normalize( Vector2 v ) {
+    return Vector2Normalize( v );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec2 Lerp( Vector2 v1, Vector2 v2, float amount ) {
+    return Vector2Lerp( v1, v2, amount );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec2 Reflect( Vector2 v, Vector2 normal ) {
+    return Vector2Reflect( v, normal );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec2 Rotate( Vector2 v, float angle ) {
+    return Vector2Rotate( v, angle );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec2 Clamp( Vector2 v, Vector2 min, Vector2 max ) {
+    return Vector2Clamp( v, min, max );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec2 Clamp( Vector2 v, float min, float max ) {
+    return Vector2ClampValue( v, min, max );
+}
+
+struct Vec3 {
+    union {
+        float array[3];
+        struct { float x = 0.0f, y = 0.0f, z = 0.0f; };
+
+        Swizzler<Vec2, Vector2, 0, 0> xx;
+        Swizzler<Vec2, Vector2, 1, 1> yy;
+        Swizzler<Vec2, Vector2, 0, 1> xy;
         Swizzler<Vec2, Vector2, 1, 0> yx;
 
-        Swizzler<Vec3, Vector3, 0, 1, 2> xyz;
-        Swizzler<Vec3, Vector3, 0, 2, 1> xzy;
-        Swizzler<Vec3, Vector3, 1, 2, 0> yzx;
-        Swizzler<Vec3, Vector3, 1, 0, 2> yxz;
-        Swizzler<Vec3, Vector3, 2, 0, 1> zxy;
-        Swizzler<Vec3, Vector3, 2, 1, 0> zyx;
-        Swizzler<Vec3, Vector3, 0, 0, 0> xxx;
-        Swizzler<Vec3, Vector3, 1, 0, 0> yxx;
-        Swizzler<Vec3, Vector3, 0, 1, 0> xyx;
-        Swizzler<Vec3, Vector3, 0, 0, 1> xxy;
-        Swizzler<Vec3, Vector3, 2, 0, 0> zxx;
-        Swizzler<Vec3, Vector3, 0, 2, 0> xzx;
-        Swizzler<Vec3, Vector3, 0, 0, 2> xxz;
-        Swizzler<Vec3, Vector3, 1, 1, 1> yyy;
-        Swizzler<Vec3, Vector3, 0, 1, 1> xyy;
-        Swizzler<Vec3, Vector3, 1, 0, 1> yxy;
-        Swizzler<Vec3, Vector3, 1, 1, 0> yyx;
-        Swizzler<Vec3, Vector3, 2, 1, 1> zyy;
-        Swizzler<Vec3, Vector3, 1, 2, 1> yzy;
-        Swizzler<Vec3, Vector3, 1, 1, 2> yyz;
-        Swizzler<Vec3, Vector3, 2, 2, 2> zzz;
-        Swizzler<Vec3, Vector3, 0, 2, 2> xzz;
-        Swizzler<Vec3, Vector3, 2, 0, 2> zxz;
-        Swizzler<Vec3, Vector3, 2, 2, 0> zzx;
-        Swizzler<Vec3, Vector3, 1, 2, 2> yzz;
-        Swizzler<Vec3, Vector3, 2, 1, 2> zyz;
-        Swizzler<Vec3, Vector3, 2, 2, 1> zzy;
-    };
+        Swizzler<Vec3, Vector3, 0, 1, 2> xyz;
+        Swizzler<Vec3, Vector3, 0, 2, 1> xzy;
+        Swizzler<Vec3, Vector3, 1, 2, 0> yzx;
+        Swizzler<Vec3, Vector3, 1, 0, 2> yxz;
+        Swizzler<Vec3, Vector3, 2, 0, 1> zxy;
+        Swizzler<Vec3, Vector3, 2, 1, 0> zyx;
+        Swizzler<Vec3, Vector3, 0, 0, 0> xxx;
+        Swizzler<Vec3, Vector3, 1, 0, 0> yxx;
+        Swizzler<Vec3, Vector3, 0, 1, 0> xyx;
+        Swizzler<Vec3, Vector3, 0, 0, 1> xxy;
+        Swizzler<Vec3, Vector3, 2, 0, 0> zxx;
+        Swizzler<Vec3, Vector3, 0, 2, 0> xzx;
+        Swizzler<Vec3, Vector3, 0, 0, 2> xxz;
+        Swizzler<Vec3, Vector3, 1, 1, 1> yyy;
+        Swizzler<Vec3, Vector3, 0, 1, 1> xyy;
+        Swizzler<Vec3, Vector3, 1, 0, 1> yxy;
+        Swizzler<Vec3, Vector3, 1, 1, 0> yyx;
+        Swizzler<Vec3, Vector3, 2, 1, 1> zyy;
+        Swizzler<Vec3, Vector3, 1, 2, 1> yzy;
+        Swizzler<Vec3, Vector3, 1, 1, 2> yyz;
+        Swizzler<Vec3, Vector3, 2, 2, 2> zzz;
+        Swizzler<Vec3, Vector3, 0, 2, 2> xzz;
+        Swizzler<Vec3, Vector3, 2, 0, 2> zxz;
+        Swizzler<Vec3, Vector3, 2, 2, 0> zzx;
+        Swizzler<Vec3, Vector3, 1, 2, 2> yzz;
+        Swizzler<Vec3, Vector3, 2, 1, 2> zyz;
+        Swizzler<Vec3, Vector3, 2, 2, 1> zzy;
+    };
+
+    RAYMATH_CPP_CONSTEXPR Vec3() {}
+    RAYMATH_CPP_CONSTEXPR Vec3( float x, float y, float z ) : x(x), y(y), z(z) {}
+    RAYMATH_CPP_CONSTEXPR Vec3( const Vector3& v ) : Vec3( v.x, v.y, v.z ) {}
+
+    RAYMATH_CPP_CONSTEXPR inline
+    operator Vector3() const {
+        return Vector3{ x, y, z };
+    }
+    inline
+    float operator[]( size_t idx ) const {
+        return array[idx];
+    }
+    inline
+    float& operator[]( size_t idx ) {
+        return array[idx];
+    }
+
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3& operator+=( Vec3 v2 ) {
+        return *this = this->Add( v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3& operator-=( Vec3 v2 ) {
+        return *this = this->Subtract( v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3& operator*=( float value ) {
+        return *this = this->Scale( value );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3& operator/=( float value ) {
+        return *this = this->Scale( 1.0f / value );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 operator-() const {
+        return this->Negate();
+    }
+
+    static RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Zero() {
+        return Vector3Zero();
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Vec3 One() {
+        return Vector3One();
+    }
+
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Add( Vector3 v2 ) const {
+        return Vector3Add( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 AddValue( float add ) const {
+        return Vector3AddValue( *this, add );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Subtract( Vector3 v2 ) const {
+        return Vector3Subtract( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 SubtractValue( float sub ) const {
+        return Vector3SubtractValue( *this, sub );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Scale( float scalar ) const {
+        return Vector3Scale( *this, scalar );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Multiply( Vector3 v2 ) const {
+        return Vector3Multiply( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 CrossProduct( Vector3 v2 ) const {
+        return Vector3CrossProduct( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Perpendicular() const {
+        return Vector3Perpendicular( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float Length() const {
+        return Vector3Length( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float LengthSqr() const {
+        return Vector3LengthSqr( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float DotProduct( Vector3 v2 ) const {
+        return Vector3DotProduct( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float Distance( Vector3 v2 ) const {
+        return Vector3Distance( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float DistanceSqr( Vector3 v2 ) const {
+        return Vector3DistanceSqr( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float Angle( Vector3 v2 ) const {
+        return Vector3Angle( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Negate() const {
+        return Vector3Negate( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Divide( Vector3 v2 ) const {
+        return Vector3Divide( *this, v2 );
+    }
+
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Normalize() const {
+        return Vector3Normalize( *this );
+    }
+    inline
+    void OrthoNormalize( Vector3 *v2 ) {
+        Vector3OrthoNormalize( (Vector3*)this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Transform( const Matrix& mat ) const {
+        return Vector3Transform( *this, mat );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Rotate( Quaternion q ) const {
+        return Vector3RotateByQuaternion( *this, q );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Rotate( Vector3 axis, float angle ) const {
+        return Vector3RotateByAxisAngle( *this, axis, angle );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 MoveTowards( Vector3 target, float maxDistance ) const {
+        return Vector3MoveTowards( *this, target, maxDistance );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Lerp( Vector3 v2, float amount ) const {
+        return Vector3Lerp( *this, v2, amount );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Reflect( Vector3 normal ) const {
+        return Vector3Reflect( *this, normal );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Min( Vector3 v2 ) const {
+        return Vector3Min( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Max( Vector3 v2 ) const {
+        return Vector3Max( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Barycenter( Vector3 a, Vector3 b, Vector3 c ) const {
+        return Vector3Barycenter( *this, a, b, c );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Unproject( const Matrix& projection, const Matrix& view ) const {
+        return Vector3Unproject( *this, projection, view );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float3 ToFloatV() const {
+        return Vector3ToFloatV( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Invert() const {
+        return Vector3Invert( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Clamp( Vector3 min, Vector3 max ) const {
+        return Vector3Clamp( *this, min, max );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 ClampValue( float min, float max ) const {
+        return Vector3ClampValue( *this, min, max );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    bool Equals( Vector3 q ) const {
+        return Vector3Equals( *this, q );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Refract( Vector3 n, float r ) const {
+        return Vector3Refract( *this, n, r );
+    }
+};
+RAYMATH_CPP_CONSTEXPR inline
+Vec3 operator+( Vector3 v1, Vector3 v2 ) {
+    return Vector3Add( v1, v2 );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec3 operator-( Vector3 v1, Vector3 v2 ) {
+    return Vector3Subtract( v1, v2 );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec3 operator*( Vector3 v1, float scale ) {
+    return Vector3Scale( v1, scale );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec3 operator*( float scale, Vector3 v1 ) {
+    return Vector3Scale( v1, scale );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec3 operator*( Vector3 lhs, const Matrix& rhs ) {
+    return Vector3Transform( lhs, rhs );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec3 operator/( Vector3 v1, float scale ) {
+    return Vector3Scale( v1, 1.0f / scale );
+}
+RAYMATH_CPP_CONSTEXPR inline
+bool operator==( Vector3 p, Vector3 q ) {
+    return Vector3Equals( p, q );
+}
+RAYMATH_CPP_CONSTEXPR inline
+bool operator!=( Vector3 p, Vector3 q ) {
+    return !( p == q );
+}
+RAYMATH_CPP_CONSTEXPR inline
+float Length( Vector3 v ) {
+    return Vector3Length( v );
+}
+RAYMATH_CPP_CONSTEXPR inline
+float LengthSqr( Vector3 v ) {
+    return Vector3LengthSqr( v );
+}
+RAYMATH_CPP_CONSTEXPR inline
+float DotProduct( Vector3 v1, Vector3 v2 ) {
+    return Vector3DotProduct( v1, v2 );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec3 CrossProduct( Vector3 v1, Vector3 v2 ) {
+    return Vector3CrossProduct( v1, v2 );
+}
+RAYMATH_CPP_CONSTEXPR inline
+float Distance( Vector3 v1, Vector3 v2 ) {
+    return Vector3Distance( v1, v2 );
+}
+RAYMATH_CPP_CONSTEXPR inline
+float DistanceSqr( Vector3 v1, Vector3 v2 ) {
+    return Vector3DistanceSqr( v1, v2 );
+}
+RAYMATH_CPP_CONSTEXPR inline
+float Angle( Vector3 v1, Vector3 v2 ) {
+    return Vector3Angle( v1, v2 );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec3 Normalize( Vector3 v ) {
+    return Vector3Normalize( v );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec3 MoveTowards( Vector3 v, Vector3 target, float maxDistance ) {
+    return Vector3MoveTowards( v, target, maxDistance );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec3 Lerp( Vector3 v1, Vector3 v2, float amount ) {
+    return Vector3Lerp( v1, v2, amount );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec3 Reflect( Vector3 v, Vector3 normal ) {
+    return Vector3Reflect( v, normal );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec3 Rotate( Vector3 v, Quaternion q ) {
+    return Vector3RotateByQuaternion( v, q );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec3 Rotate( Vector3 v, Vector3 axis, float angle ) {
+    return Vector3RotateByAxisAngle( v, axis, angle );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec3 Clamp( Vector3 v, Vector3 min, Vector3 max ) {
+    return Vector3Clamp( v, min, max );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec3 Clamp( Vector3 v, float min, float max ) {
+    return Vector3ClampValue( v, min, max );
+}
+
+struct Vec4 {
+    union {
+        float array[4];
+        struct { float x = 0.0f, y = 0.0f, z = 0.0f, w = 0.0f; };
+
+        // NOTE(alicia): all 16 + 64 + 256 swizzles, spelled out by
+        // the macros below (x = 0, y = 1, z = 2, w = 3).
+#define RAYMATH_CPP_SWIZZLE2( A, a, B, b )\
+        Swizzler<Vec2, Vector2, a, b> A##B;
+#define RAYMATH_CPP_SWIZZLE3( A, a, B, b, C, c )\
+        Swizzler<Vec3, Vector3, a, b, c> A##B##C;
+#define RAYMATH_CPP_SWIZZLE4( A, a, B, b, C, c, D, d )\
+        Swizzler<Vec4, Vector4, a, b, c, d> A##B##C##D;
+#define RAYMATH_CPP_SWIZZLE2_B( A, a )\
+        RAYMATH_CPP_SWIZZLE2( A, a, x, 0 ) RAYMATH_CPP_SWIZZLE2( A, a, y, 1 )\
+        RAYMATH_CPP_SWIZZLE2( A, a, z, 2 ) RAYMATH_CPP_SWIZZLE2( A, a, w, 3 )
+#define RAYMATH_CPP_SWIZZLE3_C( A, a, B, b )\
+        RAYMATH_CPP_SWIZZLE3( A, a, B, b, x, 0 ) RAYMATH_CPP_SWIZZLE3( A, a, B, b, y, 1 )\
+        RAYMATH_CPP_SWIZZLE3( A, a, B, b, z, 2 ) RAYMATH_CPP_SWIZZLE3( A, a, B, b, w, 3 )
+#define RAYMATH_CPP_SWIZZLE3_B( A, a )\
+        RAYMATH_CPP_SWIZZLE3_C( A, a, x, 0 ) RAYMATH_CPP_SWIZZLE3_C( A, a, y, 1 )\
+        RAYMATH_CPP_SWIZZLE3_C( A, a, z, 2 ) RAYMATH_CPP_SWIZZLE3_C( A, a, w, 3 )
+#define RAYMATH_CPP_SWIZZLE4_D( A, a, B, b, C, c )\
+        RAYMATH_CPP_SWIZZLE4( A, a, B, b, C, c, x, 0 ) RAYMATH_CPP_SWIZZLE4( A, a, B, b, C, c, y, 1 )\
+        RAYMATH_CPP_SWIZZLE4( A, a, B, b, C, c, z, 2 ) RAYMATH_CPP_SWIZZLE4( A, a, B, b, C, c, w, 3 )
+#define RAYMATH_CPP_SWIZZLE4_C( A, a, B, b )\
+        RAYMATH_CPP_SWIZZLE4_D( A, a, B, b, x, 0 ) RAYMATH_CPP_SWIZZLE4_D( A, a, B, b, y, 1 )\
+        RAYMATH_CPP_SWIZZLE4_D( A, a, B, b, z, 2 ) RAYMATH_CPP_SWIZZLE4_D( A, a, B, b, w, 3 )
+#define RAYMATH_CPP_SWIZZLE4_B( A, a )\
+        RAYMATH_CPP_SWIZZLE4_C( A, a, x, 0 ) RAYMATH_CPP_SWIZZLE4_C( A, a, y, 1 )\
+        RAYMATH_CPP_SWIZZLE4_C( A, a, z, 2 ) RAYMATH_CPP_SWIZZLE4_C( A, a, w, 3 )
+        RAYMATH_CPP_SWIZZLE2_B( x, 0 ) RAYMATH_CPP_SWIZZLE2_B( y, 1 )
+        RAYMATH_CPP_SWIZZLE2_B( z, 2 ) RAYMATH_CPP_SWIZZLE2_B( w, 3 )
+        RAYMATH_CPP_SWIZZLE3_B( x, 0 ) RAYMATH_CPP_SWIZZLE3_B( y, 1 )
+        RAYMATH_CPP_SWIZZLE3_B( z, 2 ) RAYMATH_CPP_SWIZZLE3_B( w, 3 )
+        RAYMATH_CPP_SWIZZLE4_B( x, 0 ) RAYMATH_CPP_SWIZZLE4_B( y, 1 )
+        RAYMATH_CPP_SWIZZLE4_B( z, 2 ) RAYMATH_CPP_SWIZZLE4_B( w, 3 )
+#undef RAYMATH_CPP_SWIZZLE4_B
+#undef RAYMATH_CPP_SWIZZLE4_C
+#undef RAYMATH_CPP_SWIZZLE4_D
+#undef RAYMATH_CPP_SWIZZLE3_B
+#undef RAYMATH_CPP_SWIZZLE3_C
+#undef RAYMATH_CPP_SWIZZLE2_B
+#undef RAYMATH_CPP_SWIZZLE4
+#undef RAYMATH_CPP_SWIZZLE3
+#undef RAYMATH_CPP_SWIZZLE2
+    };
+    RAYMATH_CPP_CONSTEXPR Vec4() {}
+    RAYMATH_CPP_CONSTEXPR Vec4( float x, float y, float z, float w ) : x(x), y(y), z(z), w(w) {}
+    RAYMATH_CPP_CONSTEXPR Vec4( const Vector4& v ) : Vec4( v.x, v.y, v.z, v.w ) {}
+
+    RAYMATH_CPP_CONSTEXPR inline
+    operator Vector4() const {
+        return Vector4{ x, y, z, w };
+    }
+    inline
+    float operator[]( size_t idx ) const {
+        return array[idx];
+    }
+    inline
+    float& operator[]( size_t idx ) {
+        return array[idx];
+    }
+
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec4& operator+=( Vec4 v2 ) {
+        return *this = this->Add( v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec4& operator-=( Vec4 v2 ) {
+        return *this = this->Subtract( v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec4& operator*=( float value ) {
+        return *this = this->Scale( value );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec4& operator/=( float value ) {
+        return *this = this->Scale( 1.0f / value );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec4 operator-() const {
+        return this->Negate();
+    }
+
+    static RAYMATH_CPP_CONSTEXPR inline
+    Vec4 Zero() {
+        return Vector4Zero();
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Vec4 One() {
+        return Vector4One();
+    }
+
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec4 Add( Vector4 v2 ) const {
+        return Vector4Add( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec4 AddValue( float add ) const {
+        return Vector4AddValue( *this, add );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec4 Subtract( Vector4 v2 ) const {
+        return Vector4Subtract( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec4 SubtractValue( float sub ) const {
+        return Vector4SubtractValue( *this, sub );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec4 Scale( float scalar ) const {
+        return Vector4Scale( *this, scalar );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec4 Multiply( Vector4 v2 ) const {
+        return Vector4Multiply( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float Length() const {
+        return Vector4Length( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float LengthSqr() const {
+        return Vector4LengthSqr( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float DotProduct( Vector4 v2 ) const {
+        return Vector4DotProduct( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float Distance( Vector4 v2 ) const {
+        return Vector4Distance( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float DistanceSqr( Vector4 v2 ) const {
+        return Vector4DistanceSqr( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec4 Negate() const {
+        return Vector4Negate( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec4 Divide( Vector4 v2 ) const {
+        return Vector4Divide( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec4 Normalize() const {
+        return Vector4Normalize( *this );
+    }
+    inline
+    void OrthoNormalize( Vector3 *v2 ) {
+        Vector3OrthoNormalize( (Vector3*)this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec4 MoveTowards( Vector4 target, float maxDistance ) const {
+        return Vector4MoveTowards( *this, target, maxDistance );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec4 Lerp( Vector4 v2, float amount ) const {
+        return Vector4Lerp( *this, v2, amount );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec4 Min( Vector4 v2 ) const {
+        return Vector4Min( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec4 Max( Vector4 v2 ) const {
+        return Vector4Max( *this, v2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec4 Invert() const {
+        return Vector4Invert( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    bool Equals( Vector4 q ) const {
+        return Vector4Equals( *this, q );
+    }
+};
+#if !defined(RAYMATH_CPP_EXPRESSIONS)
+// NOTE(alicia): these take Vec4 exactly so they would always win
+// over the expression operators.
+RAYMATH_CPP_CONSTEXPR inline
+Vec4 operator+( Vec4 v1, Vec4 v2 ) {
+    return Vector4Add( v1, v2 );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec4 operator-( Vec4 v1, Vec4 v2 ) {
+    return Vector4Subtract( v1, v2 );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec4 operator*( Vec4 v1, float scale ) {
+    return Vector4Scale( v1, scale );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec4 operator*( float scale, Vec4 v1 ) {
+    return Vector4Scale( v1, scale );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec4 operator/( Vec4 v1, float scale ) {
+    return Vector4Scale( v1, 1.0f / scale );
+}
+#endif
+RAYMATH_CPP_CONSTEXPR inline
+bool operator==( Vec4 p, Vec4 q ) {
+    return Vector4Equals( p, q );
+}
+RAYMATH_CPP_CONSTEXPR inline
+bool operator!=( Vec4 p, Vec4 q ) {
+    return !( p == q );
+}
+RAYMATH_CPP_CONSTEXPR inline
+float Length( Vector4 v ) {
+    return Vector4Length( v );
+}
+RAYMATH_CPP_CONSTEXPR inline
+float LengthSqr( Vector4 v ) {
+    return Vector4LengthSqr( v );
+}
+RAYMATH_CPP_CONSTEXPR inline
+float DotProduct( Vector4 v1, Vector4 v2 ) {
+    return Vector4DotProduct( v1, v2 );
+}
+RAYMATH_CPP_CONSTEXPR inline
+float Distance( Vector4 v1, Vector4 v2 ) {
+    return Vector4Distance( v1, v2 );
+}
+RAYMATH_CPP_CONSTEXPR inline
+float DistanceSqr( Vector4 v1, Vector4 v2 ) {
+    return Vector4DistanceSqr( v1, v2 );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec4 Normalize( Vector4 v ) {
+    return Vector4Normalize( v );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec4 MoveTowards( Vector4 v, Vector4 target, float maxDistance ) {
+    return Vector4MoveTowards( v, target, maxDistance );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec4 Lerp( Vector4 v1, Vector4 v2, float amount ) {
+    return Vector4Lerp( v1, v2, amount );
+}
+
+#if defined(RAYMATH_CPP_EXPRESSIONS)
+// NOTE(alicia): expression templates.
+// with RAYMATH_CPP_EXPRESSIONS defined, +, -, * and / on Vec3/Vec4
+// build a tree of plain floats instead of a Vec3/Vec4 per operator,
+// the whole chain is evaluated per component once it is converted
+// back to Vec3/Vec4/Vector3/Vector4 (or through Eval()).
+// a + b * s is fused into fmaf when FMA is enabled, otherwise
+// results are bit-identical to the eager operators.
+// raw Vector3 + Vector3 still uses the eager operators.
+template<int N>
+struct ExprLeaf {
+    float v[N];
+
+    template<int I> RAYMATH_CPP_CONSTEXPR inline
+    float Lane() const {
+        return v[I];
+    }
+};
+template<typename L, typename R>
+struct ExprAdd {
+    L l;
+    R r;
+
+    template<int I> RAYMATH_CPP_CONSTEXPR inline
+    float Lane() const;
+};
+template<typename L, typename R>
+struct ExprSubtract {
+    L l;
+    R r;
+
+    template<int I> RAYMATH_CPP_CONSTEXPR inline
+    float Lane() const;
+};
+template<typename E>
+struct ExprScale {
+    E     e;
+    float scale;
+
+    template<int I> RAYMATH_CPP_CONSTEXPR inline
+    float Lane() const {
+        return e.template Lane<I>() * scale;
+    }
+};
+template<typename E>
+struct ExprNegate {
+    E e;
+
+    template<int I> RAYMATH_CPP_CONSTEXPR inline
+    float Lane() const {
+        return -e.template Lane<I>();
+    }
+};
+
+struct ExprFused {
+    static RAYMATH_CPP_CONSTEXPR inline
+    float MultiplyAdd( float a, float b, float c ) {
+#if defined(RAYMATH_CPP_FMA)
+        return RAYMATH_CPP_CONSTANT_EVALUATED() ? a * b + c : fmaf( a, b, c );
+#else
+        return a * b + c;
+#endif
+    }
+
+    template<int I, typename L, typename R> static RAYMATH_CPP_CONSTEXPR inline
+    float Add( const L& l, const R& r ) {
+        return l.template Lane<I>() + r.template Lane<I>();
+    }
+    template<int I, typename L, typename R> static RAYMATH_CPP_CONSTEXPR inline
+    float Subtract( const L& l, const R& r ) {
+        return l.template Lane<I>() - r.template Lane<I>();
+    }
+#if defined(RAYMATH_CPP_FMA)
+    template<int I, typename A, typename R> static RAYMATH_CPP_CONSTEXPR inline
+    float Add( const ExprScale<A>& l, const R& r ) {
+        return MultiplyAdd( l.e.template Lane<I>(), l.scale, r.template Lane<I>() );
+    }
+    template<int I, typename L, typename B> static RAYMATH_CPP_CONSTEXPR inline
+    float Add( const L& l, const ExprScale<B>& r ) {
+        return MultiplyAdd( r.e.template Lane<I>(), r.scale, l.template Lane<I>() );
+    }
+    template<int I, typename A, typename B> static RAYMATH_CPP_CONSTEXPR inline
+    float Add( const ExprScale<A>& l, const ExprScale<B>& r ) {
+        return MultiplyAdd( l.e.template Lane<I>(), l.scale, r.template Lane<I>() );
+    }
+    template<int I, typename A, typename R> static RAYMATH_CPP_CONSTEXPR inline
+    float Subtract( const ExprScale<A>& l, const R& r ) {
+        return MultiplyAdd( l.e.template Lane<I>(), l.scale, -r.template Lane<I>() );
+    }
+    template<int I, typename L, typename B> static RAYMATH_CPP_CONSTEXPR inline
+    float Subtract( const L& l, const ExprScale<B>& r ) {
+        return MultiplyAdd( -r.e.template Lane<I>(), r.scale, l.template Lane<I>() );
+    }
+    template<int I, typename A, typename B> static RAYMATH_CPP_CONSTEXPR inline
+    float Subtract( const ExprScale<A>& l, const ExprScale<B>& r ) {
+        return MultiplyAdd( l.e.template Lane<I>(), l.scale, -r.template Lane<I>() );
+    }
+#endif
+};
+template<typename L, typename R>
+template<int I> RAYMATH_CPP_CONSTEXPR inline
+float ExprAdd<L, R>::Lane() const {
+    return ExprFused::Add<I>( l, r );
+}
+template<typename L, typename R>
+template<int I> RAYMATH_CPP_CONSTEXPR inline
+float ExprSubtract<L, R>::Lane() const {
+    return ExprFused::Subtract<I>( l, r );
+}
+
+template<typename V, typename E>
+struct VecExpr;
+
+template<typename E>
+struct VecExpr<Vec3, E> {
+    E e;
+
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Eval() const {
+        return Vec3( e.template Lane<0>(), e.template Lane<1>(), e.template Lane<2>() );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    operator Vec3() const {
+        return Eval();
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    operator Vector3() const {
+        return Vector3{ e.template Lane<0>(), e.template Lane<1>(), e.template Lane<2>() };
+    }
+};
+template<typename E>
+struct VecExpr<Vec4, E> {
+    E e;
+
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec4 Eval() const {
+        return Vec4(
+            e.template Lane<0>(), e.template Lane<1>(),
+            e.template Lane<2>(), e.template Lane<3>() );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    operator Vec4() const {
+        return Eval();
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    operator Vector4() const {
+        return Vector4{
+            e.template Lane<0>(), e.template Lane<1>(),
+            e.template Lane<2>(), e.template Lane<3>() };
+    }
+};
+
+// NOTE(alicia): what may start or join an expression.
+// anything without a specialization falls back to the eager operators.
+template<typename T>
+struct ExprTraits {};
+template<>
+struct ExprTraits<Vec3> {
+    typedef Vec3        Vec;
+    typedef ExprLeaf<3> Node;
+    static RAYMATH_CPP_CONSTEXPR inline
+    Node Get( const Vec3& v ) {
+        return Node{ { v.x, v.y, v.z } };
+    }
+};
+template<>
+struct ExprTraits<Vector3> {
+    typedef Vec3        Vec;
+    typedef ExprLeaf<3> Node;
+    static RAYMATH_CPP_CONSTEXPR inline
+    Node Get( const Vector3& v ) {
+        return Node{ { v.x, v.y, v.z } };
+    }
+};
+template<>
+struct ExprTraits<Vec4> {
+    typedef Vec4        Vec;
+    typedef ExprLeaf<4> Node;
+    static RAYMATH_CPP_CONSTEXPR inline
+    Node Get( const Vec4& v ) {
+        return Node{ { v.x, v.y, v.z, v.w } };
+    }
+};
+template<int...Indexes>
+struct ExprTraits< Swizzler<Vec3, Vector3, Indexes...> > {
+    typedef Vec3        Vec;
+    typedef ExprLeaf<3> Node;
+    static inline
+    Node Get( const Swizzler<Vec3, Vector3, Indexes...>& s ) {
+        Vector3 v = s;
+        return Node{ { v.x, v.y, v.z } };
+    }
+};
+template<int...Indexes>
+struct ExprTraits< Swizzler<Vec4, Vector4, Indexes...> > {
+    typedef Vec4        Vec;
+    typedef ExprLeaf<4> Node;
+    static inline
+    Node Get( const Swizzler<Vec4, Vector4, Indexes...>& s ) {
+        Vector4 v = s;
+        return Node{ { v.x, v.y, v.z, v.w } };
+    }
+};
+template<typename V, typename E>
+struct ExprTraits< VecExpr<V, E> > {
+    typedef V Vec;
+    typedef E Node;
+    static RAYMATH_CPP_CONSTEXPR inline
+    Node Get( const VecExpr<V, E>& v ) {
+        return v.e;
+    }
+};
+
+template<typename A, typename B>
+struct ExprJoin {};
+template<typename V>
+struct ExprJoin<V, V> {
+    typedef V Vec;
+};
+
+template<typename L, typename R> RAYMATH_CPP_CONSTEXPR inline
+VecExpr<
+    typename ExprJoin<typename ExprTraits<L>::Vec, typename ExprTraits<R>::Vec>::Vec,
+    ExprAdd<typename ExprTraits<L>::Node, typename ExprTraits<R>::Node>
+> operator+( const L& l, const R& r ) {
+    return { { ExprTraits<L>::Get( l ), ExprTraits<R>::Get( r ) } };
+}
+template<typename L, typename R> RAYMATH_CPP_CONSTEXPR inline
+VecExpr<
+    typename ExprJoin<typename ExprTraits<L>::Vec, typename ExprTraits<R>::Vec>::Vec,
+    ExprSubtract<typename ExprTraits<L>::Node, typename ExprTraits<R>::Node>
+> operator-( const L& l, const R& r ) {
+    return { { ExprTraits<L>::Get( l ), ExprTraits<R>::Get( r ) } };
+}
+template<typename L> RAYMATH_CPP_CONSTEXPR inline
+VecExpr<
+    typename ExprTraits<L>::Vec,
+    ExprScale<typename ExprTraits<L>::Node>
+> operator*( const L& l, float scale ) {
+    return { { ExprTraits<L>::Get( l ), scale } };
+}
+template<typename R> RAYMATH_CPP_CONSTEXPR inline
+VecExpr<
+    typename ExprTraits<R>::Vec,
+    ExprScale<typename ExprTraits<R>::Node>
+> operator*( float scale, const R& r ) {
+    return { { ExprTraits<R>::Get( r ), scale } };
+}
+template<typename L> RAYMATH_CPP_CONSTEXPR inline
+VecExpr<
+    typename ExprTraits<L>::Vec,
+    ExprScale<typename ExprTraits<L>::Node>
+> operator/( const L& l, float scale ) {
+    return { { ExprTraits<L>::Get( l ), 1.0f / scale } };
+}
+template<typename V, typename E> RAYMATH_CPP_CONSTEXPR inline
+VecExpr<V, ExprNegate<E>> operator-( const VecExpr<V, E>& v ) {
+    return { { v.e } };
+}
+// NOTE(alicia): a Vec4 expression converts to both Vec4 and Quaternion,
+// these keep == and != on the Vec4 overloads.
+template<typename E> RAYMATH_CPP_CONSTEXPR inline
+bool operator==( const VecExpr<Vec4, E>& p, Vec4 q ) {
+    return Vector4Equals( p.Eval(), q );
+}
+template<typename E> RAYMATH_CPP_CONSTEXPR inline
+bool operator==( Vec4 p, const VecExpr<Vec4, E>& q ) {
+    return Vector4Equals( p, q.Eval() );
+}
+template<typename E, typename F> RAYMATH_CPP_CONSTEXPR inline
+bool operator==( const VecExpr<Vec4, E>& p, const VecExpr<Vec4, F>& q ) {
+    return Vector4Equals( p.Eval(), q.Eval() );
+}
+template<typename E> RAYMATH_CPP_CONSTEXPR inline
+bool operator!=( const VecExpr<Vec4, E>& p, Vec4 q ) {
+    return !( p == q );
+}
+template<typename E> RAYMATH_CPP_CONSTEXPR inline
+bool operator!=( Vec4 p, const VecExpr<Vec4, E>& q ) {
+    return !( p == q );
+}
+template<typename E, typename F> RAYMATH_CPP_CONSTEXPR inline
+bool operator!=( const VecExpr<Vec4, E>& p, const VecExpr<Vec4, F>& q ) {
+    return !( p == q );
+}
+#endif
+
+RAYMATH_CPP_CONSTEXPR inline
+void Mat4MultiplyScalar( const Matrix& left, const Matrix& right, Matrix* out ) {
+    Matrix result = {};
+
+    // NOTE(alicia): copied from raymath.h
+    // this is to avoid making a copy of left and right matrices.
+    result.m0 = left.m0*right.m0 + left.m1*right.m4 + left.m2*right.m8 + left.m3*right.m12;
+    result.m1 = left.m0*right.m1 + left.m1*right.m5 + left.m2*right.m9 + left.m3*right.m13;
+    result.m2 = left.m0*right.m2 + left.m1*right.m6 + left.m2*right.m10 + left.m3*right.m14;
+    result.m3 = left.m0*right.m3 + left.m1*right.m7 + left.m2*right.m11 + left.m3*right.m15;
+    result.m4 = left.m4*right.m0 + left.m5*right.m4 + left.m6*right.m8 + left.m7*right.m12;
+    result.m5 = left.m4*right.m1 + left.m5*right.m5 + left.m6*right.m9 + left.m7*right.m13;
+    result.m6 = left.m4*right.m2 + left.m5*right.m6 + left.m6*right.m10 + left.m7*right.m14;
+    result.m7 = left.m4*right.m3 + left.m5*right.m7 + left.m6*right.m11 + left.m7*right.m15;
+    result.m8 = left.m8*right.m0 + left.m9*right.m4 + left.m10*right.m8 + left.m11*right.m12;
+    result.m9 = left.m8*right.m1 + left.m9*right.m5 + left.m10*right.m9 + left.m11*right.m13;
+    result.m10 = left.m8*right.m2 + left.m9*right.m6 + left.m10*right.m10 + left.m11*right.m14;
+    result.m11 = left.m8*right.m3 + left.m9*right.m7 + left.m10*right.m11 + left.m11*right.m15;
+    result.m12 = left.m12*right.m0 + left.m13*right.m4 + left.m14*right.m8 + left.m15*right.m12;
+    result.m13 = left.m12*right.m1 + left.m13*right.m5 + left.m14*right.m9 + left.m15*right.m13;
+    result.m14 = left.m12*right.m2 + left.m13*right.m6 + left.m14*right.m10 + left.m15*right.m14;
+    result.m15 = left.m12*right.m3 + left.m13*right.m7 + left.m14*right.m11 + left.m15*right.m15;
+
+    *out = result;
+}
+
+// NOTE(alicia): Matrix is stored so that every 4 floats are one row
+// ( m0, m4, m8, m12 ), so a product row is the rows of left scaled by
+// one row of right. terms are summed in the same order as the scalar
+// path so results are bit-identical unless FMA is enabled, which skips
+// the intermediate roundings (error stays within a few ulp of
+// the largest term).
+#if defined(RAYMATH_CPP_SSE2) || defined(RAYMATH_CPP_DISPATCH)
+RAYMATH_CPP_TARGET("sse2") inline
+__m128 Mat4MultiplyRowSSE2(
+    __m128 row, __m128 l0, __m128 l1, __m128 l2, __m128 l3
+) {
+    __m128 result = _mm_mul_ps( _mm_shuffle_ps( row, row, 0x00 ), l0 );
+    result = _mm_add_ps( result, _mm_mul_ps( _mm_shuffle_ps( row, row, 0x55 ), l1 ) );
+    result = _mm_add_ps( result, _mm_mul_ps( _mm_shuffle_ps( row, row, 0xAA ), l2 ) );
+    result = _mm_add_ps( result, _mm_mul_ps( _mm_shuffle_ps( row, row, 0xFF ), l3 ) );
+    return result;
+}
+RAYMATH_CPP_TARGET("sse2") inline
+void Mat4MultiplySSE2( const Matrix& left, const Matrix& right, Matrix* out ) {
+    const float* l = &left.m0;
+    const float* r = &right.m0;
+
+    __m128 l0 = _mm_loadu_ps( l + 0 );
+    __m128 l1 = _mm_loadu_ps( l + 4 );
+    __m128 l2 = _mm_loadu_ps( l + 8 );
+    __m128 l3 = _mm_loadu_ps( l + 12 );
+
+    __m128 o0 = Mat4MultiplyRowSSE2( _mm_loadu_ps( r + 0 ),  l0, l1, l2, l3 );
+    __m128 o1 = Mat4MultiplyRowSSE2( _mm_loadu_ps( r + 4 ),  l0, l1, l2, l3 );
+    __m128 o2 = Mat4MultiplyRowSSE2( _mm_loadu_ps( r + 8 ),  l0, l1, l2, l3 );
+    __m128 o3 = Mat4MultiplyRowSSE2( _mm_loadu_ps( r + 12 ), l0, l1, l2, l3 );
+
+    float* o = &out->m0;
+    _mm_storeu_ps( o + 0,  o0 );
+    _mm_storeu_ps( o + 4,  o1 );
+    _mm_storeu_ps( o + 8,  o2 );
+    _mm_storeu_ps( o + 12, o3 );
+}
+#endif
+#if defined(RAYMATH_CPP_AVX) || defined(RAYMATH_CPP_DISPATCH)
+// NOTE(alicia): two result rows per register, each 128-bit lane
+// broadcasts from its own row of right.
+#if defined(RAYMATH_CPP_DISPATCH)
+    #define RAYMATH_CPP_MAT4_AVX_TARGET "avx,fma"
+#else
+    #define RAYMATH_CPP_MAT4_AVX_TARGET "avx"
+#endif
+RAYMATH_CPP_TARGET(RAYMATH_CPP_MAT4_AVX_TARGET) inline
+void Mat4MultiplyAVX( const Matrix& left, const Matrix& right, Matrix* out ) {
+    const float* l = &left.m0;
+    const float* r = &right.m0;
+
+    __m256 l0 = _mm256_broadcast_ps( (const __m128*)( l + 0 ) );
+    __m256 l1 = _mm256_broadcast_ps( (const __m128*)( l + 4 ) );
+    __m256 l2 = _mm256_broadcast_ps( (const __m128*)( l + 8 ) );
+    __m256 l3 = _mm256_broadcast_ps( (const __m128*)( l + 12 ) );
+
+    __m256 r01 = _mm256_loadu_ps( r + 0 );
+    __m256 r23 = _mm256_loadu_ps( r + 8 );
+
+#if defined(RAYMATH_CPP_FMA) || defined(RAYMATH_CPP_DISPATCH) && !defined(RAYMATH_CPP_NO_FMA)
+    #define RAYMATH_CPP_MAT4_AVX_MADD( a, b, c ) _mm256_fmadd_ps( a, b, c )
+#else
+    #define RAYMATH_CPP_MAT4_AVX_MADD( a, b, c ) _mm256_add_ps( _mm256_mul_ps( a, b ), c )
+#endif
+    __m256 o01 = _mm256_mul_ps( _mm256_shuffle_ps( r01, r01, 0x00 ), l0 );
+    __m256 o23 = _mm256_mul_ps( _mm256_shuffle_ps( r23, r23, 0x00 ), l0 );
+    o01 = RAYMATH_CPP_MAT4_AVX_MADD( _mm256_shuffle_ps( r01, r01, 0x55 ), l1, o01 );
+    o23 = RAYMATH_CPP_MAT4_AVX_MADD( _mm256_shuffle_ps( r23, r23, 0x55 ), l1, o23 );
+    o01 = RAYMATH_CPP_MAT4_AVX_MADD( _mm256_shuffle_ps( r01, r01, 0xAA ), l2, o01 );
+    o23 = RAYMATH_CPP_MAT4_AVX_MADD( _mm256_shuffle_ps( r23, r23, 0xAA ), l2, o23 );
+    o01 = RAYMATH_CPP_MAT4_AVX_MADD( _mm256_shuffle_ps( r01, r01, 0xFF ), l3, o01 );
+    o23 = RAYMATH_CPP_MAT4_AVX_MADD( _mm256_shuffle_ps( r23, r23, 0xFF ), l3, o23 );
+#undef RAYMATH_CPP_MAT4_AVX_MADD
+
+    float* o = &out->m0;
+    _mm256_storeu_ps( o + 0, o01 );
+    _mm256_storeu_ps( o + 8, o23 );
+}
+#undef RAYMATH_CPP_MAT4_AVX_TARGET
+#endif
+
+#if defined(RAYMATH_CPP_DISPATCH)
+typedef void (*Mat4MultiplyFn)( const Matrix& left, const Matrix& right, Matrix* out );
+inline
+Mat4MultiplyFn Mat4MultiplySelect() {
+    __builtin_cpu_init();
+    if( __builtin_cpu_supports( "avx" ) && __builtin_cpu_supports( "fma" ) ) {
+        return Mat4MultiplyAVX;
+    }
+    if( __builtin_cpu_supports( "sse2" ) ) {
+        return Mat4MultiplySSE2;
+    }
+    return Mat4MultiplyScalar;
+}
+
+inline
+void Mat4MultiplyDispatch( const Matrix& left, const Matrix& right, Matrix* out ) {
+    static const Mat4MultiplyFn kernel = Mat4MultiplySelect();
+    kernel( left, right, out );
+}
+#endif
+
+RAYMATH_CPP_CONSTEXPR inline
+void Mat4MultiplyKernel( const Matrix& left, const Matrix& right, Matrix* out ) {
+    if( RAYMATH_CPP_CONSTANT_EVALUATED() ) {
+        Mat4MultiplyScalar( left, right, out );
+        return;
+    }
+#if defined(RAYMATH_CPP_DISPATCH)
+    Mat4MultiplyDispatch( left, right, out );
+#elif defined(RAYMATH_CPP_AVX)
+    Mat4MultiplyAVX( left, right, out );
+#elif defined(RAYMATH_CPP_SSE2)
+    // NOTE(alicia): SSE4.1 has nothing faster than
+    // shuffle+mul+add for this (dpps is slower), so it shares this path.
+    Mat4MultiplySSE2( left, right, out );
+#else
+    Mat4MultiplyScalar( left, right, out );
+#endif
+}
+
+struct Mat4 {
+    union {
+        float  array[16];
+        Matrix m;
+        struct {
+            float m0 = 0.0f, m4 = 0.0f,  m8 = 0.0f, m12 = 0.0f; 
+            float m1 = 0.0f, m5 = 0.0f,  m9 = 0.0f, m13 = 0.0f; 
+            float m2 = 0.0f, m6 = 0.0f, m10 = 0.0f, m14 = 0.0f;
+            float m3 = 0.0f, m7 = 0.0f, m11 = 0.0f, m15 = 0.0f;
+        };
+    };
+
+#if defined(RAYMATH_CPP_NATIVE)
+    // NOTE(alicia): m is always the active member in native mode
+    // so the Matrix conversions are usable in constant expressions.
+    constexpr Mat4() : m{} {}
+    constexpr Mat4(
+        float m0, float m4, float  m8, float m12, 
+        float m1, float m5, float  m9, float m13, 
+        float m2, float m6, float m10, float m14,
+        float m3, float m7, float m11, float m15
+    ) :
+        m{
+            m0, m4,  m8, m12,
+            m1, m5,  m9, m13,
+            m2, m6, m10, m14,
+            m3, m7, m11, m15 }
+    {}
+    constexpr Mat4( const Matrix& mat ) : m( mat ) {}
+
+    constexpr inline
+    operator const Matrix&() const {
+        return m;
+    }
+    constexpr inline
+    operator Matrix&() {
+        return m;
+    }
+#else
+    Mat4() {}
+    Mat4(
+        float m0, float m4, float  m8, float m12, 
+        float m1, float m5, float  m9, float m13, 
+        float m2, float m6, float m10, float m14,
+        float m3, float m7, float m11, float m15
+    ) :
+        m0(m0), m4(m4),   m8(m8), m12(m12), 
+        m1(m1), m5(m5),   m9(m9), m13(m13), 
+        m2(m2), m6(m6), m10(m10), m14(m14),
+        m3(m3), m7(m7), m11(m11), m15(m15)
+    {}
+    // NOTE(alicia): copied member by member so the compiler can build
+    // a returned Matrix straight into the Mat4. copying it whole
+    // reloads the raymath.h result with wide loads right after its
+    // narrow stores, which cost ~20ns per Mat4::Translate.
+    Mat4( const Matrix& mat ) :
+        Mat4(
+            mat.m0, mat.m4,  mat.m8, mat.m12,
+            mat.m1, mat.m5,  mat.m9, mat.m13,
+            mat.m2, mat.m6, mat.m10, mat.m14,
+            mat.m3, mat.m7, mat.m11, mat.m15 )
+    {}
+
+    inline
+    operator const Matrix&() const {
+        return *(Matrix*)this;
+    }
+    inline
+    operator Matrix&() {
+        return *(Matrix*)this;
+    }
+#endif
+    inline
+    float operator[]( size_t idx ) const {
+        return array[idx];
+    }
+    inline
+    float& operator[]( size_t idx ) {
+        return array[idx];
+    }
+
+
+    static RAYMATH_CPP_CONSTEXPR inline
+    Mat4 Identity() {
+        return MatrixIdentity();
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Mat4 Translate( float x, float y, float z ) {
+        return MatrixTranslate( x, y, z );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Mat4 Translate( Vector3 translate ) {
+        return MatrixTranslate( translate.x, translate.y, translate.z );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Mat4 Rotate( Vector3 axis, float angle ) {
+        return MatrixRotate( axis, angle );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Mat4 RotateX( float angle ) {
+        return MatrixRotateX( angle );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Mat4 RotateY( float angle ) {
+        return MatrixRotateY( angle );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Mat4 RotateZ( float angle ) {
+        return MatrixRotateZ( angle );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Mat4 RotateXYZ( Vector3 angle ) {
+        return MatrixRotateXYZ( angle );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Mat4 RotateZYX( Vector3 angle ) {
+        return MatrixRotateZYX( angle );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Mat4 Scale( float x, float y, float z ) {
+        return MatrixScale( x, y, z );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Mat4 Scale( Vector3 scale ) {
+        return MatrixScale( scale.x, scale.y, scale.z );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Mat4 Frustum(
+        double left, double right,
+        double bottom, double top,
+        double nearPlane, double farPlane
+    ) {
+        return MatrixFrustum(
+            left, right,
+            bottom, top,
+            nearPlane, farPlane );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Mat4 Perspective( double fovY, double aspect, double nearPlane, double farPlane ) {
+        return MatrixPerspective( fovY, aspect, nearPlane, farPlane );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Mat4 Ortho(
+        double left, double right,
+        double bottom, double top,
+        double nearPlane, double farPlane
+    ) {
+        return MatrixOrtho(
+            left, right,
+            bottom, top,
+            nearPlane, farPlane );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Mat4 LookAt( Vector3 eye, Vector3 target, Vector3 up ) {
+        return MatrixLookAt( eye, target, up );
+    }
+    /// See ComposeMatrix.
+    static RAYMATH_CPP_CONSTEXPR inline
+    Mat4 Compose( Vector3 translation, Quaternion rotation, Vector3 scale );
+
+    RAYMATH_CPP_CONSTEXPR inline
+    float Determinant() const {
+        return MatrixDeterminant( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float Trace() const {
+        return MatrixTrace( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Mat4 Transpose() const {
+        return MatrixTranspose( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Mat4 Invert() const {
+        return MatrixInvert( *this );
+    }
+    /// See DecomposeMatrix.
+    inline
+    void Decompose( Vector3* translation, Quaternion* rotation, Vector3* scale ) const;
+    RAYMATH_CPP_CONSTEXPR inline
+    Mat4 Add( const Matrix& right ) const {
+        return MatrixAdd( *this, right );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Mat4 Subtract( const Matrix& right ) const {
+        return MatrixSubtract( *this, right );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Mat4 Multiply( const Matrix& right ) const {
+        Matrix result = {};
+        Mat4MultiplyKernel( *this, right, &result );
+        return result;
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float16 ToFloatV() const {
+        return MatrixToFloatV( *this );
+    }
+};
+RAYMATH_CPP_CONSTEXPR inline
+Mat4 operator+( const Matrix& left, const Matrix& right ) {
+    return MatrixAdd( left, right );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Mat4 operator-( const Matrix& left, const Matrix& right ) {
+    return MatrixSubtract( left, right );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Mat4 operator*( const Matrix& left, const Matrix& right ) {
+    Matrix result = {};
+    Mat4MultiplyKernel( left, right, &result );
+    return result;
+}
+
+struct Quat {
+    union {
+        float array[4];
+        struct { float x = 0.0f, y = 0.0f, z = 0.0f, w = 0.0f; };
+    };
+
+    RAYMATH_CPP_CONSTEXPR Quat() {}
+    RAYMATH_CPP_CONSTEXPR Quat( float x, float y, float z, float w ) : x(x), y(y), z(z), w(w) {}
+    explicit RAYMATH_CPP_CONSTEXPR Quat( float pitch, float yaw, float roll ) : Quat( FromEuler(pitch, yaw, roll)) {}
+    explicit RAYMATH_CPP_CONSTEXPR Quat( Vector3 from, Vector3 to ) : Quat( FromVector3ToVector3( from, to ) ) {}
+    explicit RAYMATH_CPP_CONSTEXPR Quat( Vector3 axis, float angle ) : Quat( FromAxisAngle( axis, angle ) ) {}
+    explicit RAYMATH_CPP_CONSTEXPR Quat( const Matrix& mat ) : Quat( FromMatrix( mat ) ) {}
+    RAYMATH_CPP_CONSTEXPR Quat( const Quaternion& q ) : Quat( q.x, q.y, q.z, q.w ) {}
+
+    static RAYMATH_CPP_CONSTEXPR inline
+    Quat Identity() {
+        return QuaternionIdentity();
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Quat FromVector3ToVector3( Vector3 from, Vector3 to ) {
+        return QuaternionFromVector3ToVector3( from, to );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Quat FromMatrix( const Matrix& mat ) {
+        return QuaternionFromMatrix( mat );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Quat FromAxisAngle( Vector3 axis, float angle ) {
+        return QuaternionFromAxisAngle( axis, angle );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Quat FromEuler( float pitch, float yaw, float roll ) {
+        return QuaternionFromEuler( pitch, yaw, roll );
+    }
+
+    RAYMATH_CPP_CONSTEXPR inline
+    operator Quaternion() const {
+        return Quaternion{ x, y, z, w };
+    }
+    inline
+    float operator[]( size_t idx ) const {
+        return array[idx];
+    }
+    inline
+    float& operator[]( size_t idx ) {
+        return array[idx];
+    }
+
+    RAYMATH_CPP_CONSTEXPR inline
+    Quat Add( Quaternion q2 ) const {
+        return QuaternionAdd( *this, q2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Quat AddValue( float add ) const {
+        return QuaternionAddValue( *this, add );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Quat Subtract( Quaternion q2 ) const {
+        return QuaternionSubtract( *this, q2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Quat SubtractValue( float add ) const {
+        return QuaternionSubtractValue( *this, add );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float Length() const {
+        return QuaternionLength( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Quat Normalize() const {
+        return QuaternionNormalize( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Quat Invert() const {
+        return QuaternionInvert( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Quat Multiply( Quaternion q2 ) const {
+        return QuaternionMultiply( *this, q2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Quat Scale( float mul ) const {
+        return QuaternionScale( *this, mul );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Quat Divide( Quaternion q2 ) const {
+        return QuaternionDivide( *this, q2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Quat Lerp( Quaternion q2, float amount ) const {
+        return QuaternionLerp( *this, q2, amount );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Quat Nlerp( Quaternion q2, float amount ) const {
+        return QuaternionNlerp( *this, q2, amount );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Quat Slerp( Quaternion q2, float amount ) const {
+        return QuaternionSlerp( *this, q2, amount );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Mat4 ToMatrix() const {
+        return QuaternionToMatrix( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    void ToAxisAngle( Vector3* outAxis, float* outAngle ) const {
+        QuaternionToAxisAngle( *this, outAxis, outAngle );
+    }
+    inline
+    void ToAxisAngle( Vec3* outAxis, float* outAngle ) const {
+        QuaternionToAxisAngle( *this, (Vector3*)outAxis, outAngle );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 ToEuler() const {
+        return QuaternionToEuler( *this );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Quat Transform( const Matrix& mat ) const {
+        return QuaternionTransform( *this, mat );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    bool Equals( Quaternion q ) const {
+        return QuaternionEquals( *this, q );
+    }
+};
+RAYMATH_CPP_CONSTEXPR inline
+Quat operator+( Quaternion v1, Quaternion v2 ) {
+    return QuaternionAdd( v1, v2 );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Quat operator-( Quaternion v1, Quaternion v2 ) {
+    return QuaternionSubtract( v1, v2 );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Quat operator*( Quaternion v1, float scale ) {
+    return QuaternionScale( v1, scale );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Quat operator*( float scale, Quaternion v1 ) {
+    return QuaternionScale( v1, scale );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Quat operator*( Quaternion lhs, const Matrix& rhs ) {
+    return QuaternionTransform( lhs, rhs );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Quat operator/( Quaternion v1, float scale ) {
+    return QuaternionScale( v1, 1.0f / scale );
+}
+RAYMATH_CPP_CONSTEXPR inline
+bool operator==( Quaternion p, Quaternion q ) {
+    return QuaternionEquals( p, q );
+}
+RAYMATH_CPP_CONSTEXPR inline
+bool operator!=( Quaternion p, Quaternion q ) {
+    return !( p == q );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Quat Nlerp( Quaternion q1, Quaternion q2, float amount ) {
+    return QuaternionNlerp( q1, q2, amount );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Quat Slerp( Quaternion q1, Quaternion q2, float amount ) {
+    return QuaternionSlerp( q1, q2, amount );
+}
+// NOTE(alicia):
+// Lerp, Normalize,
+// Length and LengthSqr already implemented from Vector4
+
+// NOTE(alicia): the wrappers only stay free if they are the C types
+// in disguise: same size and alignment, and copied with a plain memcpy
+// so passing them to raymath by value costs nothing extra.
+static_assert( sizeof(Mat4) == sizeof(Matrix),     "Mat4 must alias Matrix" );
+static_assert( sizeof(Quat) == sizeof(Quaternion), "Quat must alias Quaternion" );
+static_assert( alignof(Vec2) == alignof(Vector2),    "Vec2 must align like Vector2" );
+static_assert( alignof(Vec3) == alignof(Vector3),    "Vec3 must align like Vector3" );
+static_assert( alignof(Vec4) == alignof(Vector4),    "Vec4 must align like Vector4" );
+static_assert( alignof(Mat4) == alignof(Matrix),     "Mat4 must align like Matrix" );
+static_assert( alignof(Quat) == alignof(Quaternion), "Quat must align like Quaternion" );
+#if !defined(RAYMATH_CPP_NO_STDLIB)
+static_assert( std::is_trivially_copyable<Vec2>::value, "Vec2 must be trivially copyable" );
+static_assert( std::is_trivially_copyable<Vec3>::value, "Vec3 must be trivially copyable" );
+static_assert( std::is_trivially_copyable<Vec4>::value, "Vec4 must be trivially copyable" );
+static_assert( std::is_trivially_copyable<Mat4>::value, "Mat4 must be trivially copyable" );
+static_assert( std::is_trivially_copyable<Quat>::value, "Quat must be trivially copyable" );
+static_assert( std::is_trivially_destructible<Vec3>::value, "Vec3 must be trivially destructible" );
+static_assert( std::is_trivially_destructible<Mat4>::value, "Mat4 must be trivially destructible" );
+#endif
+
+// NOTE(alicia): same terms as Vector3RotateByQuaternion,
+// folded into a 3x3 once so bulk rotations skip the per vector
+// quaternion math.
+RAYMATH_CPP_CONSTEXPR inline
+Matrix RotationMatrix( Quaternion q ) {
+    Matrix r = {};
+    r.m0  = q.x*q.x + q.w*q.w - q.y*q.y - q.z*q.z;
+    r.m4  = 2*q.x*q.y - 2*q.w*q.z;
+    r.m8  = 2*q.x*q.z + 2*q.w*q.y;
+    r.m1  = 2*q.w*q.z + 2*q.x*q.y;
+    r.m5  = q.w*q.w - q.x*q.x + q.y*q.y - q.z*q.z;
+    r.m9  = -2*q.w*q.x + 2*q.y*q.z;
+    r.m2  = -2*q.w*q.y + 2*q.x*q.z;
+    r.m6  = 2*q.w*q.x + 2*q.y*q.z;
+    r.m10 = q.w*q.w - q.x*q.x - q.y*q.y + q.z*q.z;
+    r.m15 = 1.0f;
+    return r;
+}
+/// Scale, then rotation, then translation, without building the three
+/// matrices. rotation is expected to be normalized.
+RAYMATH_CPP_CONSTEXPR inline
+Matrix ComposeMatrix( Vector3 translation, Quaternion rotation, Vector3 scale ) {
+    Matrix r = RotationMatrix( rotation );
+    r.m0 *= scale.x; r.m4 *= scale.y;  r.m8 *= scale.z;
+    r.m1 *= scale.x; r.m5 *= scale.y;  r.m9 *= scale.z;
+    r.m2 *= scale.x; r.m6 *= scale.y; r.m10 *= scale.z;
+    r.m12 = translation.x;
+    r.m13 = translation.y;
+    r.m14 = translation.z;
+    return r;
+}
+/// Translation, rotation and scale back out of an affine matrix,
+/// ComposeMatrix gives the matrix back. a mirroring matrix gets a
+/// negative x scale. an axis of length 0 is rebuilt from the other two,
+/// with one axis left the rotation turns the matching unit axis onto it.
+/// the rotation is always normalized, shear can't be represented
+/// and ends up in the rotation.
+inline
+void DecomposeMatrix( const Matrix& mat, Vector3* translation, Quaternion* rotation, Vector3* scale ) {
+    float lengthSqrX = mat.m0*mat.m0 + mat.m1*mat.m1 + mat.m2*mat.m2;
+    float lengthSqrY = mat.m4*mat.m4 + mat.m5*mat.m5 + mat.m6*mat.m6;
+    float lengthSqrZ = mat.m8*mat.m8 + mat.m9*mat.m9 + mat.m10*mat.m10;
+    Vector3 s = { sqrtf( lengthSqrX ), sqrtf( lengthSqrY ), sqrtf( lengthSqrZ ) };
+    float det = mat.m0*( mat.m5*mat.m10 - mat.m9*mat.m6 ) -
+        mat.m4*( mat.m1*mat.m10 - mat.m9*mat.m2 ) + mat.m8*( mat.m1*mat.m6 - mat.m5*mat.m2 );
+    if( det < 0.0f ) {
+        s.x = -s.x;
+    }
+    *translation = Vector3{ mat.m12, mat.m13, mat.m14 };
+    *scale = s;
+
+    // NOTE(alicia): rotation columns, then QuaternionFromMatrix.
+    Vector3 x = { mat.m0, mat.m1, mat.m2 };
+    Vector3 y = { mat.m4, mat.m5, mat.m6 };
+    Vector3 z = { mat.m8, mat.m9, mat.m10 };
+    bool hasX = lengthSqrX >= FastMath::Min;
+    bool hasY = lengthSqrY >= FastMath::Min;
+    bool hasZ = lengthSqrZ >= FastMath::Min;
+    if( hasX + hasY + hasZ < 2 ) {
+        // NOTE(alicia): the shortest rotation onto the axis that is left,
+        // flipping its scale instead of turning further than 90 degrees.
+        *rotation = QuaternionIdentity();
+        if( hasX || hasY || hasZ ) {
+            float* length = hasX ? &scale->x : hasY ? &scale->y : &scale->z;
+            Vector3 unit = { hasX ? 1.0f : 0.0f, hasY ? 1.0f : 0.0f, hasZ ? 1.0f : 0.0f };
+            Vector3 axis = Vector3Scale( hasX ? x : hasY ? y : z, 1.0f/ *length );
+            if( Vector3DotProduct( axis, unit ) < 0.0f ) {
+                axis = Vector3Negate( axis );
+                *length = -*length;
+            }
+            *rotation = QuaternionFromVector3ToVector3( unit, axis );
+        }
+        return;
+    }
+    if( hasX ) {
+        x = Vector3Scale( x, 1.0f/s.x );
+    }
+    if( hasY ) {
+        y = Vector3Scale( y, 1.0f/s.y );
+    }
+    if( hasZ ) {
+        z = Vector3Scale( z, 1.0f/s.z );
+    }
+    if( !hasX ) {
+        x = Vector3Normalize( Vector3CrossProduct( y, z ) );
+    } else if( !hasY ) {
+        y = Vector3Normalize( Vector3CrossProduct( z, x ) );
+    } else if( !hasZ ) {
+        z = Vector3Normalize( Vector3CrossProduct( x, y ) );
+    }
+
+    float fourW = x.x + y.y + z.z;
+    float fourX = x.x - y.y - z.z;
+    float fourY = y.y - x.x - z.z;
+    float fourZ = z.z - x.x - y.y;
+    int   biggestIndex = 0;
+    float biggest = fourW;
+    if( fourX > biggest ) {
+        biggest = fourX;
+        biggestIndex = 1;
+    }
+    if( fourY > biggest ) {
+        biggest = fourY;
+        biggestIndex = 2;
+    }
+    if( fourZ > biggest ) {
+        biggest = fourZ;
+        biggestIndex = 3;
+    }
+    float biggestVal = sqrtf( biggest + 1.0f )*0.5f;
+    float mult = 0.25f/biggestVal;
+    float a = ( y.z - z.y )*mult;
+    float b = ( z.x - x.z )*mult;
+    float c = ( x.y - y.x )*mult;
+    float d = ( x.y + y.x )*mult;
+    float e = ( z.x + x.z )*mult;
+    float f = ( y.z + z.y )*mult;
+    Quaternion q;
+    switch( biggestIndex ) {
+        case 0:  q = Quaternion{ a, b, c, biggestVal }; break;
+        case 1:  q = Quaternion{ biggestVal, d, e, a }; break;
+        case 2:  q = Quaternion{ d, biggestVal, f, b }; break;
+        default: q = Quaternion{ e, f, biggestVal, c }; break;
+    }
+    float ilength = 1.0f/sqrtf( q.x*q.x + q.y*q.y + q.z*q.z + q.w*q.w );
+    *rotation = Quaternion{ q.x*ilength, q.y*ilength, q.z*ilength, q.w*ilength };
+}
+RAYMATH_CPP_CONSTEXPR inline
+Mat4 Mat4::Compose( Vector3 translation, Quaternion rotation, Vector3 scale ) {
+    return ComposeMatrix( translation, rotation, scale );
+}
+inline
+void Mat4::Decompose( Vector3* translation, Quaternion* rotation, Vector3* scale ) const {
+    DecomposeMatrix( *this, translation, rotation, scale );
+}
+
+// NOTE(alicia): 3x3 matrices.
+// named like Matrix, mN is element N in column major order, so the
+// upper left 3x3 of a Matrix maps m0 m4 m8 / m1 m5 m9 / m2 m6 m10
+// to m0 m3 m6 / m1 m4 m7 / m2 m5 m8.
+struct Mat3 {
+    union {
+        float array[9];
+        struct {
+            float m0 = 0.0f, m3 = 0.0f, m6 = 0.0f;
+            float m1 = 0.0f, m4 = 0.0f, m7 = 0.0f;
+            float m2 = 0.0f, m5 = 0.0f, m8 = 0.0f;
+        };
+    };
+
+    RAYMATH_CPP_CONSTEXPR Mat3() {}
+    RAYMATH_CPP_CONSTEXPR Mat3(
+        float m0, float m3, float m6,
+        float m1, float m4, float m7,
+        float m2, float m5, float m8
+    ) :
+        m0(m0), m3(m3), m6(m6),
+        m1(m1), m4(m4), m7(m7),
+        m2(m2), m5(m5), m8(m8)
+    {}
+    /// Upper left 3x3, drops the translation and the bottom row.
+    explicit RAYMATH_CPP_CONSTEXPR Mat3( const Matrix& mat ) :
+        Mat3(
+            mat.m0, mat.m4,  mat.m8,
+            mat.m1, mat.m5,  mat.m9,
+            mat.m2, mat.m6, mat.m10 )
+    {}
+
+    static RAYMATH_CPP_CONSTEXPR inline
+    Mat3 Identity() {
+        return Mat3(
+            1.0f, 0.0f, 0.0f,
+            0.0f, 1.0f, 0.0f,
+            0.0f, 0.0f, 1.0f );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Mat3 Scale( Vector3 scale ) {
+        return Mat3(
+            scale.x, 0.0f, 0.0f,
+            0.0f, scale.y, 0.0f,
+            0.0f, 0.0f, scale.z );
+    }
+    /// Inverse transpose of the upper left 3x3 of model, straight from
+    /// its cofactors. same as Mat3( model.Invert().Transpose() )
+    /// for affine model matrices.
+    static RAYMATH_CPP_CONSTEXPR inline
+    Mat3 NormalMatrix( const Matrix& model ) {
+        // NOTE(alicia): the cofactors of the 3x3 are the cross products
+        // of its columns, the transpose comes free by storing them as rows.
+        Mat3 result(
+            model.m5*model.m10 - model.m9*model.m6,
+            model.m9*model.m2  - model.m1*model.m10,
+            model.m1*model.m6  - model.m5*model.m2,
+            model.m8*model.m6  - model.m4*model.m10,
+            model.m0*model.m10 - model.m8*model.m2,
+            model.m4*model.m2  - model.m0*model.m6,
+            model.m4*model.m9  - model.m8*model.m5,
+            model.m8*model.m1  - model.m0*model.m9,
+            model.m0*model.m5  - model.m4*model.m1 );
+        float invDet = 1.0f/( model.m0*result.m0 + model.m4*result.m3 + model.m8*result.m6 );
+        result.m0 *= invDet; result.m3 *= invDet; result.m6 *= invDet;
+        result.m1 *= invDet; result.m4 *= invDet; result.m7 *= invDet;
+        result.m2 *= invDet; result.m5 *= invDet; result.m8 *= invDet;
+        return result;
+    }
+
+    inline
+    float operator[]( size_t idx ) const {
+        return array[idx];
+    }
+    inline
+    float& operator[]( size_t idx ) {
+        return array[idx];
+    }
+
+    /// Zero translation, bottom row ( 0, 0, 0, 1 ).
+    RAYMATH_CPP_CONSTEXPR inline
+    Mat4 ToMatrix() const {
+        return Mat4(
+            m0, m3, m6, 0.0f,
+            m1, m4, m7, 0.0f,
+            m2, m5, m8, 0.0f,
+            0.0f, 0.0f, 0.0f, 1.0f );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float Determinant() const {
+        return m0*( m4*m8 - m7*m5 ) - m3*( m1*m8 - m7*m2 ) + m6*( m1*m5 - m4*m2 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Mat3 Transpose() const {
+        return Mat3(
+            m0, m1, m2,
+            m3, m4, m5,
+            m6, m7, m8 );
+    }
+    /// Cofactors over the determinant, see Affine3x4::Invert.
+    RAYMATH_CPP_CONSTEXPR inline
+    Mat3 Invert() const {
+        Mat3 result;
+        result.m0 = m4*m8 - m7*m5;
+        result.m1 = m7*m2 - m1*m8;
+        result.m2 = m1*m5 - m4*m2;
+        result.m3 = m6*m5 - m3*m8;
+        result.m4 = m0*m8 - m6*m2;
+        result.m5 = m3*m2 - m0*m5;
+        result.m6 = m3*m7 - m6*m4;
+        result.m7 = m6*m1 - m0*m7;
+        result.m8 = m0*m4 - m3*m1;
+
+        float invDet = 1.0f/( m0*result.m0 + m3*result.m1 + m6*result.m2 );
+        result.m0 *= invDet; result.m3 *= invDet; result.m6 *= invDet;
+        result.m1 *= invDet; result.m4 *= invDet; result.m7 *= invDet;
+        result.m2 *= invDet; result.m5 *= invDet; result.m8 *= invDet;
+        return result;
+    }
+    /// Same order as Mat4::Multiply, this is applied first.
+    RAYMATH_CPP_CONSTEXPR inline
+    Mat3 Multiply( const Mat3& right ) const {
+        return Mat3(
+            m0*right.m0 + m1*right.m3 + m2*right.m6,
+            m3*right.m0 + m4*right.m3 + m5*right.m6,
+            m6*right.m0 + m7*right.m3 + m8*right.m6,
+            m0*right.m1 + m1*right.m4 + m2*right.m7,
+            m3*right.m1 + m4*right.m4 + m5*right.m7,
+            m6*right.m1 + m7*right.m4 + m8*right.m7,
+            m0*right.m2 + m1*right.m5 + m2*right.m8,
+            m3*right.m2 + m4*right.m5 + m5*right.m8,
+            m6*right.m2 + m7*right.m5 + m8*right.m8 );
+    }
+    /// Same as TransformDirection with the Matrix it came from.
+    /// normals through a NormalMatrix need normalizing afterwards.
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Transform( Vector3 v ) const {
+        return Vec3(
+            m0*v.x + m3*v.y + m6*v.z,
+            m1*v.x + m4*v.y + m7*v.z,
+            m2*v.x + m5*v.y + m8*v.z );
+    }
+};
+
+RAYMATH_CPP_CONSTEXPR inline
+Mat3 operator*( const Mat3& left, const Mat3& right ) {
+    return left.Multiply( right );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec3 operator*( Vector3 lhs, const Mat3& rhs ) {
+    return rhs.Transform( lhs );
+}
+
+// NOTE(alicia): affine transforms.
+// the top 3 rows of a Matrix, the bottom row is always ( 0, 0, 0, 1 ).
+// laid out like the first 12 floats of Matrix so converting is a copy,
+// and arrays of them are 48 bytes per element instead of 64.
+// products skip the bottom row, 36 multiplies instead of 64.
+struct Affine3x4 {
+    union {
+        float array[12];
+        struct {
+            float m0 = 0.0f, m4 = 0.0f,  m8 = 0.0f, m12 = 0.0f;
+            float m1 = 0.0f, m5 = 0.0f,  m9 = 0.0f, m13 = 0.0f;
+            float m2 = 0.0f, m6 = 0.0f, m10 = 0.0f, m14 = 0.0f;
+        };
+    };
+
+    RAYMATH_CPP_CONSTEXPR Affine3x4() {}
+    RAYMATH_CPP_CONSTEXPR Affine3x4(
+        float m0, float m4, float  m8, float m12,
+        float m1, float m5, float  m9, float m13,
+        float m2, float m6, float m10, float m14
+    ) :
+        m0(m0), m4(m4),   m8(m8), m12(m12),
+        m1(m1), m5(m5),   m9(m9), m13(m13),
+        m2(m2), m6(m6), m10(m10), m14(m14)
+    {}
+    /// Drops the bottom row, mat is expected to be affine.
+    explicit RAYMATH_CPP_CONSTEXPR Affine3x4( const Matrix& mat ) :
+        Affine3x4(
+            mat.m0, mat.m4,  mat.m8, mat.m12,
+            mat.m1, mat.m5,  mat.m9, mat.m13,
+            mat.m2, mat.m6, mat.m10, mat.m14 )
+    {}
+
+    static RAYMATH_CPP_CONSTEXPR inline
+    Affine3x4 Identity() {
+        return Affine3x4(
+            1.0f, 0.0f, 0.0f, 0.0f,
+            0.0f, 1.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 1.0f, 0.0f );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Affine3x4 Translate( Vector3 translate ) {
+        return Affine3x4(
+            1.0f, 0.0f, 0.0f, translate.x,
+            0.0f, 1.0f, 0.0f, translate.y,
+            0.0f, 0.0f, 1.0f, translate.z );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    Affine3x4 Scale( Vector3 scale ) {
+        return Affine3x4(
+            scale.x, 0.0f, 0.0f, 0.0f,
+            0.0f, scale.y, 0.0f, 0.0f,
+            0.0f, 0.0f, scale.z, 0.0f );
+    }
+
+    inline
+    float operator[]( size_t idx ) const {
+        return array[idx];
+    }
+    inline
+    float& operator[]( size_t idx ) {
+        return array[idx];
+    }
+
+    RAYMATH_CPP_CONSTEXPR inline
+    Mat4 ToMatrix() const {
+        return Mat4(
+            m0, m4,  m8, m12,
+            m1, m5,  m9, m13,
+            m2, m6, m10, m14,
+            0.0f, 0.0f, 0.0f, 1.0f );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Translation() const {
+        return Vec3( m12, m13, m14 );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    float Determinant() const {
+        return m0*( m5*m10 - m9*m6 ) - m4*( m1*m10 - m9*m2 ) + m8*( m1*m6 - m5*m2 );
+    }
+    /// Same order as Mat4::Multiply, this is applied first.
+    RAYMATH_CPP_CONSTEXPR inline
+    Affine3x4 Multiply( const Affine3x4& right ) const;
+    /// 3x3 cofactor inverse, then the translation is rotated back.
+    RAYMATH_CPP_CONSTEXPR inline
+    Affine3x4 Invert() const {
+        // NOTE(alicia): columns of the inverse are the cross products
+        // of the rows ( m0, m4, m8 ), ( m1, m5, m9 ), ( m2, m6, m10 ).
+        Affine3x4 result;
+        result.m0 = m5*m10 - m9*m6;
+        result.m1 = m9*m2  - m1*m10;
+        result.m2 = m1*m6  - m5*m2;
+        result.m4 = m8*m6  - m4*m10;
+        result.m5 = m0*m10 - m8*m2;
+        result.m6 = m4*m2  - m0*m6;
+        result.m8 = m4*m9  - m8*m5;
+        result.m9 = m8*m1  - m0*m9;
+        result.m10 = m0*m5 - m4*m1;
+
+        float invDet = 1.0f/( m0*result.m0 + m4*result.m1 + m8*result.m2 );
+        result.m0 *= invDet; result.m4 *= invDet;  result.m8 *= invDet;
+        result.m1 *= invDet; result.m5 *= invDet;  result.m9 *= invDet;
+        result.m2 *= invDet; result.m6 *= invDet; result.m10 *= invDet;
+
+        result.m12 = -( result.m0*m12 + result.m4*m13 + result.m8*m14 );
+        result.m13 = -( result.m1*m12 + result.m5*m13 + result.m9*m14 );
+        result.m14 = -( result.m2*m12 + result.m6*m13 + result.m10*m14 );
+        return result;
+    }
+    /// Point ( w = 1 ), same as Vector3Transform.
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Transform( Vector3 v ) const {
+        return Vec3(
+            m0*v.x + m4*v.y + m8*v.z + m12,
+            m1*v.x + m5*v.y + m9*v.z + m13,
+            m2*v.x + m6*v.y + m10*v.z + m14 );
+    }
+    /// Direction ( w = 0 ), translation is ignored.
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 TransformDirection( Vector3 v ) const {
+        return Vec3(
+            m0*v.x + m4*v.y + m8*v.z,
+            m1*v.x + m5*v.y + m9*v.z,
+            m2*v.x + m6*v.y + m10*v.z );
+    }
+};
+
+RAYMATH_CPP_CONSTEXPR inline
+void Affine3x4MultiplyScalar( const Affine3x4& left, const Affine3x4& right, Affine3x4* out ) {
+    Affine3x4 result;
+
+    // NOTE(alicia): Mat4MultiplyScalar without the terms that
+    // the implicit bottom row makes 0 or 1.
+    result.m0 = left.m0*right.m0 + left.m1*right.m4 + left.m2*right.m8;
+    result.m1 = left.m0*right.m1 + left.m1*right.m5 + left.m2*right.m9;
+    result.m2 = left.m0*right.m2 + left.m1*right.m6 + left.m2*right.m10;
+    result.m4 = left.m4*right.m0 + left.m5*right.m4 + left.m6*right.m8;
+    result.m5 = left.m4*right.m1 + left.m5*right.m5 + left.m6*right.m9;
+    result.m6 = left.m4*right.m2 + left.m5*right.m6 + left.m6*right.m10;
+    result.m8 = left.m8*right.m0 + left.m9*right.m4 + left.m10*right.m8;
+    result.m9 = left.m8*right.m1 + left.m9*right.m5 + left.m10*right.m9;
+    result.m10 = left.m8*right.m2 + left.m9*right.m6 + left.m10*right.m10;
+    result.m12 = left.m12*right.m0 + left.m13*right.m4 + left.m14*right.m8 + right.m12;
+    result.m13 = left.m12*right.m1 + left.m13*right.m5 + left.m14*right.m9 + right.m13;
+    result.m14 = left.m12*right.m2 + left.m13*right.m6 + left.m14*right.m10 + right.m14;
+
+    *out = result;
+}
+#if defined(RAYMATH_CPP_SSE2)
+// NOTE(alicia): Mat4MultiplySSE2 with 3 rows, the bottom row of left
+// only contributes the w of each row of right. rounds like
+// Mat4::Multiply, fused when FMA is enabled at compile time
+// (RAYMATH_CPP_RUNTIME_DISPATCH only applies to Mat4).
+inline
+__m128 Affine3x4MultiplyRowSSE2( __m128 row, __m128 l0, __m128 l1, __m128 l2 ) {
+    __m128 w = _mm_castsi128_ps( _mm_set_epi32( -1, 0, 0, 0 ) );
+    __m128 result = _mm_mul_ps( _mm_shuffle_ps( row, row, 0x00 ), l0 );
+#if defined(RAYMATH_CPP_FMA)
+    result = _mm_fmadd_ps( _mm_shuffle_ps( row, row, 0x55 ), l1, result );
+    result = _mm_fmadd_ps( _mm_shuffle_ps( row, row, 0xAA ), l2, result );
+#else
+    result = _mm_add_ps( result, _mm_mul_ps( _mm_shuffle_ps( row, row, 0x55 ), l1 ) );
+    result = _mm_add_ps( result, _mm_mul_ps( _mm_shuffle_ps( row, row, 0xAA ), l2 ) );
+#endif
+    return _mm_add_ps( result, _mm_and_ps( row, w ) );
+}
+inline
+void Affine3x4MultiplySSE2( const Affine3x4& left, const Affine3x4& right, Affine3x4* out ) {
+    const float* l = left.array;
+    const float* r = right.array;
+
+    __m128 l0 = _mm_loadu_ps( l + 0 );
+    __m128 l1 = _mm_loadu_ps( l + 4 );
+    __m128 l2 = _mm_loadu_ps( l + 8 );
+
+    __m128 o0 = Affine3x4MultiplyRowSSE2( _mm_loadu_ps( r + 0 ), l0, l1, l2 );
+    __m128 o1 = Affine3x4MultiplyRowSSE2( _mm_loadu_ps( r + 4 ), l0, l1, l2 );
+    __m128 o2 = Affine3x4MultiplyRowSSE2( _mm_loadu_ps( r + 8 ), l0, l1, l2 );
+
+    float* o = out->array;
+    _mm_storeu_ps( o + 0, o0 );
+    _mm_storeu_ps( o + 4, o1 );
+    _mm_storeu_ps( o + 8, o2 );
+}
+#endif
+#if defined(RAYMATH_CPP_AVX)
+// NOTE(alicia): the first two rows share a register like Mat4MultiplyAVX.
+inline
+void Affine3x4MultiplyAVX( const Affine3x4& left, const Affine3x4& right, Affine3x4* out ) {
+    const float* l = left.array;
+    const float* r = right.array;
+
+    __m256 l0 = _mm256_broadcast_ps( (const __m128*)( l + 0 ) );
+    __m256 l1 = _mm256_broadcast_ps( (const __m128*)( l + 4 ) );
+    __m256 l2 = _mm256_broadcast_ps( (const __m128*)( l + 8 ) );
+    __m256 w  = _mm256_castsi256_ps( _mm256_set_epi32( -1, 0, 0, 0, -1, 0, 0, 0 ) );
+
+    __m256 r01 = _mm256_loadu_ps( r + 0 );
+    __m128 r2  = _mm_loadu_ps( r + 8 );
+
+    __m256 o01 = _mm256_mul_ps( _mm256_shuffle_ps( r01, r01, 0x00 ), l0 );
+#if defined(RAYMATH_CPP_FMA)
+    o01 = _mm256_fmadd_ps( _mm256_shuffle_ps( r01, r01, 0x55 ), l1, o01 );
+    o01 = _mm256_fmadd_ps( _mm256_shuffle_ps( r01, r01, 0xAA ), l2, o01 );
+#else
+    o01 = _mm256_add_ps( o01, _mm256_mul_ps( _mm256_shuffle_ps( r01, r01, 0x55 ), l1 ) );
+    o01 = _mm256_add_ps( o01, _mm256_mul_ps( _mm256_shuffle_ps( r01, r01, 0xAA ), l2 ) );
+#endif
+    o01 = _mm256_add_ps( o01, _mm256_and_ps( r01, w ) );
+    __m128 o2 = Affine3x4MultiplyRowSSE2( r2,
+        _mm256_castps256_ps128( l0 ), _mm256_castps256_ps128( l1 ), _mm256_castps256_ps128( l2 ) );
+
+    float* o = out->array;
+    _mm256_storeu_ps( o + 0, o01 );
+    _mm_storeu_ps( o + 8, o2 );
+}
+#endif
+RAYMATH_CPP_CONSTEXPR inline
+void Affine3x4MultiplyKernel( const Affine3x4& left, const Affine3x4& right, Affine3x4* out ) {
+#if defined(RAYMATH_CPP_AVX)
+    if( !RAYMATH_CPP_CONSTANT_EVALUATED() ) {
+        Affine3x4MultiplyAVX( left, right, out );
+        return;
+    }
+#elif defined(RAYMATH_CPP_SSE2)
+    if( !RAYMATH_CPP_CONSTANT_EVALUATED() ) {
+        Affine3x4MultiplySSE2( left, right, out );
+        return;
+    }
+#endif
+    Affine3x4MultiplyScalar( left, right, out );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Affine3x4 Affine3x4::Multiply( const Affine3x4& right ) const {
+    Affine3x4 result;
+    Affine3x4MultiplyKernel( *this, right, &result );
+    return result;
+}
+RAYMATH_CPP_CONSTEXPR inline
+Affine3x4 operator*( const Affine3x4& left, const Affine3x4& right ) {
+    return left.Multiply( right );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec3 operator*( Vector3 lhs, const Affine3x4& rhs ) {
+    return rhs.Transform( lhs );
+}
+
+// NOTE(alicia): rotation and translation only.
+// same layout as Affine3x4, but the rotation is orthonormal
+// so the inverse is its transpose plus the translation rotated back.
+struct RigidTransform {
+    union {
+        float array[12];
+        struct {
+            float m0 = 0.0f, m4 = 0.0f,  m8 = 0.0f, m12 = 0.0f;
+            float m1 = 0.0f, m5 = 0.0f,  m9 = 0.0f, m13 = 0.0f;
+            float m2 = 0.0f, m6 = 0.0f, m10 = 0.0f, m14 = 0.0f;
+        };
+    };
+
+    RAYMATH_CPP_CONSTEXPR RigidTransform() {}
+    RAYMATH_CPP_CONSTEXPR RigidTransform( Quaternion rotation, Vector3 translation ) :
+        RigidTransform( FromRotationTranslation( rotation, translation ) ) {}
+    /// affine is expected to have no scale or shear.
+    explicit RAYMATH_CPP_CONSTEXPR RigidTransform( const Affine3x4& affine ) :
+        m0(affine.m0), m4(affine.m4),   m8(affine.m8), m12(affine.m12),
+        m1(affine.m1), m5(affine.m5),   m9(affine.m9), m13(affine.m13),
+        m2(affine.m2), m6(affine.m6), m10(affine.m10), m14(affine.m14)
+    {}
+    /// mat is expected to have no scale, shear or projection.
+    explicit RAYMATH_CPP_CONSTEXPR RigidTransform( const Matrix& mat ) :
+        RigidTransform( Affine3x4( mat ) ) {}
+
+    static RAYMATH_CPP_CONSTEXPR inline
+    RigidTransform Identity() {
+        return RigidTransform( Affine3x4::Identity() );
+    }
+    /// rotation is expected to be normalized.
+    static RAYMATH_CPP_CONSTEXPR inline
+    RigidTransform FromRotationTranslation( Quaternion rotation, Vector3 translation ) {
+        Matrix r = RotationMatrix( rotation );
+        return RigidTransform( Affine3x4(
+            r.m0, r.m4,  r.m8, translation.x,
+            r.m1, r.m5,  r.m9, translation.y,
+            r.m2, r.m6, r.m10, translation.z ) );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    RigidTransform Translate( Vector3 translate ) {
+        return RigidTransform( Affine3x4::Translate( translate ) );
+    }
+
+    RAYMATH_CPP_CONSTEXPR inline
+    operator Affine3x4() const {
+        return Affine3x4(
+            m0, m4,  m8, m12,
+            m1, m5,  m9, m13,
+            m2, m6, m10, m14 );
+    }
+    inline
+    float operator[]( size_t idx ) const {
+        return array[idx];
+    }
+    inline
+    float& operator[]( size_t idx ) {
+        return array[idx];
+    }
+
+    RAYMATH_CPP_CONSTEXPR inline
+    Mat4 ToMatrix() const {
+        return Affine3x4( *this ).ToMatrix();
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Quat Rotation() const {
+        return QuaternionFromMatrix( ToMatrix() );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Translation() const {
+        return Vec3( m12, m13, m14 );
+    }
+    /// Same order as Mat4::Multiply, this is applied first.
+    RAYMATH_CPP_CONSTEXPR inline
+    RigidTransform Multiply( const RigidTransform& right ) const {
+        return RigidTransform( Affine3x4( *this ).Multiply( right ) );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    RigidTransform Invert() const {
+        return RigidTransform( Affine3x4(
+            m0, m1,  m2, -( m0*m12 + m1*m13 + m2*m14 ),
+            m4, m5,  m6, -( m4*m12 + m5*m13 + m6*m14 ),
+            m8, m9, m10, -( m8*m12 + m9*m13 + m10*m14 ) ) );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Transform( Vector3 v ) const {
+        return Affine3x4( *this ).Transform( v );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 TransformDirection( Vector3 v ) const {
+        return Affine3x4( *this ).TransformDirection( v );
+    }
+};
+RAYMATH_CPP_CONSTEXPR inline
+RigidTransform operator*( const RigidTransform& left, const RigidTransform& right ) {
+    return left.Multiply( right );
+}
+static_assert( sizeof(Mat3) == sizeof(float) * 9, "Mat3 must be 9 floats" );
+static_assert( sizeof(Affine3x4) == sizeof(float) * 12, "Affine3x4 must be 12 floats" );
+static_assert( sizeof(RigidTransform) == sizeof(Affine3x4), "RigidTransform must alias Affine3x4" );
+#if !defined(RAYMATH_CPP_NO_STDLIB)
+static_assert( std::is_trivially_copyable<Mat3>::value, "Mat3 must be trivially copyable" );
+static_assert( std::is_trivially_copyable<Affine3x4>::value, "Affine3x4 must be trivially copyable" );
+static_assert( std::is_trivially_copyable<RigidTransform>::value, "RigidTransform must be trivially copyable" );
+#endif
+
+// NOTE(alicia): dual quaternions.
+// real is the rotation, dual is half the translation times the rotation.
+// a rigid transform in 8 floats that blends without shrinking the mesh
+// the way blended matrices do (candy-wrapper twists).
+// methods expect a unit dual quaternion, call Normalize after blending.
+struct DualQuat {
+    Quat real;
+    Quat dual;
+
+    RAYMATH_CPP_CONSTEXPR DualQuat() {}
+    RAYMATH_CPP_CONSTEXPR DualQuat( Quaternion real, Quaternion dual ) : real(real), dual(dual) {}
+    /// rotation is expected to be normalized.
+    RAYMATH_CPP_CONSTEXPR DualQuat( Quaternion rotation, Vector3 translation ) :
+        DualQuat( FromRotationTranslation( rotation, translation ) ) {}
+    /// mat is expected to have no scale, shear or projection.
+    explicit RAYMATH_CPP_CONSTEXPR DualQuat( const Matrix& mat ) :
+        DualQuat( FromMatrix( mat ) ) {}
+
+    static RAYMATH_CPP_CONSTEXPR inline
+    DualQuat Identity() {
+        return DualQuat( Quaternion{ 0.0f, 0.0f, 0.0f, 1.0f }, Quaternion{ 0.0f, 0.0f, 0.0f, 0.0f } );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    DualQuat FromRotationTranslation( Quaternion rotation, Vector3 translation ) {
+        // NOTE(alicia): 0.5 * ( translation, 0 ) * rotation.
+        Vector3 t = translation;
+        Quaternion r = rotation;
+        return DualQuat( r, Quaternion{
+            0.5f*( t.x*r.w + t.y*r.z - t.z*r.y ),
+            0.5f*( t.y*r.w + t.z*r.x - t.x*r.z ),
+            0.5f*( t.z*r.w + t.x*r.y - t.y*r.x ),
+            -0.5f*( t.x*r.x + t.y*r.y + t.z*r.z ) } );
+    }
+    static RAYMATH_CPP_CONSTEXPR inline
+    DualQuat FromMatrix( const Matrix& mat ) {
+        return FromRotationTranslation(
+            QuaternionFromMatrix( mat ), Vector3{ mat.m12, mat.m13, mat.m14 } );
+    }
+
+    RAYMATH_CPP_CONSTEXPR inline
+    Mat4 ToMatrix() const {
+        Matrix result = RotationMatrix( real );
+        Vector3 t = Translation();
+        result.m12 = t.x;
+        result.m13 = t.y;
+        result.m14 = t.z;
+        return result;
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Quat Rotation() const {
+        return real;
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Translation() const {
+        // NOTE(alicia): vector part of 2 * dual * conjugate( real ).
+        return Vec3(
+            2.0f*( real.w*dual.x - dual.w*real.x + real.y*dual.z - real.z*dual.y ),
+            2.0f*( real.w*dual.y - dual.w*real.y + real.z*dual.x - real.x*dual.z ),
+            2.0f*( real.w*dual.z - dual.w*real.z + real.x*dual.y - real.y*dual.x ) );
+    }
+
+    RAYMATH_CPP_CONSTEXPR inline
+    DualQuat Add( const DualQuat& other ) const {
+        return DualQuat( QuaternionAdd( real, other.real ), QuaternionAdd( dual, other.dual ) );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    DualQuat Scale( float mul ) const {
+        return DualQuat( QuaternionScale( real, mul ), QuaternionScale( dual, mul ) );
+    }
+    /// Divides both parts by the length of real.
+    RAYMATH_CPP_CONSTEXPR inline
+    DualQuat Normalize() const {
+        float length = QuaternionLength( real );
+        return length == 0.0f ? *this : Scale( 1.0f/length );
+    }
+    /// Same order as Mat4::Multiply, this is applied first.
+    RAYMATH_CPP_CONSTEXPR inline
+    DualQuat Multiply( const DualQuat& right ) const {
+        return DualQuat(
+            QuaternionMultiply( right.real, real ),
+            QuaternionAdd(
+                QuaternionMultiply( right.real, dual ),
+                QuaternionMultiply( right.dual, real ) ) );
+    }
+    /// Conjugate of both parts, the inverse of a unit dual quaternion.
+    RAYMATH_CPP_CONSTEXPR inline
+    DualQuat Invert() const {
+        return DualQuat(
+            Quaternion{ -real.x, -real.y, -real.z, real.w },
+            Quaternion{ -dual.x, -dual.y, -dual.z, dual.w } );
+    }
+    /// Point, rotated then translated.
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Transform( Vector3 v ) const {
+        Vec3 r = TransformDirection( v );
+        Vec3 t = Translation();
+        return Vec3( r.x + t.x, r.y + t.y, r.z + t.z );
+    }
+    /// Direction, rotated only.
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 TransformDirection( Vector3 v ) const {
+        // NOTE(alicia): v + 2 * cross( r, cross( r, v ) + w * v ).
+        float cx = real.y*v.z - real.z*v.y + real.w*v.x;
+        float cy = real.z*v.x - real.x*v.z + real.w*v.y;
+        float cz = real.x*v.y - real.y*v.x + real.w*v.z;
+        return Vec3(
+            v.x + 2.0f*( real.y*cz - real.z*cy ),
+            v.y + 2.0f*( real.z*cx - real.x*cz ),
+            v.z + 2.0f*( real.x*cy - real.y*cx ) );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    bool Equals( const DualQuat& other ) const {
+        return QuaternionEquals( real, other.real ) && QuaternionEquals( dual, other.dual );
+    }
+};
+RAYMATH_CPP_CONSTEXPR inline
+DualQuat operator+( const DualQuat& left, const DualQuat& right ) {
+    return left.Add( right );
+}
+RAYMATH_CPP_CONSTEXPR inline
+DualQuat operator*( const DualQuat& left, float scale ) {
+    return left.Scale( scale );
+}
+RAYMATH_CPP_CONSTEXPR inline
+DualQuat operator*( float scale, const DualQuat& right ) {
+    return right.Scale( scale );
+}
+RAYMATH_CPP_CONSTEXPR inline
+DualQuat operator*( const DualQuat& left, const DualQuat& right ) {
+    return left.Multiply( right );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec3 operator*( Vector3 lhs, const DualQuat& rhs ) {
+    return rhs.Transform( lhs );
+}
+static_assert( sizeof(DualQuat) == sizeof(float) * 8, "DualQuat must be 8 floats" );
+#if !defined(RAYMATH_CPP_NO_STDLIB)
+static_assert( std::is_trivially_copyable<DualQuat>::value, "DualQuat must be trivially copyable" );
+#endif
+
+// NOTE(alicia): position, rotation and scale kept apart.
+// applied like ComposeMatrix, scale then rotation then translation.
+// products and inverses stay in vectors and quaternions, a matrix is
+// only built by ToMatrix. scale is per axis, but like other engines'
+// transform types Multiply and Invert are only exact when the scale
+// applied after a rotation is uniform, any shear is dropped.
+// rotation is expected to be normalized.
+struct Transform3D {
+    Vec3 position;
+    Quat rotation;
+    Vec3 scale;
+
+    RAYMATH_CPP_CONSTEXPR Transform3D() {}
+    RAYMATH_CPP_CONSTEXPR Transform3D( Vector3 position, Quaternion rotation, Vector3 scale ) :
+        position( position ), rotation( rotation ), scale( scale ) {}
+    RAYMATH_CPP_CONSTEXPR Transform3D( Vector3 position, Quaternion rotation ) :
+        position( position ), rotation( rotation ), scale( 1.0f, 1.0f, 1.0f ) {}
+    /// See DecomposeMatrix.
+    explicit Transform3D( const Matrix& mat ) {
+        Vector3 t, s;
+        Quaternion r;
+        DecomposeMatrix( mat, &t, &r, &s );
+        *this = Transform3D( t, r, s );
+    }
+
+    static RAYMATH_CPP_CONSTEXPR inline
+    Transform3D Identity() {
+        return Transform3D( Vector3{ 0.0f, 0.0f, 0.0f },
+            Quaternion{ 0.0f, 0.0f, 0.0f, 1.0f }, Vector3{ 1.0f, 1.0f, 1.0f } );
+    }
+
+    /// Same as ComposeMatrix.
+    RAYMATH_CPP_CONSTEXPR inline
+    Mat4 ToMatrix() const {
+        return ComposeMatrix( position, rotation, scale );
+    }
+    /// Same order as Mat4::Multiply, this is applied first.
+    RAYMATH_CPP_CONSTEXPR inline
+    Transform3D Multiply( const Transform3D& right ) const {
+        return Transform3D(
+            right.Transform( position ),
+            QuaternionMultiply( right.rotation, rotation ),
+            Vector3Multiply( scale, right.scale ) );
+    }
+    /// Conjugate rotation and reciprocal scale, scale must not be 0.
+    RAYMATH_CPP_CONSTEXPR inline
+    Transform3D Invert() const {
+        Quaternion r = { -rotation.x, -rotation.y, -rotation.z, rotation.w };
+        Vector3 s = { 1.0f/scale.x, 1.0f/scale.y, 1.0f/scale.z };
+        Vector3 t = Rotate( r, Vector3{ -position.x*s.x, -position.y*s.y, -position.z*s.z } );
+        return Transform3D( t, r, s );
+    }
+    /// Point, scaled, rotated then translated.
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Transform( Vector3 v ) const {
+        Vector3 r = Rotate( rotation, Vector3Multiply( v, scale ) );
+        return Vec3( r.x + position.x, r.y + position.y, r.z + position.z );
+    }
+    /// Direction, scaled then rotated.
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 TransformDirection( Vector3 v ) const {
+        return Rotate( rotation, Vector3Multiply( v, scale ) );
+    }
+    /// Point back into local space, exact for any scale.
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 InverseTransform( Vector3 v ) const {
+        Quaternion r = { -rotation.x, -rotation.y, -rotation.z, rotation.w };
+        Vector3 local = Rotate( r, Vector3{ v.x - position.x, v.y - position.y, v.z - position.z } );
+        return Vec3( local.x/scale.x, local.y/scale.y, local.z/scale.z );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    bool Equals( const Transform3D& other ) const {
+        return Vector3Equals( position, other.position ) &&
+            QuaternionEquals( rotation, other.rotation ) && Vector3Equals( scale, other.scale );
+    }
+
+private:
+    /// See DualQuat::TransformDirection.
+    static RAYMATH_CPP_CONSTEXPR inline
+    Vector3 Rotate( Quaternion q, Vector3 v ) {
+        float cx = q.y*v.z - q.z*v.y + q.w*v.x;
+        float cy = q.z*v.x - q.x*v.z + q.w*v.y;
+        float cz = q.x*v.y - q.y*v.x + q.w*v.z;
+        return Vector3{
+            v.x + 2.0f*( q.y*cz - q.z*cy ),
+            v.y + 2.0f*( q.z*cx - q.x*cz ),
+            v.z + 2.0f*( q.x*cy - q.y*cx ) };
+    }
+};
+RAYMATH_CPP_CONSTEXPR inline
+Transform3D operator*( const Transform3D& left, const Transform3D& right ) {
+    return left.Multiply( right );
+}
+RAYMATH_CPP_CONSTEXPR inline
+Vec3 operator*( Vector3 lhs, const Transform3D& rhs ) {
+    return rhs.Transform( lhs );
+}
+static_assert( sizeof(Transform3D) == sizeof(float) * 10, "Transform3D must be 10 floats" );
+#if !defined(RAYMATH_CPP_NO_STDLIB)
+static_assert( std::is_trivially_copyable<Transform3D>::value, "Transform3D must be trivially copyable" );
+#endif
+
+#if !defined(RAYMATH_CPP_NO_STDLIB)
+#if defined(RAYMATH_CPP_PARALLEL)
+struct ThreadPool;
+#endif
+// NOTE(alicia): transform hierarchy.
+// every node has a local position, rotation and scale and a cached
+// world matrix ( local * parent world, same order as Mat4::Multiply ).
+// nodes are stored sorted by depth, so parents come before their
+// children and every level is one contiguous range.
+// Set* marks a node dirty, Update recomputes the dirty nodes and
+// everything below them one level at a time and skips the rest.
+// ids are handed out by Add and don't change when nodes are reordered.
+struct TransformHierarchy {
+    static const unsigned int None = 0xFFFFFFFFu;
+
+    TransformHierarchy() {}
+    TransformHierarchy( const TransformHierarchy& ) = delete;
+    TransformHierarchy& operator=( const TransformHierarchy& ) = delete;
+    TransformHierarchy( TransformHierarchy&& other ) : state(other.state) {
+        other.state = State();
+    }
+    TransformHierarchy& operator=( TransformHierarchy&& other ) {
+        if( this != &other ) {
+            std::free( state.block );
+            state = other.state;
+            other.state = State();
+        }
+        return *this;
+    }
+    ~TransformHierarchy() {
+        std::free( state.block );
+    }
+
+    /// Adds a node under parent ( None for a root ) and returns its id,
+    /// None if out of memory. rotation is expected to be normalized.
+    inline
+    unsigned int Add( unsigned int parent, Vector3 position, Quaternion rotation, Vector3 scale ) {
+        State& s = state;
+        if( s.count == s.capacity && !Reserve( s.capacity ? 2 * s.capacity : 64 ) ) {
+            return None;
+        }
+        size_t slot = s.count++;
+        s.positions[slot] = position;
+        s.rotations[slot] = rotation;
+        s.scales[slot]    = scale;
+        s.parents[slot]   = parent == None ? None : s.index[parent];
+        s.depths[slot]    = parent == None ? 0 : s.depths[s.index[parent]] + 1;
+        s.ids[slot]       = (unsigned int)slot;
+        s.index[slot]     = (unsigned int)slot;
+        s.dirty[slot]     = 1;
+        s.changed = true;
+        s.layout  = true;
+        return (unsigned int)slot;
+    }
+    /// Room for capacity nodes, false if out of memory.
+    inline
+    bool Reserve( size_t capacity ) {
+        State& s = state;
+        if( capacity <= s.capacity ) {
+            return true;
+        }
+        if( capacity >= None ) {
+            return false;
+        }
+        State grown = s;
+        grown.block = std::malloc( Bytes( capacity ) );
+        if( !grown.block ) {
+            return false;
+        }
+        grown.capacity = capacity;
+        Assign( &grown );
+        Copy( s, &grown );
+        for( size_t i = 0; s.block && i <= s.levelCount; ++i ) {
+            grown.levels[i] = s.levels[i];
+        }
+        std::free( s.block );
+        s = grown;
+        return true;
+    }
+
+    inline
+    void SetLocal( unsigned int id, Vector3 position, Quaternion rotation, Vector3 scale ) {
+        unsigned int slot = state.index[id];
+        state.positions[slot] = position;
+        state.rotations[slot] = rotation;
+        state.scales[slot]    = scale;
+        Touch( slot );
+    }
+    inline
+    void SetLocal( unsigned int id, const Transform3D& local ) {
+        SetLocal( id, local.position, local.rotation, local.scale );
+    }
+    inline
+    void SetPosition( unsigned int id, Vector3 position ) {
+        state.positions[state.index[id]] = position;
+        Touch( state.index[id] );
+    }
+    inline
+    void SetRotation( unsigned int id, Quaternion rotation ) {
+        state.rotations[state.index[id]] = rotation;
+        Touch( state.index[id] );
+    }
+    inline
+    void SetScale( unsigned int id, Vector3 scale ) {
+        state.scales[state.index[id]] = scale;
+        Touch( state.index[id] );
+    }
+    inline
+    Vec3 Position( unsigned int id ) const {
+        return state.positions[state.index[id]];
+    }
+    inline
+    Quat Rotation( unsigned int id ) const {
+        return state.rotations[state.index[id]];
+    }
+    inline
+    Vec3 Scale( unsigned int id ) const {
+        return state.scales[state.index[id]];
+    }
+    inline
+    Transform3D Local( unsigned int id ) const {
+        unsigned int slot = state.index[id];
+        return Transform3D( state.positions[slot], state.rotations[slot], state.scales[slot] );
+    }
+    inline
+    unsigned int Parent( unsigned int id ) const {
+        unsigned int parent = state.parents[state.index[id]];
+        return parent == None ? None : state.ids[parent];
+    }
+    /// As of the last Update.
+    inline
+    const Mat4& World( unsigned int id ) const {
+        return *(const Mat4*)( state.worlds + state.index[id] );
+    }
+    inline
+    size_t Count() const {
+        return state.count;
+    }
+
+    /// Recomputes the world matrix of every dirty node and its
+    /// descendants. false if out of memory while reordering.
+    inline
+    bool Update() {
+        Serial serial;
+        return UpdateWith( serial, 0 );
+    }
+#if defined(RAYMATH_CPP_PARALLEL)
+    /// Same result as Update, the nodes of a level are split over pool.
+    inline
+    bool Update( ThreadPool& pool );
+#endif
+
+private:
+    struct State {
+        void*         block      = nullptr;
+        size_t        count      = 0;
+        size_t        capacity   = 0;
+        size_t        levelCount = 0;
+        bool          changed    = false;
+        bool          layout     = false;
+        Matrix*       worlds     = nullptr;
+        Vector3*      positions  = nullptr;
+        Quaternion*   rotations  = nullptr;
+        Vector3*      scales     = nullptr;
+        unsigned int* parents    = nullptr;
+        unsigned int* depths     = nullptr;
+        unsigned int* ids        = nullptr;
+        unsigned int* index      = nullptr;
+        unsigned int* levels     = nullptr;
+        unsigned char* dirty     = nullptr;
+    };
+    struct Serial {
+        template<typename Fn>
+        void For( size_t count, size_t, const Fn& fn ) {
+            if( count ) {
+                fn( (size_t)0, count );
+            }
+        }
+    };
+
+    State state;
+
+    static inline
+    size_t Bytes( size_t capacity ) {
+        return capacity * ( sizeof(Matrix) + 2 * sizeof(Vector3) + sizeof(Quaternion) +
+            5 * sizeof(unsigned int) + 1 ) + sizeof(unsigned int);
+    }
+    /// Points the arrays of s into s->block.
+    static inline
+    void Assign( State* s ) {
+        size_t capacity = s->capacity;
+        s->worlds    = (Matrix*)s->block;
+        s->rotations = (Quaternion*)( s->worlds + capacity );
+        s->positions = (Vector3*)( s->rotations + capacity );
+        s->scales    = s->positions + capacity;
+        s->parents   = (unsigned int*)( s->scales + capacity );
+        s->depths    = s->parents + capacity;
+        s->ids       = s->depths + capacity;
+        s->index     = s->ids + capacity;
+        s->levels    = s->index + capacity;
+        s->dirty     = (unsigned char*)( s->levels + capacity + 1 );
+    }
+    /// Copies the nodes of from into to, slot order unchanged.
+    static inline
+    void Copy( const State& from, State* to ) {
+        for( size_t i = 0; i < from.count; ++i ) {
+            to->worlds[i]    = from.worlds[i];
+            to->rotations[i] = from.rotations[i];
+            to->positions[i] = from.positions[i];
+            to->scales[i]    = from.scales[i];
+            to->parents[i]   = from.parents[i];
+            to->depths[i]    = from.depths[i];
+            to->ids[i]       = from.ids[i];
+            to->index[i]     = from.index[i];
+            to->dirty[i]     = from.dirty[i];
+        }
+    }
+    inline
+    void Touch( unsigned int slot ) {
+        state.dirty[slot] = 1;
+        state.changed = true;
+    }
+    /// Sorts the nodes by depth if Add broke the order, then finds
+    /// where every level starts.
+    inline
+    bool Arrange() {
+        State& s = state;
+        size_t levelCount = 0;
+        bool   sorted     = true;
+        for( size_t i = 0; i < s.count; ++i ) {
+            sorted     = sorted && ( !i || s.depths[i] >= s.depths[i - 1] );
+            levelCount = s.depths[i] + 1 > levelCount ? s.depths[i] + 1 : levelCount;
+        }
+        for( size_t l = 0; l <= levelCount; ++l ) {
+            s.levels[l] = 0;
+        }
+        for( size_t i = 0; i < s.count; ++i ) {
+            s.levels[s.depths[i] + 1]++;
+        }
+        for( size_t l = 0; l < levelCount; ++l ) {
+            s.levels[l + 1] += s.levels[l];
+        }
+        s.levelCount = levelCount;
+        if( sorted ) {
+            s.layout = false;
+            return true;
+        }
+
+        // NOTE(alicia): stable counting sort into a new block,
+        // a node keeps its place among the nodes of its level.
+        State ordered = s;
+        ordered.block = std::malloc( Bytes( s.capacity ) );
+        unsigned int* slots = (unsigned int*)std::malloc( ( s.count + levelCount ) * sizeof(unsigned int) );
+        if( !ordered.block || !slots ) {
+            std::free( ordered.block );
+            std::free( slots );
+            return false;
+        }
+        Assign( &ordered );
+        unsigned int* next = slots + s.count;
+        for( size_t l = 0; l < levelCount; ++l ) {
+            next[l] = s.levels[l];
+        }
+        for( size_t i = 0; i < s.count; ++i ) {
+            slots[i] = next[s.depths[i]]++;
+        }
+        for( size_t i = 0; i < s.count; ++i ) {
+            unsigned int to = slots[i];
+            ordered.worlds[to]    = s.worlds[i];
+            ordered.rotations[to] = s.rotations[i];
+            ordered.positions[to] = s.positions[i];
+            ordered.scales[to]    = s.scales[i];
+            ordered.parents[to]   = s.parents[i] == None ? None : slots[s.parents[i]];
+            ordered.depths[to]    = s.depths[i];
+            ordered.ids[to]       = s.ids[i];
+            ordered.dirty[to]     = s.dirty[i];
+            ordered.index[s.ids[i]] = to;
+        }
+        for( size_t l = 0; l <= levelCount; ++l ) {
+            ordered.levels[l] = s.levels[l];
+        }
+        std::free( slots );
+        std::free( s.block );
+        s = ordered;
+        s.layout = false;
+        return true;
+    }
+    template<typename Runner>
+    bool UpdateWith( Runner& run, size_t chunk ) {
+        State& s = state;
+        if( s.layout && !Arrange() ) {
+            return false;
+        }
+        if( !s.changed ) {
+            return true;
+        }
+        for( size_t l = 0; l < s.levelCount; ++l ) {
+            size_t first = s.levels[l];
+            run.For( s.levels[l + 1] - first, chunk, [&]( size_t begin, size_t end ) {
+                for( size_t i = first + begin; i < first + end; ++i ) {
+                    unsigned int parent = s.parents[i];
+                    // NOTE(alicia): a parent from the level above is final,
+                    // its flag says whether anything above it moved.
+                    if( !s.dirty[i] && ( parent == None || !s.dirty[parent] ) ) {
+                        continue;
+                    }
+                    s.dirty[i] = 1;
+                    Matrix local = ComposeMatrix( s.positions[i], s.rotations[i], s.scales[i] );
+                    if( parent == None ) {
+                        s.worlds[i] = local;
+                    } else {
+                        Mat4MultiplyKernel( local, s.worlds[parent], s.worlds + i );
+                    }
+                }
+            } );
+        }
+        for( size_t i = 0; i < s.count; ++i ) {
+            s.dirty[i] = 0;
+        }
+        s.changed = false;
+        return true;
+    }
+};
+#endif
+
+// NOTE(alicia): view frustum.
+// planes are pulled from the rows of a view-projection matrix
+// (Gribb & Hartmann) and normalized, a point is inside a plane when
+// dot( plane.xyz, point ) + plane.w >= 0.
+// the tests are conservative: objects near a corner of the frustum
+// can pass every plane and still be outside.
+// the bulk tests write one bit per object, bit i % 8 of visible[i / 8],
+// 1 when visible. visible needs ( count + 7 ) / 8 bytes.
+struct Frustum {
+    enum Plane { Left, Right, Bottom, Top, Near, Far, PlaneCount };
+    Vector4 planes[PlaneCount];
+
+    RAYMATH_CPP_CONSTEXPR Frustum() : planes{} {}
+    /// viewProjection as view * projection, e.g. Mat4::LookAt * Mat4::Perspective.
+    explicit RAYMATH_CPP_CONSTEXPR Frustum( const Matrix& viewProjection ) :
+        planes{
+            NormalizePlane( viewProjection.m3 + viewProjection.m0, viewProjection.m7 + viewProjection.m4,
+                viewProjection.m11 + viewProjection.m8,  viewProjection.m15 + viewProjection.m12 ),
+            NormalizePlane( viewProjection.m3 - viewProjection.m0, viewProjection.m7 - viewProjection.m4,
+                viewProjection.m11 - viewProjection.m8,  viewProjection.m15 - viewProjection.m12 ),
+            NormalizePlane( viewProjection.m3 + viewProjection.m1, viewProjection.m7 + viewProjection.m5,
+                viewProjection.m11 + viewProjection.m9,  viewProjection.m15 + viewProjection.m13 ),
+            NormalizePlane( viewProjection.m3 - viewProjection.m1, viewProjection.m7 - viewProjection.m5,
+                viewProjection.m11 - viewProjection.m9,  viewProjection.m15 - viewProjection.m13 ),
+            NormalizePlane( viewProjection.m3 + viewProjection.m2, viewProjection.m7 + viewProjection.m6,
+                viewProjection.m11 + viewProjection.m10, viewProjection.m15 + viewProjection.m14 ),
+            NormalizePlane( viewProjection.m3 - viewProjection.m2, viewProjection.m7 - viewProjection.m6,
+                viewProjection.m11 - viewProjection.m10, viewProjection.m15 - viewProjection.m14 ) }
+    {}
+
+    static RAYMATH_CPP_CONSTEXPR inline
+    Vector4 NormalizePlane( float a, float b, float c, float d ) {
+        float length = Vector3Length( Vector3{ a, b, c } );
+        if( length == 0.0f ) {
+            length = 1.0f;
+        }
+        float ilength = 1.0f/length;
+        return Vector4{ a*ilength, b*ilength, c*ilength, d*ilength };
+    }
+
+    RAYMATH_CPP_CONSTEXPR inline
+    float Distance( Plane plane, Vector3 point ) const {
+        return planes[plane].x*point.x + planes[plane].y*point.y +
+            planes[plane].z*point.z + planes[plane].w;
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    bool ContainsPoint( Vector3 point ) const {
+        return IntersectsSphere( point, 0.0f );
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    bool IntersectsSphere( Vector3 center, float radius ) const {
+        bool result = true;
+        for( int i = 0; i < PlaneCount; ++i ) {
+            result &= Distance( (Plane)i, center ) >= -radius;
+        }
+        return result;
+    }
+    /// Box as center +/- extents, see IntersectsBox.
+    RAYMATH_CPP_CONSTEXPR inline
+    bool IntersectsBoxExtents( Vector3 center, Vector3 extents ) const {
+        bool result = true;
+        for( int i = 0; i < PlaneCount; ++i ) {
+            const Vector4& p = planes[i];
+            float radius = Abs( p.x )*extents.x +
+                Abs( p.y )*extents.y + Abs( p.z )*extents.z;
+            result &= Distance( (Plane)i, center ) >= -radius;
+        }
+        return result;
+    }
+    RAYMATH_CPP_CONSTEXPR inline
+    bool IntersectsBox( Vector3 min, Vector3 max ) const {
+        return IntersectsBoxExtents(
+            Vector3{ ( min.x + max.x )*0.5f, ( min.y + max.y )*0.5f, ( min.z + max.z )*0.5f },
+            Vector3{ ( max.x - min.x )*0.5f, ( max.y - min.y )*0.5f, ( max.z - min.z )*0.5f } );
+    }
+
+    /// Spheres as centers[i] and radii[i].
+    inline
+    void CullSpheres(
+        const Vector3* centers, const float* radii, unsigned char* visible, size_t count
+    ) const {
+        Cull<false>( centers, radii, nullptr, visible, count );
+    }
+    /// Boxes as min[i] and max[i].
+    inline
+    void CullBoxes(
+        const Vector3* min, const Vector3* max, unsigned char* visible, size_t count
+    ) const {
+        Cull<true>( min, nullptr, max, visible, count );
+    }
+    inline
+    void CullSpheres(
+        const Vec3* centers, const float* radii, unsigned char* visible, size_t count
+    ) const {
+        CullSpheres( (const Vector3*)centers, radii, visible, count );
+    }
+    inline
+    void CullBoxes(
+        const Vec3* min, const Vec3* max, unsigned char* visible, size_t count
+    ) const {
+        CullBoxes( (const Vector3*)min, (const Vector3*)max, visible, count );
+    }
+
+private:
+    static RAYMATH_CPP_CONSTEXPR inline
+    float Abs( float x ) {
+        return x < 0.0f ? -x : x;
+    }
+#if defined(RAYMATH_CPP_SSE2)
+    // NOTE(alicia): planes are broadcast once per call into locals,
+    // the writes to visible could otherwise alias them and force
+    // a reload every step.
+    struct Planes4 {
+        __m128 x[PlaneCount], y[PlaneCount], z[PlaneCount], w[PlaneCount];
+    };
+    inline
+    void Broadcast( Planes4* p ) const {
+        for( int i = 0; i < PlaneCount; ++i ) {
+            p->x[i] = _mm_set1_ps( planes[i].x );
+            p->y[i] = _mm_set1_ps( planes[i].y );
+            p->z[i] = _mm_set1_ps( planes[i].z );
+            p->w[i] = _mm_set1_ps( planes[i].w );
+        }
+    }
+    /// all-ones lanes for the objects that pass every plane.
+    /// boxes come in as center and extents, spheres as center and radius.
+    template<bool Box> static inline
+    __m128 Test4( const Planes4& p, __m128 x, __m128 y, __m128 z, __m128 ex, __m128 ey, __m128 ez ) {
+        __m128 sign   = _mm_set1_ps( -0.0f );
+        __m128 result = _mm_castsi128_ps( _mm_set1_epi32( -1 ) );
+        for( int i = 0; i < PlaneCount; ++i ) {
+            __m128 distance = _mm_add_ps( _mm_add_ps( _mm_add_ps(
+                _mm_mul_ps( p.x[i], x ), _mm_mul_ps( p.y[i], y ) ),
+                _mm_mul_ps( p.z[i], z ) ), p.w[i] );
+            __m128 radius = ex;
+            if( Box ) {
+                radius = _mm_add_ps( _mm_add_ps(
+                    _mm_mul_ps( _mm_andnot_ps( sign, p.x[i] ), ex ),
+                    _mm_mul_ps( _mm_andnot_ps( sign, p.y[i] ), ey ) ),
+                    _mm_mul_ps( _mm_andnot_ps( sign, p.z[i] ), ez ) );
+            }
+            result = _mm_and_ps( result, _mm_cmpge_ps( distance, _mm_xor_ps( radius, sign ) ) );
+        }
+        return result;
+    }
+    template<bool Box> static inline
+    int Mask4( const Planes4& p, const Vector3* a, const float* radii, const Vector3* b ) {
+        __m128 x, y, z, ex, ey, ez;
+        Simd4::Load( a, &x, &y, &z );
+        if( Box ) {
+            __m128 half = _mm_set1_ps( 0.5f );
+            Simd4::Load( b, &ex, &ey, &ez );
+            __m128 cx = _mm_mul_ps( _mm_add_ps( x, ex ), half );
+            __m128 cy = _mm_mul_ps( _mm_add_ps( y, ey ), half );
+            __m128 cz = _mm_mul_ps( _mm_add_ps( z, ez ), half );
+            ex = _mm_mul_ps( _mm_sub_ps( ex, x ), half );
+            ey = _mm_mul_ps( _mm_sub_ps( ey, y ), half );
+            ez = _mm_mul_ps( _mm_sub_ps( ez, z ), half );
+            x = cx; y = cy; z = cz;
+        } else {
+            ex = _mm_loadu_ps( radii );
+            ey = ez = ex;
+        }
+        return _mm_movemask_ps( Test4<Box>( p, x, y, z, ex, ey, ez ) );
+    }
+#endif
+#if defined(RAYMATH_CPP_AVX)
+    struct Planes8 {
+        __m256 x[PlaneCount], y[PlaneCount], z[PlaneCount], w[PlaneCount];
+    };
+    inline
+    void Broadcast( Planes8* p ) const {
+        for( int i = 0; i < PlaneCount; ++i ) {
+            p->x[i] = _mm256_set1_ps( planes[i].x );
+            p->y[i] = _mm256_set1_ps( planes[i].y );
+            p->z[i] = _mm256_set1_ps( planes[i].z );
+            p->w[i] = _mm256_set1_ps( planes[i].w );
+        }
+    }
+    template<bool Box> static inline
+    __m256 Test8( const Planes8& p, __m256 x, __m256 y, __m256 z, __m256 ex, __m256 ey, __m256 ez ) {
+        __m256 sign   = _mm256_set1_ps( -0.0f );
+        __m256 result = _mm256_castsi256_ps( _mm256_set1_epi32( -1 ) );
+        for( int i = 0; i < PlaneCount; ++i ) {
+            __m256 distance = _mm256_add_ps( _mm256_add_ps( _mm256_add_ps(
+                _mm256_mul_ps( p.x[i], x ), _mm256_mul_ps( p.y[i], y ) ),
+                _mm256_mul_ps( p.z[i], z ) ), p.w[i] );
+            __m256 radius = ex;
+            if( Box ) {
+                radius = _mm256_add_ps( _mm256_add_ps(
+                    _mm256_mul_ps( _mm256_andnot_ps( sign, p.x[i] ), ex ),
+                    _mm256_mul_ps( _mm256_andnot_ps( sign, p.y[i] ), ey ) ),
+                    _mm256_mul_ps( _mm256_andnot_ps( sign, p.z[i] ), ez ) );
+            }
+            result = _mm256_and_ps( result,
+                _mm256_cmp_ps( distance, _mm256_xor_ps( radius, sign ), _CMP_GE_OQ ) );
+        }
+        return result;
+    }
+    template<bool Box> static inline
+    int Mask8( const Planes8& p, const Vector3* a, const float* radii, const Vector3* b ) {
+        __m256 x, y, z, ex, ey, ez;
+        Simd4::Load( a, &x, &y, &z );
+        if( Box ) {
+            __m256 half = _mm256_set1_ps( 0.5f );
+            Simd4::Load( b, &ex, &ey, &ez );
+            __m256 cx = _mm256_mul_ps( _mm256_add_ps( x, ex ), half );
+            __m256 cy = _mm256_mul_ps( _mm256_add_ps( y, ey ), half );
+            __m256 cz = _mm256_mul_ps( _mm256_add_ps( z, ez ), half );
+            ex = _mm256_mul_ps( _mm256_sub_ps( ex, x ), half );
+            ey = _mm256_mul_ps( _mm256_sub_ps( ey, y ), half );
+            ez = _mm256_mul_ps( _mm256_sub_ps( ez, z ), half );
+            x = cx; y = cy; z = cz;
+        } else {
+            ex = _mm256_loadu_ps( radii );
+            ey = ez = ex;
+        }
+        return _mm256_movemask_ps( Test8<Box>( p, x, y, z, ex, ey, ez ) );
+    }
+#endif
+    template<bool Box> inline
+    void Cull(
+        const Vector3* a, const float* radii, const Vector3* b,
+        unsigned char* visible, size_t count
+    ) const {
+        size_t i = 0;
+#if defined(RAYMATH_CPP_AVX)
+        Planes8 p;
+        Broadcast( &p );
+        for( ; i + 8 <= count; i += 8 ) {
+            visible[i / 8] = (unsigned char)Mask8<Box>( p,
+                a + i, Box ? radii : radii + i, Box ? b + i : b );
+        }
+#elif defined(RAYMATH_CPP_SSE2)
+        Planes4 p;
+        Broadcast( &p );
+        for( ; i + 8 <= count; i += 8 ) {
+            int low  = Mask4<Box>( p, a + i, Box ? radii : radii + i, Box ? b + i : b );
+            int high = Mask4<Box>( p, a + i + 4, Box ? radii : radii + i + 4, Box ? b + i + 4 : b );
+            visible[i / 8] = (unsigned char)( low | ( high << 4 ) );
+        }
+#endif
+        for( ; i < count; ++i ) {
+            if( i % 8 == 0 ) {
+                visible[i / 8] = 0;
+            }
+            bool inside = Box ?
+                IntersectsBox( a[i], b[i] ) :
+                IntersectsSphere( a[i], radii[i] );
+            visible[i / 8] |= (unsigned char)( inside << ( i % 8 ) );
+        }
+    }
+};
+
+// NOTE(alicia): rays.
+// triangles use Moller-Trumbore, two sided, with the same rejections as
+// GetRayCollisionTriangle (|det| < EPSILON, distance <= EPSILON).
+// boxes use the slab test on the inverse direction, the distance is 0
+// when the ray starts inside the box.
+// misses write INFINITY to distance.
+// Ray3 tests one ray against one primitive or against arrays of them,
+// RayPacket tests Width rays against one primitive. both go through
+// RayKernel 4 (SSE2) or 8 (AVX) lanes at a time, the scalar versions
+// use the same operations in the same order. every path agrees bit for
+// bit only when the compiler doesn't fuse a*b + c, see RAYMATH_CPP_NO_FMA.
+// with FMA, GCC in gnu++ mode contracts on its own and picks products
+// per inlining context, so a single triangle test (and every loop tail)
+// runs in lane 0 of the SSE2 kernel to stay close to the lanes, about
+// 2 ns slower. the box test has no a*b + c to contract.
+struct RayKernel {
+    static inline
+    bool Triangle(
+        Vector3 position, Vector3 direction,
+        Vector3 a, Vector3 b, Vector3 c, float* distance
+    ) {
+#if defined(RAYMATH_CPP_SSE2) && defined(RAYMATH_CPP_FMA)
+        __m128 p[3], d[3], va[3], vb[3], vc[3], t;
+        Broadcast( position, p );
+        Broadcast( direction, d );
+        Broadcast( a, va );
+        Broadcast( b, vb );
+        Broadcast( c, vc );
+        bool hit = ( _mm_movemask_ps( Triangle( p, d, va, vb, vc, &t ) ) & 1 ) != 0;
+        *distance = _mm_cvtss_f32( t );
+        return hit;
+#else
+        float e1x = b.x - a.x, e1y = b.y - a.y, e1z = b.z - a.z;
+        float e2x = c.x - a.x, e2y = c.y - a.y, e2z = c.z - a.z;
+        float hx = direction.y*e2z - direction.z*e2y;
+        float hy = direction.z*e2x - direction.x*e2z;
+        float hz = direction.x*e2y - direction.y*e2x;
+        float det = e1x*hx + e1y*hy + e1z*hz;
+        float inv = 1.0f/det;
+        float sx = position.x - a.x, sy = position.y - a.y, sz = position.z - a.z;
+        float u = ( sx*hx + sy*hy + sz*hz )*inv;
+        float qx = sy*e1z - sz*e1y;
+        float qy = sz*e1x - sx*e1z;
+        float qz = sx*e1y - sy*e1x;
+        float v = ( direction.x*qx + direction.y*qy + direction.z*qz )*inv;
+        float t = ( e2x*qx + e2y*qy + e2z*qz )*inv;
+        // NOTE(alicia): written as the lane masks are, NaN misses.
+        bool hit = ( fabsf( det ) >= EPSILON ) &&
+            ( u >= 0.0f ) && ( u <= 1.0f ) && ( v >= 0.0f ) && ( u + v <= 1.0f ) &&
+            ( t > EPSILON );
+        *distance = hit ? t : INFINITY;
+        return hit;
+#endif
+    }
+    static inline
+    bool Box(
+        Vector3 position, Vector3 inverseDirection,
+        Vector3 min, Vector3 max, float* distance
+    ) {
+        float tNear = 0.0f, tFar = INFINITY;
+        Slab( position.x, inverseDirection.x, min.x, max.x, &tNear, &tFar );
+        Slab( position.y, inverseDirection.y, min.y, max.y, &tNear, &tFar );
+        Slab( position.z, inverseDirection.z, min.z, max.z, &tNear, &tFar );
+        bool hit = ( tNear <= tFar ) && ( tNear < INFINITY );
+        *distance = hit ? tNear : INFINITY;
+        return hit;
+    }
+    static inline
+    Vector3 Inverse( Vector3 direction ) {
+        return Vector3{ 1.0f/direction.x, 1.0f/direction.y, 1.0f/direction.z };
+    }
+
+#if defined(RAYMATH_CPP_SSE2)
+    static inline
+    void Broadcast( Vector3 v, __m128* out ) {
+        out[0] = _mm_set1_ps( v.x );
+        out[1] = _mm_set1_ps( v.y );
+        out[2] = _mm_set1_ps( v.z );
+    }
+    /// p, d, a, b, c are x, y, z registers. all-ones lanes for hits.
+    static inline
+    __m128 Triangle(
+        const __m128* p, const __m128* d,
+        const __m128* a, const __m128* b, const __m128* c, __m128* distance
+    ) {
+        __m128 e1x = _mm_sub_ps( b[0], a[0] ), e1y = _mm_sub_ps( b[1], a[1] ), e1z = _mm_sub_ps( b[2], a[2] );
+        __m128 e2x = _mm_sub_ps( c[0], a[0] ), e2y = _mm_sub_ps( c[1], a[1] ), e2z = _mm_sub_ps( c[2], a[2] );
+        __m128 hx = _mm_sub_ps( _mm_mul_ps( d[1], e2z ), _mm_mul_ps( d[2], e2y ) );
+        __m128 hy = _mm_sub_ps( _mm_mul_ps( d[2], e2x ), _mm_mul_ps( d[0], e2z ) );
+        __m128 hz = _mm_sub_ps( _mm_mul_ps( d[0], e2y ), _mm_mul_ps( d[1], e2x ) );
+        __m128 det = Dot( e1x, e1y, e1z, hx, hy, hz );
+        __m128 inv = _mm_div_ps( _mm_set1_ps( 1.0f ), det );
+        __m128 sx = _mm_sub_ps( p[0], a[0] ), sy = _mm_sub_ps( p[1], a[1] ), sz = _mm_sub_ps( p[2], a[2] );
+        __m128 u  = _mm_mul_ps( Dot( sx, sy, sz, hx, hy, hz ), inv );
+        __m128 qx = _mm_sub_ps( _mm_mul_ps( sy, e1z ), _mm_mul_ps( sz, e1y ) );
+        __m128 qy = _mm_sub_ps( _mm_mul_ps( sz, e1x ), _mm_mul_ps( sx, e1z ) );
+        __m128 qz = _mm_sub_ps( _mm_mul_ps( sx, e1y ), _mm_mul_ps( sy, e1x ) );
+        __m128 v  = _mm_mul_ps( Dot( d[0], d[1], d[2], qx, qy, qz ), inv );
+        __m128 t  = _mm_mul_ps( Dot( e2x, e2y, e2z, qx, qy, qz ), inv );
+
+        __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps( 1.0f );
+        __m128 epsilon = _mm_set1_ps( EPSILON );
+        __m128 hit = _mm_cmpge_ps( _mm_andnot_ps( _mm_set1_ps( -0.0f ), det ), epsilon );
+        hit = _mm_and_ps( hit, _mm_and_ps( _mm_cmpge_ps( u, zero ), _mm_cmple_ps( u, one ) ) );
+        hit = _mm_and_ps( hit, _mm_and_ps( _mm_cmpge_ps( v, zero ), _mm_cmple_ps( _mm_add_ps( u, v ), one ) ) );
+        hit = _mm_and_ps( hit, _mm_cmpgt_ps( t, epsilon ) );
+        *distance = Simd4::Select( hit, t, _mm_set1_ps( INFINITY ) );
+        return hit;
+    }
+    /// p, inverse, min, max are x, y, z registers. all-ones lanes for hits.
+    static inline
+    __m128 Box(
+        const __m128* p, const __m128* inverse,
+        const __m128* min, const __m128* max, __m128* distance
+    ) {
+        __m128 infinity = _mm_set1_ps( INFINITY );
+        __m128 tNear = _mm_setzero_ps(), tFar = infinity;
+        for( int i = 0; i < 3; ++i ) {
+            __m128 t1 = _mm_mul_ps( _mm_sub_ps( min[i], p[i] ), inverse[i] );
+            __m128 t2 = _mm_mul_ps( _mm_sub_ps( max[i], p[i] ), inverse[i] );
+            tNear = _mm_max_ps( _mm_min_ps( t1, t2 ), tNear );
+            tFar  = _mm_min_ps( _mm_max_ps( t1, t2 ), tFar );
+        }
+        __m128 hit = _mm_and_ps( _mm_cmple_ps( tNear, tFar ), _mm_cmplt_ps( tNear, infinity ) );
+        *distance = Simd4::Select( hit, tNear, infinity );
+        return hit;
+    }
+#endif
+#if defined(RAYMATH_CPP_AVX)
+    static inline
+    void Broadcast( Vector3 v, __m256* out ) {
+        out[0] = _mm256_set1_ps( v.x );
+        out[1] = _mm256_set1_ps( v.y );
+        out[2] = _mm256_set1_ps( v.z );
+    }
+    static inline
+    __m256 Triangle(
+        const __m256* p, const __m256* d,
+        const __m256* a, const __m256* b, const __m256* c, __m256* distance
+    ) {
+        __m256 e1x = _mm256_sub_ps( b[0], a[0] ), e1y = _mm256_sub_ps( b[1], a[1] ), e1z = _mm256_sub_ps( b[2], a[2] );
+        __m256 e2x = _mm256_sub_ps( c[0], a[0] ), e2y = _mm256_sub_ps( c[1], a[1] ), e2z = _mm256_sub_ps( c[2], a[2] );
+        __m256 hx = _mm256_sub_ps( _mm256_mul_ps( d[1], e2z ), _mm256_mul_ps( d[2], e2y ) );
+        __m256 hy = _mm256_sub_ps( _mm256_mul_ps( d[2], e2x ), _mm256_mul_ps( d[0], e2z ) );
+        __m256 hz = _mm256_sub_ps( _mm256_mul_ps( d[0], e2y ), _mm256_mul_ps( d[1], e2x ) );
+        __m256 det = Dot( e1x, e1y, e1z, hx, hy, hz );
+        __m256 inv = _mm256_div_ps( _mm256_set1_ps( 1.0f ), det );
+        __m256 sx = _mm256_sub_ps( p[0], a[0] ), sy = _mm256_sub_ps( p[1], a[1] ), sz = _mm256_sub_ps( p[2], a[2] );
+        __m256 u  = _mm256_mul_ps( Dot( sx, sy, sz, hx, hy, hz ), inv );
+        __m256 qx = _mm256_sub_ps( _mm256_mul_ps( sy, e1z ), _mm256_mul_ps( sz, e1y ) );
+        __m256 qy = _mm256_sub_ps( _mm256_mul_ps( sz, e1x ), _mm256_mul_ps( sx, e1z ) );
+        __m256 qz = _mm256_sub_ps( _mm256_mul_ps( sx, e1y ), _mm256_mul_ps( sy, e1x ) );
+        __m256 v  = _mm256_mul_ps( Dot( d[0], d[1], d[2], qx, qy, qz ), inv );
+        __m256 t  = _mm256_mul_ps( Dot( e2x, e2y, e2z, qx, qy, qz ), inv );
+
+        __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps( 1.0f );
+        __m256 epsilon = _mm256_set1_ps( EPSILON );
+        __m256 hit = _mm256_cmp_ps( _mm256_andnot_ps( _mm256_set1_ps( -0.0f ), det ), epsilon, _CMP_GE_OQ );
+        hit = _mm256_and_ps( hit, _mm256_and_ps(
+            _mm256_cmp_ps( u, zero, _CMP_GE_OQ ), _mm256_cmp_ps( u, one, _CMP_LE_OQ ) ) );
+        hit = _mm256_and_ps( hit, _mm256_and_ps(
+            _mm256_cmp_ps( v, zero, _CMP_GE_OQ ), _mm256_cmp_ps( _mm256_add_ps( u, v ), one, _CMP_LE_OQ ) ) );
+        hit = _mm256_and_ps( hit, _mm256_cmp_ps( t, epsilon, _CMP_GT_OQ ) );
+        *distance = _mm256_blendv_ps( _mm256_set1_ps( INFINITY ), t, hit );
+        return hit;
+    }
+    static inline
+    __m256 Box(
+        const __m256* p, const __m256* inverse,
+        const __m256* min, const __m256* max, __m256* distance
+    ) {
+        __m256 infinity = _mm256_set1_ps( INFINITY );
+        __m256 tNear = _mm256_setzero_ps(), tFar = infinity;
+        for( int i = 0; i < 3; ++i ) {
+            __m256 t1 = _mm256_mul_ps( _mm256_sub_ps( min[i], p[i] ), inverse[i] );
+            __m256 t2 = _mm256_mul_ps( _mm256_sub_ps( max[i], p[i] ), inverse[i] );
+            tNear = _mm256_max_ps( _mm256_min_ps( t1, t2 ), tNear );
+            tFar  = _mm256_min_ps( _mm256_max_ps( t1, t2 ), tFar );
+        }
+        __m256 hit = _mm256_and_ps(
+            _mm256_cmp_ps( tNear, tFar, _CMP_LE_OQ ), _mm256_cmp_ps( tNear, infinity, _CMP_LT_OQ ) );
+        *distance = _mm256_blendv_ps( infinity, tNear, hit );
+        return hit;
+    }
+#endif
+
+private:
+    // NOTE(alicia): same results as _mm_min_ps/_mm_max_ps, including NaN,
+    // so a NaN slab (zero direction on the slab boundary) is skipped.
+    static inline
+    void Slab( float p, float inverse, float min, float max, float* tNear, float* tFar ) {
+        float t1 = ( min - p )*inverse;
+        float t2 = ( max - p )*inverse;
+        float lo = t1 < t2 ? t1 : t2;
+        float hi = t1 > t2 ? t1 : t2;
+        *tNear = lo > *tNear ? lo : *tNear;
+        *tFar  = hi < *tFar  ? hi : *tFar;
+    }
+#if defined(RAYMATH_CPP_SSE2)
+    static inline
+    __m128 Dot( __m128 ax, __m128 ay, __m128 az, __m128 bx, __m128 by, __m128 bz ) {
+        return _mm_add_ps( _mm_add_ps( _mm_mul_ps( ax, bx ), _mm_mul_ps( ay, by ) ), _mm_mul_ps( az, bz ) );
+    }
+#endif
+#if defined(RAYMATH_CPP_AVX)
+    static inline
+    __m256 Dot( __m256 ax, __m256 ay, __m256 az, __m256 bx, __m256 by, __m256 bz ) {
+        return _mm256_add_ps( _mm256_add_ps(
+            _mm256_mul_ps( ax, bx ), _mm256_mul_ps( ay, by ) ), _mm256_mul_ps( az, bz ) );
+    }
+#endif
+};
+
+struct Ray3 {
+    Vec3 position;
+    Vec3 direction;
+
+    RAYMATH_CPP_CONSTEXPR Ray3() {}
+    RAYMATH_CPP_CONSTEXPR Ray3( Vector3 position, Vector3 direction ) :
+        position( position ), direction( direction ) {}
+
+    /// position + direction * distance.
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 At( float distance ) const {
+        return Vec3(
+            position.x + direction.x*distance,
+            position.y + direction.y*distance,
+            position.z + direction.z*distance );
+    }
+    /// Distance is in units of direction, normalize it for world units.
+    inline
+    bool IntersectTriangle( Vector3 a, Vector3 b, Vector3 c, float* distance ) const {
+        return RayKernel::Triangle( position, direction, a, b, c, distance );
+    }
+    inline
+    bool IntersectBox( Vector3 min, Vector3 max, float* distance ) const {
+        return RayKernel::Box( position, RayKernel::Inverse( direction ), min, max, distance );
+    }
+
+    /// Triangles as a[i], b[i], c[i]. bit i % 8 of hit[i / 8] is set for hits.
+    inline
+    void IntersectTriangles(
+        const Vector3* a, const Vector3* b, const Vector3* c,
+        float* distance, unsigned char* hit, size_t count
+    ) const {
+        size_t i = 0;
+#if defined(RAYMATH_CPP_AVX)
+        __m256 p[3], d[3];
+        RayKernel::Broadcast( position, p );
+        RayKernel::Broadcast( direction, d );
+        for( ; i + 8 <= count; i += 8 ) {
+            __m256 va[3], vb[3], vc[3], t;
+            Simd4::Load( a + i, va + 0, va + 1, va + 2 );
+            Simd4::Load( b + i, vb + 0, vb + 1, vb + 2 );
+            Simd4::Load( c + i, vc + 0, vc + 1, vc + 2 );
+            hit[i / 8] = (unsigned char)_mm256_movemask_ps( RayKernel::Triangle( p, d, va, vb, vc, &t ) );
+            _mm256_storeu_ps( distance + i, t );
+        }
+#elif defined(RAYMATH_CPP_SSE2)
+        __m128 p[3], d[3];
+        RayKernel::Broadcast( position, p );
+        RayKernel::Broadcast( direction, d );
+        for( ; i + 8 <= count; i += 8 ) {
+            int mask = 0;
+            for( size_t half = 0; half < 8; half += 4 ) {
+                __m128 va[3], vb[3], vc[3], t;
+                Simd4::Load( a + i + half, va + 0, va + 1, va + 2 );
+                Simd4::Load( b + i + half, vb + 0, vb + 1, vb + 2 );
+                Simd4::Load( c + i + half, vc + 0, vc + 1, vc + 2 );
+                mask |= _mm_movemask_ps( RayKernel::Triangle( p, d, va, vb, vc, &t ) ) << half;
+                _mm_storeu_ps( distance + i + half, t );
+            }
+            hit[i / 8] = (unsigned char)mask;
+        }
+#endif
+        for( ; i < count; ++i ) {
+            if( i % 8 == 0 ) {
+                hit[i / 8] = 0;
+            }
+            bool result = IntersectTriangle( a[i], b[i], c[i], distance + i );
+            hit[i / 8] |= (unsigned char)( result << ( i % 8 ) );
+        }
+    }
+    /// Boxes as min[i], max[i]. bit i % 8 of hit[i / 8] is set for hits.
+    inline
+    void IntersectBoxes(
+        const Vector3* min, const Vector3* max,
+        float* distance, unsigned char* hit, size_t count
+    ) const {
+        Vector3 inverse = RayKernel::Inverse( direction );
+        size_t i = 0;
+#if defined(RAYMATH_CPP_AVX)
+        __m256 p[3], inv[3];
+        RayKernel::Broadcast( position, p );
+        RayKernel::Broadcast( inverse, inv );
+        for( ; i + 8 <= count; i += 8 ) {
+            __m256 lo[3], hi[3], t;
+            Simd4::Load( min + i, lo + 0, lo + 1, lo + 2 );
+            Simd4::Load( max + i, hi + 0, hi + 1, hi + 2 );
+            hit[i / 8] = (unsigned char)_mm256_movemask_ps( RayKernel::Box( p, inv, lo, hi, &t ) );
+            _mm256_storeu_ps( distance + i, t );
+        }
+#elif defined(RAYMATH_CPP_SSE2)
+        __m128 p[3], inv[3];
+        RayKernel::Broadcast( position, p );
+        RayKernel::Broadcast( inverse, inv );
+        for( ; i + 8 <= count; i += 8 ) {
+            int mask = 0;
+            for( size_t half = 0; half < 8; half += 4 ) {
+                __m128 lo[3], hi[3], t;
+                Simd4::Load( min + i + half, lo + 0, lo + 1, lo + 2 );
+                Simd4::Load( max + i + half, hi + 0, hi + 1, hi + 2 );
+                mask |= _mm_movemask_ps( RayKernel::Box( p, inv, lo, hi, &t ) ) << half;
+                _mm_storeu_ps( distance + i + half, t );
+            }
+            hit[i / 8] = (unsigned char)mask;
+        }
+#endif
+        for( ; i < count; ++i ) {
+            if( i % 8 == 0 ) {
+                hit[i / 8] = 0;
+            }
+            bool result = RayKernel::Box( position, inverse, min[i], max[i], distance + i );
+            hit[i / 8] |= (unsigned char)( result << ( i % 8 ) );
+        }
+    }
+    inline
+    void IntersectTriangles(
+        const Vec3* a, const Vec3* b, const Vec3* c,
+        float* distance, unsigned char* hit, size_t count
+    ) const {
+        IntersectTriangles( (const Vector3*)a, (const Vector3*)b, (const Vector3*)c, distance, hit, count );
+    }
+    inline
+    void IntersectBoxes(
+        const Vec3* min, const Vec3* max,
+        float* distance, unsigned char* hit, size_t count
+    ) const {
+        IntersectBoxes( (const Vector3*)min, (const Vector3*)max, distance, hit, count );
+    }
+};
+
+/// Width rays as separate component arrays, Width a multiple of 4 up to 32.
+/// lane i of the result masks is bit i.
+template<size_t Width>
+struct RayPacket {
+    static_assert( Width % 4 == 0 && Width <= 32, "RayPacket width must be 4, 8, ... 32" );
+    alignas(32) float px[Width];
+    alignas(32) float py[Width];
+    alignas(32) float pz[Width];
+    alignas(32) float dx[Width];
+    alignas(32) float dy[Width];
+    alignas(32) float dz[Width];
+    /// 1 / direction, kept for the box test.
+    alignas(32) float ix[Width];
+    alignas(32) float iy[Width];
+    alignas(32) float iz[Width];
+
+    RayPacket() {}
+    /// Width rays from rays[0] .. rays[Width - 1].
+    explicit RayPacket( const Ray3* rays ) {
+        for( size_t i = 0; i < Width; ++i ) {
+            Set( i, rays[i] );
+        }
+    }
+
+    inline
+    void Set( size_t lane, const Ray3& ray ) {
+        Vector3 inverse = RayKernel::Inverse( ray.direction );
+        px[lane] = ray.position.x;  py[lane] = ray.position.y;  pz[lane] = ray.position.z;
+        dx[lane] = ray.direction.x; dy[lane] = ray.direction.y; dz[lane] = ray.direction.z;
+        ix[lane] = inverse.x;       iy[lane] = inverse.y;       iz[lane] = inverse.z;
+    }
+    inline
+    Ray3 Get( size_t lane ) const {
+        return Ray3(
+            Vector3{ px[lane], py[lane], pz[lane] },
+            Vector3{ dx[lane], dy[lane], dz[lane] } );
+    }
+
+    /// distance[lane] for every ray, returns the hit lanes.
+    inline
+    unsigned int IntersectTriangle( Vector3 a, Vector3 b, Vector3 c, float* distance ) const {
+        unsigned int mask = 0;
+        size_t i = 0;
+#if defined(RAYMATH_CPP_AVX)
+        __m256 a8[3] = { _mm256_set1_ps( a.x ), _mm256_set1_ps( a.y ), _mm256_set1_ps( a.z ) };
+        __m256 b8[3] = { _mm256_set1_ps( b.x ), _mm256_set1_ps( b.y ), _mm256_set1_ps( b.z ) };
+        __m256 c8[3] = { _mm256_set1_ps( c.x ), _mm256_set1_ps( c.y ), _mm256_set1_ps( c.z ) };
+        for( ; i + 8 <= Width; i += 8 ) {
+            __m256 p[3] = { _mm256_loadu_ps( px + i ), _mm256_loadu_ps( py + i ), _mm256_loadu_ps( pz + i ) };
+            __m256 d[3] = { _mm256_loadu_ps( dx + i ), _mm256_loadu_ps( dy + i ), _mm256_loadu_ps( dz + i ) };
+            __m256 t;
+            mask |= (unsigned int)_mm256_movemask_ps( RayKernel::Triangle( p, d, a8, b8, c8, &t ) ) << i;
+            _mm256_storeu_ps( distance + i, t );
+        }
+#endif
+#if defined(RAYMATH_CPP_SSE2)
+        __m128 a4[3] = { _mm_set1_ps( a.x ), _mm_set1_ps( a.y ), _mm_set1_ps( a.z ) };
+        __m128 b4[3] = { _mm_set1_ps( b.x ), _mm_set1_ps( b.y ), _mm_set1_ps( b.z ) };
+        __m128 c4[3] = { _mm_set1_ps( c.x ), _mm_set1_ps( c.y ), _mm_set1_ps( c.z ) };
+        for( ; i + 4 <= Width; i += 4 ) {
+            __m128 p[3] = { _mm_loadu_ps( px + i ), _mm_loadu_ps( py + i ), _mm_loadu_ps( pz + i ) };
+            __m128 d[3] = { _mm_loadu_ps( dx + i ), _mm_loadu_ps( dy + i ), _mm_loadu_ps( dz + i ) };
+            __m128 t;
+            mask |= (unsigned int)_mm_movemask_ps( RayKernel::Triangle( p, d, a4, b4, c4, &t ) ) << i;
+            _mm_storeu_ps( distance + i, t );
+        }
+#else
+        for( ; i < Width; ++i ) {
+            bool hit = RayKernel::Triangle(
+                Vector3{ px[i], py[i], pz[i] }, Vector3{ dx[i], dy[i], dz[i] },
+                a, b, c, distance + i );
+            mask |= (unsigned int)hit << i;
+        }
+#endif
+        return mask;
+    }
+    /// distance[lane] for every ray, returns the hit lanes.
+    inline
+    unsigned int IntersectBox( Vector3 min, Vector3 max, float* distance ) const {
+        unsigned int mask = 0;
+        size_t i = 0;
+#if defined(RAYMATH_CPP_AVX)
+        __m256 min8[3] = { _mm256_set1_ps( min.x ), _mm256_set1_ps( min.y ), _mm256_set1_ps( min.z ) };
+        __m256 max8[3] = { _mm256_set1_ps( max.x ), _mm256_set1_ps( max.y ), _mm256_set1_ps( max.z ) };
+        for( ; i + 8 <= Width; i += 8 ) {
+            __m256 p[3]   = { _mm256_loadu_ps( px + i ), _mm256_loadu_ps( py + i ), _mm256_loadu_ps( pz + i ) };
+            __m256 inv[3] = { _mm256_loadu_ps( ix + i ), _mm256_loadu_ps( iy + i ), _mm256_loadu_ps( iz + i ) };
+            __m256 t;
+            mask |= (unsigned int)_mm256_movemask_ps( RayKernel::Box( p, inv, min8, max8, &t ) ) << i;
+            _mm256_storeu_ps( distance + i, t );
+        }
+#endif
+#if defined(RAYMATH_CPP_SSE2)
+        __m128 min4[3] = { _mm_set1_ps( min.x ), _mm_set1_ps( min.y ), _mm_set1_ps( min.z ) };
+        __m128 max4[3] = { _mm_set1_ps( max.x ), _mm_set1_ps( max.y ), _mm_set1_ps( max.z ) };
+        for( ; i + 4 <= Width; i += 4 ) {
+            __m128 p[3]   = { _mm_loadu_ps( px + i ), _mm_loadu_ps( py + i ), _mm_loadu_ps( pz + i ) };
+            __m128 inv[3] = { _mm_loadu_ps( ix + i ), _mm_loadu_ps( iy + i ), _mm_loadu_ps( iz + i ) };
+            __m128 t;
+            mask |= (unsigned int)_mm_movemask_ps( RayKernel::Box( p, inv, min4, max4, &t ) ) << i;
+            _mm_storeu_ps( distance + i, t );
+        }
+#else
+        for( ; i < Width; ++i ) {
+            bool hit = RayKernel::Box(
+                Vector3{ px[i], py[i], pz[i] }, Vector3{ ix[i], iy[i], iz[i] },
+                min, max, distance + i );
+            mask |= (unsigned int)hit << i;
+        }
+#endif
+        return mask;
+    }
+};
+typedef RayPacket<4> RayPacket4;
+typedef RayPacket<8> RayPacket8;
+
+#if !defined(RAYMATH_CPP_NO_STDLIB)
+#if defined(RAYMATH_CPP_PARALLEL)
+struct ThreadPool;
+#endif
+// NOTE(alicia): bounding volume hierarchy.
+// built top down with binned SAH over the primitive centroids.
+// nodes are 32 bytes, siblings sit next to each other in one 64 byte
+// line and every child comes after its parent, so Refit is a single
+// backwards pass. primitive boxes are copied in leaf order next to
+// the nodes and tested before the callbacks run.
+// nodes with more than TaskSize primitives are split first (binning
+// in chunks), then every remaining subtree is built on its own into a
+// reserved node range and the ranges are packed together at the end.
+// with a ThreadPool the chunks and subtrees run in parallel, the tree
+// comes out the same for any thread count.
+struct Bvh {
+    /// Inner nodes have count 0 and their children at first and first + 1.
+    /// Leaves cover primitives[first] .. primitives[first + count - 1].
+    /// In primitives, first is the primitive index and count is 1.
+    struct Node {
+        Vector3      min;
+        unsigned int first;
+        Vector3      max;
+        unsigned int count;
+    };
+    static const unsigned int None        = 0xFFFFFFFFu;
+    static const int          Bins        = 16;
+    static const unsigned int MaxLeafSize = 8;
+    static const unsigned int TaskSize    = 4096;
+    /// Deeper nodes split at the median, queries keep a stack of 2 * MaxDepth.
+    static const int          MaxDepth    = 64;
+
+    Node*  nodes          = nullptr;
+    size_t nodeCount      = 0;
+    Node*  primitives     = nullptr;
+    size_t primitiveCount = 0;
+
+    Bvh() {}
+    Bvh( const Bvh& ) = delete;
+    Bvh& operator=( const Bvh& ) = delete;
+    Bvh( Bvh&& other ) :
+        nodes(other.nodes), nodeCount(other.nodeCount),
+        primitives(other.primitives), primitiveCount(other.primitiveCount),
+        block(other.block)
+    {
+        other.nodes = other.primitives = nullptr;
+        other.nodeCount = other.primitiveCount = 0;
+        other.block = nullptr;
+    }
+    Bvh& operator=( Bvh&& other ) {
+        if( this != &other ) {
+            std::free( block );
+            nodes          = other.nodes;
+            nodeCount      = other.nodeCount;
+            primitives     = other.primitives;
+            primitiveCount = other.primitiveCount;
+            block          = other.block;
+            other.nodes = other.primitives = nullptr;
+            other.nodeCount = other.primitiveCount = 0;
+            other.block = nullptr;
+        }
+        return *this;
+    }
+    ~Bvh() {
+        std::free( block );
+    }
+
+    /// Primitive boxes as min[i], max[i]. false if out of memory.
+    inline
+    bool Build( const Vector3* min, const Vector3* max, size_t count ) {
+        Serial serial;
+        return BuildWith( serial, min, max, count );
+    }
+#if defined(RAYMATH_CPP_PARALLEL)
+    inline
+    bool Build( ThreadPool& pool, const Vector3* min, const Vector3* max, size_t count );
+    inline
+    bool Build( ThreadPool& pool, const Vec3* min, const Vec3* max, size_t count ) {
+        return Build( pool, (const Vector3*)min, (const Vector3*)max, count );
+    }
+#endif
+    /// New boxes for the same primitives, the tree shape is kept.
+    inline
+    void Refit( const Vector3* min, const Vector3* max ) {
+        for( size_t i = 0; i < primitiveCount; ++i ) {
+            primitives[i].min = min[primitives[i].first];
+            primitives[i].max = max[primitives[i].first];
+        }
+        for( size_t i = nodeCount; i-- > 0; ) {
+            Node& node = nodes[i];
+            if( i == 1 ) {
+                continue;
+            }
+            const Node* children = node.count ? primitives + node.first : nodes + node.first;
+            size_t      n        = node.count ? node.count : 2;
+            node.min = children[0].min;
+            node.max = children[0].max;
+            for( size_t c = 1; c < n; ++c ) {
+                node.min = Vector3Min( node.min, children[c].min );
+                node.max = Vector3Max( node.max, children[c].max );
+            }
+        }
+    }
+    inline
+    bool Build( const Vec3* min, const Vec3* max, size_t count ) {
+        return Build( (const Vector3*)min, (const Vector3*)max, count );
+    }
+    inline
+    void Refit( const Vec3* min, const Vec3* max ) {
+        Refit( (const Vector3*)min, (const Vector3*)max );
+    }
+
+    /// Closest hit along ray. intersect( primitive, boxDistance ) returns
+    /// the hit distance or INFINITY, it only runs for primitives whose box
+    /// the ray enters (at boxDistance) before the closest hit so far.
+    /// *distance is the max distance going in, the hit distance coming out.
+    /// Returns the primitive or None.
+    template<typename Fn>
+    unsigned int Raycast( const Ray3& ray, float* distance, const Fn& intersect ) const {
+        unsigned int result = None;
+        if( !nodeCount ) {
+            return result;
+        }
+        Vector3 inverse = RayKernel::Inverse( ray.direction );
+        float   best    = *distance;
+        struct Entry {
+            unsigned int node;
+            float        distance;
+        } stack[2 * MaxDepth];
+        int size = 0;
+        float t;
+        if( RayKernel::Box( ray.position, inverse, nodes[0].min, nodes[0].max, &t ) && t < best ) {
+            stack[size++] = Entry{ 0, t };
+        }
+        while( size ) {
+            Entry entry = stack[--size];
+            if( entry.distance >= best ) {
+                continue;
+            }
+            const Node& node = nodes[entry.node];
+            if( node.count ) {
+                for( unsigned int i = node.first; i < node.first + node.count; ++i ) {
+                    const Node& primitive = primitives[i];
+                    if( RayKernel::Box( ray.position, inverse, primitive.min, primitive.max, &t ) && t < best ) {
+                        float hit = intersect( primitive.first, t );
+                        if( hit < best ) {
+                            best   = hit;
+                            result = primitive.first;
+                        }
+                    }
+                }
+                continue;
+            }
+            float near, far;
+            bool hitLeft  = RayKernel::Box( ray.position, inverse,
+                nodes[node.first].min, nodes[node.first].max, &near ) && near < best;
+            bool hitRight = RayKernel::Box( ray.position, inverse,
+                nodes[node.first + 1].min, nodes[node.first + 1].max, &far ) && far < best;
+            unsigned int first = node.first, second = node.first + 1;
+            if( hitLeft && hitRight && far < near ) {
+                float swap = near; near = far; far = swap;
+                first = node.first + 1; second = node.first;
+            }
+            // NOTE(alicia): far child first so the near one pops next.
+            if( hitLeft && hitRight ) {
+                stack[size++] = Entry{ second, far };
+                stack[size++] = Entry{ first, near };
+            } else if( hitLeft ) {
+                stack[size++] = Entry{ node.first, near };
+            } else if( hitRight ) {
+                stack[size++] = Entry{ node.first + 1, far };
+            }
+        }
+        if( result != None ) {
+            *distance = best;
+        }
+        return result;
+    }
+    /// Closest primitive box along ray.
+    inline
+    unsigned int Raycast( const Ray3& ray, float* distance ) const {
+        return Raycast( ray, distance, []( unsigned int, float boxDistance ) {
+            return boxDistance;
+        } );
+    }
+    /// Closest triangle along ray, triangle i is a[i], b[i], c[i].
+    inline
+    unsigned int Raycast(
+        const Ray3& ray, const Vector3* a, const Vector3* b, const Vector3* c, float* distance
+    ) const {
+        return Raycast( ray, distance, [&]( unsigned int primitive, float ) {
+            float t;
+            ray.IntersectTriangle( a[primitive], b[primitive], c[primitive], &t );
+            return t;
+        } );
+    }
+    inline
+    unsigned int Raycast(
+        const Ray3& ray, const Vec3* a, const Vec3* b, const Vec3* c, float* distance
+    ) const {
+        return Raycast( ray, (const Vector3*)a, (const Vector3*)b, (const Vector3*)c, distance );
+    }
+
+    /// Calls fn( primitive ) for every primitive box overlapping min, max.
+    /// Returns how many there were.
+    template<typename Fn>
+    size_t Overlap( Vector3 min, Vector3 max, const Fn& fn ) const {
+        size_t result = 0;
+        if( !nodeCount ) {
+            return result;
+        }
+        unsigned int stack[2 * MaxDepth];
+        int size = 0;
+        stack[size++] = 0;
+        while( size ) {
+            const Node& node = nodes[stack[--size]];
+            if( !Overlaps( node, min, max ) ) {
+                continue;
+            }
+            if( node.count ) {
+                for( unsigned int i = node.first; i < node.first + node.count; ++i ) {
+                    if( Overlaps( primitives[i], min, max ) ) {
+                        fn( primitives[i].first );
+                        ++result;
+                    }
+                }
+                continue;
+            }
+            stack[size++] = node.first + 1;
+            stack[size++] = node.first;
+        }
+        return result;
+    }
+    /// Writes up to capacity primitives to out, returns how many overlap.
+    inline
+    size_t Overlap( Vector3 min, Vector3 max, unsigned int* out, size_t capacity ) const {
+        size_t written = 0;
+        return Overlap( min, max, [&]( unsigned int primitive ) {
+            if( written < capacity ) {
+                out[written++] = primitive;
+            }
+        } );
+    }
+
+    /// Closest primitive to point. distanceSqr( primitive, boxDistanceSqr )
+    /// returns the squared distance, it only runs for primitives whose box
+    /// is closer than the best so far. *bestSqr is the max squared distance
+    /// going in, the closest squared distance coming out.
+    /// Returns the primitive or None.
+    template<typename Fn>
+    unsigned int Nearest( Vector3 point, float* bestSqr, const Fn& distanceSqr ) const {
+        unsigned int result = None;
+        if( !nodeCount ) {
+            return result;
+        }
+        float best = *bestSqr;
+        struct Entry {
+            unsigned int node;
+            float        distanceSqr;
+        } stack[2 * MaxDepth];
+        int size = 0;
+        stack[size++] = Entry{ 0, BoxDistanceSqr( point, nodes[0] ) };
+        while( size ) {
+            Entry entry = stack[--size];
+            if( entry.distanceSqr >= best ) {
+                continue;
+            }
+            const Node& node = nodes[entry.node];
+            if( node.count ) {
+                for( unsigned int i = node.first; i < node.first + node.count; ++i ) {
+                    float box = BoxDistanceSqr( point, primitives[i] );
+                    if( box < best ) {
+                        float d = distanceSqr( primitives[i].first, box );
+                        if( d < best ) {
+                            best   = d;
+                            result = primitives[i].first;
+                        }
+                    }
+                }
+                continue;
+            }
+            float near = BoxDistanceSqr( point, nodes[node.first] );
+            float far  = BoxDistanceSqr( point, nodes[node.first + 1] );
+            if( near <= far ) {
+                stack[size++] = Entry{ node.first + 1, far };
+                stack[size++] = Entry{ node.first, near };
+            } else {
+                stack[size++] = Entry{ node.first, near };
+                stack[size++] = Entry{ node.first + 1, far };
+            }
+        }
+        if( result != None ) {
+            *bestSqr = best;
+        }
+        return result;
+    }
+    /// Closest primitive box to point, 0 inside a box.
+    inline
+    unsigned int Nearest( Vector3 point, float* bestSqr ) const {
+        return Nearest( point, bestSqr, []( unsigned int, float boxDistanceSqr ) {
+            return boxDistanceSqr;
+        } );
+    }
+
+private:
+    // NOTE(alicia): centroids are kept doubled (min + max) throughout.
+    struct alignas(16) Bounds {
+        float min[4];
+        float max[4];
+    };
+    struct BinSet {
+        Bounds       bounds[3][Bins];
+        unsigned int count[3][Bins];
+    };
+    struct Task {
+        Bounds       centroids;
+        unsigned int node;
+        unsigned int first;
+        unsigned int count;
+        int          depth;
+    };
+    struct Serial {
+        template<typename Fn>
+        void For( size_t count, size_t, const Fn& fn ) {
+            if( count ) {
+                fn( (size_t)0, count );
+            }
+        }
+    };
+    static const size_t ChunkSize = 16384;
+
+    void*  block       = nullptr;
+    /// Only set while building.
+    float* centroid[3] = {};
+
+    static inline
+    bool Overlaps( const Node& node, Vector3 min, Vector3 max ) {
+        return node.min.x <= max.x && node.max.x >= min.x &&
+            node.min.y <= max.y && node.max.y >= min.y &&
+            node.min.z <= max.z && node.max.z >= min.z;
+    }
+    static inline
+    float BoxDistanceSqr( Vector3 p, const Node& node ) {
+        float dx = node.min.x - p.x > p.x - node.max.x ? node.min.x - p.x : p.x - node.max.x;
+        float dy = node.min.y - p.y > p.y - node.max.y ? node.min.y - p.y : p.y - node.max.y;
+        float dz = node.min.z - p.z > p.z - node.max.z ? node.min.z - p.z : p.z - node.max.z;
+        dx = dx > 0.0f ? dx : 0.0f;
+        dy = dy > 0.0f ? dy : 0.0f;
+        dz = dz > 0.0f ? dz : 0.0f;
+        return dx*dx + dy*dy + dz*dz;
+    }
+    static inline
+    void Clear( Bounds* b ) {
+        for( int i = 0; i < 4; ++i ) {
+            b->min[i] = INFINITY;
+            b->max[i] = -INFINITY;
+        }
+    }
+    static inline
+    void Grow( Bounds* b, const Bounds& other ) {
+        for( int i = 0; i < 4; ++i ) {
+            b->min[i] = other.min[i] < b->min[i] ? other.min[i] : b->min[i];
+            b->max[i] = other.max[i] > b->max[i] ? other.max[i] : b->max[i];
+        }
+    }
+    static inline
+    float HalfArea( const Bounds& b ) {
+        float dx = b.max[0] - b.min[0], dy = b.max[1] - b.min[1], dz = b.max[2] - b.min[2];
+        return dx*dy + dy*dz + dz*dx;
+    }
+    /// Box and doubled centroid bounds of count primitives.
+    static inline
+    void Measure( const Node* p, size_t count, Bounds* box, Bounds* centroids ) {
+        Clear( box );
+        Clear( centroids );
+        for( size_t i = 0; i < count; ++i ) {
+            const float c[3] = { p[i].min.x + p[i].max.x, p[i].min.y + p[i].max.y, p[i].min.z + p[i].max.z };
+            const float* lo = &p[i].min.x;
+            const float* hi = &p[i].max.x;
+            for( int a = 0; a < 3; ++a ) {
+                box->min[a] = lo[a] < box->min[a] ? lo[a] : box->min[a];
+                box->max[a] = hi[a] > box->max[a] ? hi[a] : box->max[a];
+                centroids->min[a] = c[a] < centroids->min[a] ? c[a] : centroids->min[a];
+                centroids->max[a] = c[a] > centroids->max[a] ? c[a] : centroids->max[a];
+            }
+        }
+    }
+    /// Bin scale per axis, 0 for flat axes. bins are never binCount or above.
+    static inline
+    void Scale( const Bounds& centroids, int binCount, float* scale ) {
+        for( int a = 0; a < 3; ++a ) {
+            float extent = centroids.max[a] - centroids.min[a];
+            scale[a] = extent > 0.0f ? ( (float)binCount * 0.99999f ) / extent : 0.0f;
+        }
+        scale[3] = 0.0f;
+    }
+    /// Same bin as the truncating conversion in BinRange, NaN goes last.
+    static inline
+    unsigned int BinIndex( float centroid, float min, float scale, int binCount ) {
+        float bin = ( centroid - min )*scale;
+        return bin > -1.0f && bin < (float)binCount ? (unsigned int)(int)bin : (unsigned int)binCount - 1;
+    }
+    static inline
+    void ClearBins( BinSet* bins, int binCount ) {
+        for( int a = 0; a < 3; ++a ) {
+            for( int b = 0; b < binCount; ++b ) {
+                Clear( &bins->bounds[a][b] );
+                bins->count[a][b] = 0;
+            }
+        }
+    }
+    /// c are the doubled centroid arrays of p's primitives, one per axis.
+    static inline
+    void BinRange( const Node* p, const float* const* c, size_t count, const Bounds& centroids,
+        const float* scale, int binCount, BinSet* bins
+    ) {
+#if defined(RAYMATH_CPP_SSE2)
+        // NOTE(alicia): bin indices 4 primitives at a time per axis,
+        // out of range and NaN truncate to INT_MIN and go last,
+        // like BinIndex.
+        __m128 mask = _mm_castsi128_ps( _mm_setr_epi32( -1, -1, -1, 0 ) );
+        __m128 cmin[3], s[3];
+        for( int a = 0; a < 3; ++a ) {
+            cmin[a] = _mm_set1_ps( centroids.min[a] );
+            s[a]    = _mm_set1_ps( scale[a] );
+        }
+        alignas(16) int index[3][4];
+        for( size_t i = 0; i < count; i += 4 ) {
+            size_t n = count - i < 4 ? count - i : 4;
+            for( int a = 0; a < 3; ++a ) {
+                if( n == 4 ) {
+                    _mm_store_si128( (__m128i*)index[a], _mm_cvttps_epi32(
+                        _mm_mul_ps( _mm_sub_ps( _mm_loadu_ps( c[a] + i ), cmin[a] ), s[a] ) ) );
+                    continue;
+                }
+                for( size_t k = 0; k < n; ++k ) {
+                    index[a][k] = _mm_cvttss_si32(
+                        _mm_mul_ss( _mm_sub_ss( _mm_set_ss( c[a][i + k] ), cmin[a] ), s[a] ) );
+                }
+            }
+            for( size_t k = 0; k < n; ++k ) {
+                __m128 lo = _mm_and_ps( _mm_loadu_ps( &p[i + k].min.x ), mask );
+                __m128 hi = _mm_and_ps( _mm_loadu_ps( &p[i + k].max.x ), mask );
+                for( int a = 0; a < 3; ++a ) {
+                    unsigned int b = (unsigned int)index[a][k];
+                    b = b < (unsigned int)binCount ? b : (unsigned int)binCount - 1;
+                    Bounds& bin = bins->bounds[a][b];
+                    _mm_store_ps( bin.min, _mm_min_ps( lo, _mm_load_ps( bin.min ) ) );
+                    _mm_store_ps( bin.max, _mm_max_ps( hi, _mm_load_ps( bin.max ) ) );
+                    bins->count[a][b]++;
+                }
+            }
+        }
+#else
+        for( size_t i = 0; i < count; ++i ) {
+            const float* lo = &p[i].min.x;
+            const float* hi = &p[i].max.x;
+            for( int a = 0; a < 3; ++a ) {
+                unsigned int b = BinIndex( c[a][i], centroids.min[a], scale[a], binCount );
+                Bounds& bin = bins->bounds[a][b];
+                for( int k = 0; k < 3; ++k ) {
+                    bin.min[k] = lo[k] < bin.min[k] ? lo[k] : bin.min[k];
+                    bin.max[k] = hi[k] > bin.max[k] ? hi[k] : bin.max[k];
+                }
+                bins->count[a][b]++;
+            }
+        }
+#endif
+    }
+    template<typename Runner>
+    static inline
+    void Bin( Runner& run, const Node* p, const float* const* c, size_t count, const Bounds& centroids,
+        const float* scale, int binCount, BinSet* partial, BinSet* bins
+    ) {
+        ClearBins( bins, binCount );
+        size_t chunks = ( count + ChunkSize - 1 ) / ChunkSize;
+        if( chunks <= 1 ) {
+            BinRange( p, c, count, centroids, scale, binCount, bins );
+            return;
+        }
+        run.For( chunks, 1, [&]( size_t begin, size_t end ) {
+            for( size_t k = begin; k < end; ++k ) {
+                size_t first = k * ChunkSize;
+                const float* chunk[3] = { c[0] + first, c[1] + first, c[2] + first };
+                ClearBins( partial + k, binCount );
+                BinRange( p + first, chunk, count - first < ChunkSize ? count - first : ChunkSize,
+                    centroids, scale, binCount, partial + k );
+            }
+        } );
+        for( size_t k = 0; k < chunks; ++k ) {
+            for( int a = 0; a < 3; ++a ) {
+                for( int b = 0; b < binCount; ++b ) {
+                    Grow( &bins->bounds[a][b], partial[k].bounds[a][b] );
+                    bins->count[a][b] += partial[k].count[a][b];
+                }
+            }
+        }
+    }
+    /// Splits task into left and right, false if it should be a leaf.
+    /// the children get their node boxes written, not their node index.
+    template<typename Runner>
+    inline
+    bool Split( Runner& run, const Task& task, BinSet* partial, Task* left, Task* right ) {
+        if( task.count <= 1 ) {
+            return false;
+        }
+        Node*   p    = primitives + task.first;
+        float*  c[3] = { centroid[0] + task.first, centroid[1] + task.first, centroid[2] + task.first };
+        Bounds  box;
+        for( int a = 0; a < 3; ++a ) {
+            box.min[a] = ( &nodes[task.node].min.x )[a];
+            box.max[a] = ( &nodes[task.node].max.x )[a];
+        }
+        box.min[3] = box.max[3] = 0.0f;
+        if( task.count == 2 && task.depth < MaxDepth ) {
+            return SplitPair( task, box, p, c, left, right );
+        }
+        // NOTE(alicia): small nodes get one bin per primitive, most nodes
+        // are small and the clear and sweep cost goes with the bin count.
+        int   binCount = task.count < (unsigned int)Bins ? (int)task.count : Bins;
+        float scale[4];
+        Scale( task.centroids, binCount, scale );
+
+        int   bestAxis  = -1;
+        int   bestSplit = 0;
+        float bestCost  = INFINITY;
+        BinSet bins;
+        if( task.depth < MaxDepth &&
+            ( scale[0] > 0.0f || scale[1] > 0.0f || scale[2] > 0.0f )
+        ) {
+            Bin( run, p, c, task.count, task.centroids, scale, binCount, partial, &bins );
+            for( int a = 0; a < 3; ++a ) {
+                if( scale[a] == 0.0f ) {
+                    continue;
+                }
+                float        leftCost[Bins];
+                Bounds       sweep;
+                unsigned int n = 0;
+                Clear( &sweep );
+                for( int b = 0; b < binCount - 1; ++b ) {
+                    Grow( &sweep, bins.bounds[a][b] );
+                    n += bins.count[a][b];
+                    leftCost[b] = n ? HalfArea( sweep )*(float)n : 0.0f;
+                }
+                Clear( &sweep );
+                n = 0;
+                for( int b = binCount - 1; b > 0; --b ) {
+                    Grow( &sweep, bins.bounds[a][b] );
+                    n += bins.count[a][b];
+                    if( !n || n == task.count ) {
+                        continue;
+                    }
+                    float cost = leftCost[b - 1] + HalfArea( sweep )*(float)n;
+                    if( cost < bestCost ) {
+                        bestCost  = cost;
+                        bestAxis  = a;
+                        bestSplit = b;
+                    }
+                }
+            }
+        }
+        if( bestAxis < 0 ) {
+            // NOTE(alicia): every centroid in the same spot or too deep,
+            // halve by index.
+            if( task.count <= MaxLeafSize ) {
+                return false;
+            }
+            unsigned int half = task.count / 2;
+            Bounds leftBox, rightBox;
+            Measure( p, half, &leftBox, &left->centroids );
+            Measure( p + half, task.count - half, &rightBox, &right->centroids );
+            Finish( task, half, leftBox, rightBox, left, right );
+            return true;
+        }
+        // NOTE(alicia): SAH with traversal and intersection costing the same.
+        if( task.count <= MaxLeafSize &&
+            !( bestCost < ( (float)task.count - 1.0f )*HalfArea( box ) )
+        ) {
+            return false;
+        }
+
+        // NOTE(alicia): partition on the same bin index the bins used.
+        // every primitive swaps with the first right one so there is no
+        // branch to mispredict, right primitives only swap among themselves.
+        float        cmin = task.centroids.min[bestAxis];
+        float        s    = scale[bestAxis];
+        unsigned int i    = 0;
+        const float* axis = c[bestAxis];
+        for( unsigned int k = 0; k < task.count; ++k ) {
+            unsigned int isLeft = (int)BinIndex( axis[k], cmin, s, binCount ) < bestSplit;
+            Node swap = p[k];
+            p[k]      = p[i];
+            p[i]      = swap;
+            for( int a = 0; a < 3; ++a ) {
+                float t = c[a][k];
+                c[a][k] = c[a][i];
+                c[a][i] = t;
+            }
+            i += isLeft;
+        }
+        MeasureCentroids( c, 0, i, &left->centroids );
+        MeasureCentroids( c, i, task.count - i, &right->centroids );
+        Bounds leftBox, rightBox;
+        Clear( &leftBox );
+        Clear( &rightBox );
+        for( int b = 0; b < binCount; ++b ) {
+            Grow( b < bestSplit ? &leftBox : &rightBox, bins.bounds[bestAxis][b] );
+        }
+        Finish( task, i, leftBox, rightBox, left, right );
+        return true;
+    }
+    /// Split of a node with 2 primitives, the same decision binning them
+    /// into 2 bins makes without the bins.
+    inline
+    bool SplitPair( const Task& task, const Bounds& box, Node* p, float* const* c, Task* left, Task* right ) {
+        float scale[4];
+        Scale( task.centroids, 2, scale );
+        int first = -1;
+        for( int a = 0; a < 3 && first < 0; ++a ) {
+            if( scale[a] == 0.0f ) {
+                continue;
+            }
+            unsigned int b0 = BinIndex( c[a][0], task.centroids.min[a], scale[a], 2 );
+            unsigned int b1 = BinIndex( c[a][1], task.centroids.min[a], scale[a], 2 );
+            if( b0 != b1 ) {
+                first = b0 == 0 ? 0 : 1;
+            }
+        }
+        if( first < 0 ) {
+            return false;
+        }
+        Bounds leftBox, rightBox;
+        Clear( &leftBox );
+        Clear( &rightBox );
+        for( int a = 0; a < 3; ++a ) {
+            leftBox.min[a]  = ( &p[first].min.x )[a];
+            leftBox.max[a]  = ( &p[first].max.x )[a];
+            rightBox.min[a] = ( &p[1 - first].min.x )[a];
+            rightBox.max[a] = ( &p[1 - first].max.x )[a];
+        }
+        if( !( HalfArea( leftBox ) + HalfArea( rightBox ) < HalfArea( box ) ) ) {
+            return false;
+        }
+        if( first ) {
+            Node swap = p[0];
+            p[0]      = p[1];
+            p[1]      = swap;
+            for( int a = 0; a < 3; ++a ) {
+                float t = c[a][0];
+                c[a][0] = c[a][1];
+                c[a][1] = t;
+            }
+        }
+        MeasureCentroids( c, 0, 1, &left->centroids );
+        MeasureCentroids( c, 1, 1, &right->centroids );
+        Finish( task, 1, leftBox, rightBox, left, right );
+        return true;
+    }
+    /// Doubled centroid bounds of c[a][first] to c[a][first + count - 1].
+    static inline
+    void MeasureCentroids( const float* const* c, unsigned int first, unsigned int count, Bounds* b ) {
+        Clear( b );
+        for( int a = 0; a < 3; ++a ) {
+            const float* v  = c[a] + first;
+            float        lo = INFINITY, hi = -INFINITY;
+            for( unsigned int i = 0; i < count; ++i ) {
+                lo = v[i] < lo ? v[i] : lo;
+                hi = v[i] > hi ? v[i] : hi;
+            }
+            b->min[a] = lo;
+            b->max[a] = hi;
+        }
+    }
+    inline
+    void Finish( const Task& task, unsigned int leftCount,
+        const Bounds& leftBox, const Bounds& rightBox, Task* left, Task* right
+    ) {
+        left->first  = task.first;
+        left->count  = leftCount;
+        left->depth  = task.depth + 1;
+        right->first = task.first + leftCount;
+        right->count = task.count - leftCount;
+        right->depth = task.depth + 1;
+        Node& node = nodes[task.node];
+        node.count = 0;
+        nodes[node.first]     = Node{ Vector3{ leftBox.min[0],  leftBox.min[1],  leftBox.min[2]  }, 0,
+                                      Vector3{ leftBox.max[0],  leftBox.max[1],  leftBox.max[2]  }, 0 };
+        nodes[node.first + 1] = Node{ Vector3{ rightBox.min[0], rightBox.min[1], rightBox.min[2] }, 0,
+                                      Vector3{ rightBox.max[0], rightBox.max[1], rightBox.max[2] }, 0 };
+        left->node  = node.first;
+        right->node = node.first + 1;
+    }
+    inline
+    void Leaf( const Task& task ) {
+        nodes[task.node].first = task.first;
+        nodes[task.node].count = task.count;
+    }
+    /// Builds task's subtree with nodes from next on, returns the end.
+    inline
+    unsigned int BuildSubtree( const Task& root, unsigned int next ) {
+        Serial serial;
+        Task stack[2 * MaxDepth + 2];
+        int  size = 0;
+        stack[size++] = root;
+        while( size ) {
+            Task task = stack[--size];
+            nodes[task.node].first = next;
+            Task left, right;
+            if( !Split( serial, task, nullptr, &left, &right ) ) {
+                Leaf( task );
+                continue;
+            }
+            next += 2;
+            stack[size++] = right;
+            stack[size++] = left;
+        }
+        return next;
+    }
+    template<typename Runner>
+    bool BuildWith( Runner& run, const Vector3* min, const Vector3* max, size_t count ) {
+        std::free( block );
+        block = nullptr;
+        nodes = primitives = nullptr;
+        nodeCount = primitiveCount = 0;
+        if( !count ) {
+            return true;
+        }
+        if( count >= None ) {
+            return false;
+        }
+
+        // NOTE(alicia): 2 * count nodes covers the root, one unused node
+        // so sibling pairs start on even indices, and count - 1 pairs.
+        size_t capacity = 2 * count;
+        block = std::malloc( ( capacity + count ) * sizeof(Node) + 64 );
+        if( !block ) {
+            return false;
+        }
+        nodes      = (Node*)( ( (size_t)block + 63 ) & ~(size_t)63 );
+        primitives = nodes + capacity;
+        primitiveCount = count;
+
+        size_t chunks  = ( count + ChunkSize - 1 ) / ChunkSize;
+        void*  scratch = std::malloc( count * ( sizeof(Task) + 2 * sizeof(unsigned int) + 3 * sizeof(float) ) +
+            chunks * ( sizeof(BinSet) + 2 * sizeof(Bounds) ) + 16 );
+        if( !scratch ) {
+            std::free( block );
+            block = nullptr;
+            nodes = primitives = nullptr;
+            primitiveCount = 0;
+            return false;
+        }
+        Task*   tasks   = (Task*)( ( (size_t)scratch + 15 ) & ~(size_t)15 );
+        BinSet* partial = (BinSet*)( tasks + count );
+        Bounds* measure = (Bounds*)( partial + chunks );
+        unsigned int* offsets = (unsigned int*)( measure + 2 * chunks );
+        unsigned int* ends    = offsets + count;
+        // NOTE(alicia): doubled centroids per axis, permuted along with
+        // the primitives so binning and partitioning read them in a row.
+        centroid[0] = (float*)( ends + count );
+        centroid[1] = centroid[0] + count;
+        centroid[2] = centroid[1] + count;
+
+        run.For( chunks, 1, [&]( size_t begin, size_t end ) {
+            for( size_t k = begin; k < end; ++k ) {
+                size_t first = k * ChunkSize;
+                size_t last  = first + ChunkSize < count ? first + ChunkSize : count;
+                for( size_t i = first; i < last; ++i ) {
+                    primitives[i] = Node{ min[i], (unsigned int)i, max[i], 1 };
+                    centroid[0][i] = min[i].x + max[i].x;
+                    centroid[1][i] = min[i].y + max[i].y;
+                    centroid[2][i] = min[i].z + max[i].z;
+                }
+                Measure( primitives + first, last - first, measure + 2 * k, measure + 2 * k + 1 );
+            }
+        } );
+        Task root;
+        Bounds box;
+        Clear( &box );
+        Clear( &root.centroids );
+        for( size_t k = 0; k < chunks; ++k ) {
+            Grow( &box, measure[2 * k] );
+            Grow( &root.centroids, measure[2 * k + 1] );
+        }
+        root.node  = 0;
+        root.first = 0;
+        root.count = (unsigned int)count;
+        root.depth = 0;
+        nodes[0] = Node{ Vector3{ box.min[0], box.min[1], box.min[2] }, 0,
+                         Vector3{ box.max[0], box.max[1], box.max[2] }, 0 };
+        nodes[1] = Node{ Vector3{ 0, 0, 0 }, 0, Vector3{ 0, 0, 0 }, 0 };
+
+        // NOTE(alicia): top nodes, big enough to bin in parallel.
+        unsigned int next = 2;
+        size_t taskCount  = 0;
+        Task   stack[2 * MaxDepth + 2];
+        int    size = 0;
+        stack[size++] = root;
+        while( size ) {
+            Task task = stack[--size];
+            if( task.count <= TaskSize ) {
+                tasks[taskCount++] = task;
+                continue;
+            }
+            nodes[task.node].first = next;
+            Task left, right;
+            if( !Split( run, task, partial, &left, &right ) ) {
+                Leaf( task );
+                continue;
+            }
+            next += 2;
+            stack[size++] = right;
+            stack[size++] = left;
+        }
+
+        // NOTE(alicia): a subtree of n primitives needs at most 2n - 2 nodes.
+        unsigned int reserved = next;
+        for( size_t k = 0; k < taskCount; ++k ) {
+            offsets[k] = reserved;
+            reserved  += 2 * tasks[k].count - 2;
+        }
+        run.For( taskCount, 1, [&]( size_t begin, size_t end ) {
+            for( size_t k = begin; k < end; ++k ) {
+                ends[k] = BuildSubtree( tasks[k], offsets[k] );
+            }
+        } );
+
+        // NOTE(alicia): pack the subtree ranges behind the top nodes.
+        for( size_t k = 0; k < taskCount; ++k ) {
+            unsigned int used  = ends[k] - offsets[k];
+            unsigned int delta = offsets[k] - next;
+            if( delta ) {
+                // NOTE(alicia): ranges only move down, copying forward is safe.
+                for( unsigned int i = next; i < next + used; ++i ) {
+                    nodes[i] = nodes[i + delta];
+                    if( !nodes[i].count ) {
+                        nodes[i].first -= delta;
+                    }
+                }
+                Node& taskRoot = nodes[tasks[k].node];
+                if( !taskRoot.count ) {
+                    taskRoot.first -= delta;
+                }
+            }
+            next += used;
+        }
+        nodeCount = next;
+        std::free( scratch );
+        centroid[0] = centroid[1] = centroid[2] = nullptr;
+        return true;
+    }
+};
+
+// NOTE(alicia): uniform spatial hash grid.
+// points go in cells cellSize wide and the cells are hashed into a
+// power of two table, so there are no world bounds to set up front.
+// Build is a counting sort by bucket: per block histograms, a prefix
+// sum and a stable scatter, O( n ) and the same layout for any thread
+// count. points are copied in bucket order next to their cell key, a
+// query reads the buckets of the cells its radius touches and skips
+// points of other cells that landed in the same bucket.
+// a cellSize close to the query radius works best. cell coordinates
+// wrap every 2^21 cells, cells that far apart share a key and only
+// cost extra distance tests.
+struct SpatialGrid {
+    SpatialGrid() {}
+    SpatialGrid( const SpatialGrid& ) = delete;
+    SpatialGrid& operator=( const SpatialGrid& ) = delete;
+    SpatialGrid( SpatialGrid&& other ) : state(other.state) {
+        other.state = State();
+    }
+    SpatialGrid& operator=( SpatialGrid&& other ) {
+        if( this != &other ) {
+            std::free( state.block );
+            state = other.state;
+            other.state = State();
+        }
+        return *this;
+    }
+    ~SpatialGrid() {
+        std::free( state.block );
+    }
+
+    /// Puts points[0] .. points[count - 1] in cells cellSize wide.
+    /// Memory is kept for the next build.
+    /// false if out of memory or cellSize is not positive.
+    inline
+    bool Build( const Vector3* points, size_t count, float cellSize ) {
+        Serial serial;
+        return BuildWith( serial, 1, points, nullptr, count, cellSize );
+    }
+    /// 2D points, z is 0.
+    inline
+    bool Build( const Vector2* points, size_t count, float cellSize ) {
+        Serial serial;
+        return BuildWith( serial, 1, nullptr, points, count, cellSize );
+    }
+    inline
+    bool Build( const Vec3* points, size_t count, float cellSize ) {
+        return Build( (const Vector3*)points, count, cellSize );
+    }
+    inline
+    bool Build( const Vec2* points, size_t count, float cellSize ) {
+        return Build( (const Vector2*)points, count, cellSize );
+    }
+#if defined(RAYMATH_CPP_PARALLEL)
+    inline
+    bool Build( ThreadPool& pool, const Vector3* points, size_t count, float cellSize );
+    inline
+    bool Build( ThreadPool& pool, const Vector2* points, size_t count, float cellSize );
+    inline
+    bool Build( ThreadPool& pool, const Vec3* points, size_t count, float cellSize ) {
+        return Build( pool, (const Vector3*)points, count, cellSize );
+    }
+    inline
+    bool Build( ThreadPool& pool, const Vec2* points, size_t count, float cellSize ) {
+        return Build( pool, (const Vector2*)points, count, cellSize );
+    }
+#endif
+    inline
+    size_t Count() const {
+        return state.count;
+    }
+    inline
+    float CellSize() const {
+        return state.cellSize;
+    }
+
+    /// Calls fn( index, distanceSqr ) for every point within radius
+    /// of center and returns how many there were.
+    template<typename Fn>
+    size_t Query( Vector3 center, float radius, const Fn& fn ) const {
+        const State& s = state;
+        size_t found = 0;
+        if( !s.count || !( radius >= 0.0f ) ) {
+            return found;
+        }
+        float radiusSqr = radius * radius;
+        int lo[3], hi[3];
+        Range( center, radius, lo, hi );
+        if( !Small( lo, hi, s.count ) ) {
+            // NOTE(alicia): more cells than points, test them all.
+            for( size_t i = 0; i < s.count; ++i ) {
+                float distanceSqr = Vector3DistanceSqr( center, s.points[i] );
+                if( distanceSqr <= radiusSqr ) {
+                    fn( s.indices[i], distanceSqr );
+                    ++found;
+                }
+            }
+            return found;
+        }
+        for( int z = lo[2]; z <= hi[2]; ++z ) {
+            for( int y = lo[1]; y <= hi[1]; ++y ) {
+                Row( lo[0], hi[0], y, z, [&]( unsigned int i ) {
+                    float distanceSqr = Vector3DistanceSqr( center, s.points[i] );
+                    if( distanceSqr <= radiusSqr ) {
+                        fn( s.indices[i], distanceSqr );
+                        ++found;
+                    }
+                } );
+            }
+        }
+        return found;
+    }
+    template<typename Fn>
+    size_t Query( Vector2 center, float radius, const Fn& fn ) const {
+        return Query( Vector3{ center.x, center.y, 0.0f }, radius, fn );
+    }
+    /// Writes up to capacity indices of points within radius of center
+    /// to out and returns how many there were, which can be more.
+    inline
+    size_t Query( Vector3 center, float radius, unsigned int* out, size_t capacity ) const {
+        size_t written = 0;
+        return Query( center, radius, [&]( unsigned int index, float ) {
+            if( written < capacity ) {
+                out[written++] = index;
+            }
+        } );
+    }
+    inline
+    size_t Query( Vector2 center, float radius, unsigned int* out, size_t capacity ) const {
+        return Query( Vector3{ center.x, center.y, 0.0f }, radius, out, capacity );
+    }
+
+    /// Calls fn( a, b, distanceSqr ) once for every pair of points
+    /// within radius of each other and returns how many there were.
+    template<typename Fn>
+    size_t Pairs( float radius, const Fn& fn ) const {
+        return PairsIn( 0, state.count, radius, fn );
+    }
+#if defined(RAYMATH_CPP_PARALLEL)
+    /// Same pairs, fn is called from every thread of the pool at once.
+    template<typename Fn>
+    size_t Pairs( ThreadPool& pool, float radius, const Fn& fn ) const;
+#endif
+
+private:
+    /// keys, points and indices are in bucket order,
+    /// bucket b covers starts[b] .. starts[b + 1] - 1.
+    struct State {
+        void*               block    = nullptr;
+        size_t              bytes    = 0;
+        size_t              count    = 0;
+        unsigned int        bits     = 0;
+        float               cellSize = 0.0f;
+        float               inverse  = 0.0f;
+        bool                flat     = false;
+        unsigned long long* keys     = nullptr;
+        Vector3*            points   = nullptr;
+        unsigned int*       indices  = nullptr;
+        unsigned int*       starts   = nullptr;
+    };
+    struct Serial {
+        template<typename Fn>
+        void For( size_t count, size_t, const Fn& fn ) {
+            if( count ) {
+                fn( (size_t)0, count );
+            }
+        }
+    };
+    static const unsigned int Mask      = ( 1u << 21 ) - 1;
+    static const size_t       ChunkSize = 16384;
+    /// Points per parallel Pairs chunk.
+    static const size_t       PairChunk = 512;
+
+    State state;
+
+    static inline
+    int Cell( float value, float inverse ) {
+        float cell = value * inverse;
+        // NOTE(alicia): also sends NaN to the lowest cell.
+        cell = cell > -1e9f ? ( cell < 1e9f ? cell : 1e9f ) : -1e9f;
+        int result = (int)cell;
+        return (float)result > cell ? result - 1 : result;
+    }
+    static inline
+    unsigned long long Key( int x, int y, int z ) {
+        return (unsigned long long)( (unsigned int)x & Mask ) |
+            (unsigned long long)( (unsigned int)y & Mask ) << 21 |
+            (unsigned long long)( (unsigned int)z & Mask ) << 42;
+    }
+    /// Rows of cells along x hash to a random start and run on from
+    /// there, so neighbouring cells share cache lines.
+    static inline
+    unsigned int Hash( unsigned long long key, unsigned int bits ) {
+        unsigned long long row = ( ( key >> 21 ) * 0x9E3779B97F4A7C15ull ) >> ( 64 - bits );
+        return (unsigned int)( ( row + ( key & Mask ) ) & ( ( 1ull << bits ) - 1 ) );
+    }
+    static inline
+    Vector3 Point( const Vector3* points3, const Vector2* points2, size_t i ) {
+        return points3 ? points3[i] : Vector3{ points2[i].x, points2[i].y, 0.0f };
+    }
+    inline
+    unsigned long long KeyOf( Vector3 point ) const {
+        return Key( Cell( point.x, state.inverse ), Cell( point.y, state.inverse ), Cell( point.z, state.inverse ) );
+    }
+    /// Calls visit( i ) for the points in cells x0 .. x1 of row y, z.
+    /// The cells of a row sit in consecutive buckets, read as one run.
+    template<typename Fn>
+    void Row( int x0, int x1, int y, int z, const Fn& visit ) const {
+        const State& s = state;
+        unsigned long long first = Key( x0, y, z );
+        unsigned long long row   = first >> 21;
+        unsigned int       span  = (unsigned int)( x1 - x0 );
+        size_t table = (size_t)1 << s.bits;
+        size_t begin = Hash( first, s.bits );
+        size_t end   = begin + span + 1;
+        // NOTE(alicia): Small keeps span below the table size, either
+        // count or 2^21 past that, the run wraps around the end of the
+        // table at most once.
+        while( begin < end ) {
+            size_t stop = end < table ? end : table;
+            for( unsigned int i = s.starts[begin]; i < s.starts[stop]; ++i ) {
+                unsigned long long key = s.keys[i];
+                if( key >> 21 == row && ( ( (unsigned int)key - (unsigned int)first ) & Mask ) <= span ) {
+                    visit( i );
+                }
+            }
+            begin = 0;
+            end  -= stop;
+        }
+    }
+    /// Cells covering center +- radius, a single z layer for 2D points.
+    inline
+    void Range( Vector3 center, float radius, int lo[3], int hi[3] ) const {
+        const float c[3] = { center.x, center.y, center.z };
+        for( int k = 0; k < 3; ++k ) {
+            lo[k] = Cell( c[k] - radius, state.inverse );
+            hi[k] = Cell( c[k] + radius, state.inverse );
+        }
+        if( state.flat ) {
+            lo[2] = hi[2] = 0;
+        }
+    }
+    /// true if visiting the cells lo .. hi costs less than testing
+    /// every point and no two of them share a key.
+    static inline
+    bool Small( const int lo[3], const int hi[3], size_t count ) {
+        unsigned long long cells = 1;
+        for( int k = 0; k < 3; ++k ) {
+            unsigned long long span = (unsigned long long)( (long long)hi[k] - lo[k] + 1 );
+            if( span > Mask ) {
+                return false;
+            }
+            cells *= span;
+        }
+        return cells <= count;
+    }
+    /// Pairs whose first point, in bucket order, is in begin .. end - 1.
+    template<typename Fn>
+    size_t PairsIn( size_t begin, size_t end, float radius, const Fn& fn ) const {
+        const State& s = state;
+        size_t found = 0;
+        if( !s.count || !( radius >= 0.0f ) ) {
+            return found;
+        }
+        float radiusSqr = radius * radius;
+
+        // NOTE(alicia): the same choice for every point, otherwise
+        // a pair could be reported by both of its points.
+        int widest = (int)( radius * s.inverse < 1e6f ? radius * s.inverse : 1e6f ) * 2 + 3;
+        int lo[3]  = { 0, 0, 0 };
+        int hi[3]  = { widest, widest, s.flat ? 0 : widest };
+        if( !Small( lo, hi, s.count ) ) {
+            for( size_t a = begin; a < end; ++a ) {
+                for( size_t b = a + 1; b < s.count; ++b ) {
+                    float distanceSqr = Vector3DistanceSqr( s.points[a], s.points[b] );
+                    if( distanceSqr <= radiusSqr ) {
+                        fn( s.indices[a], s.indices[b], distanceSqr );
+                        ++found;
+                    }
+                }
+            }
+            return found;
+        }
+
+        // NOTE(alicia): a point pairs with the later points of its own
+        // cell and with every point of the cells after its own in
+        // z, y, x order, the cells before it find it themselves.
+        for( size_t a = begin; a < end; ++a ) {
+            Vector3 point = s.points[a];
+            unsigned long long own = s.keys[a];
+            unsigned int bucket = Hash( own, s.bits );
+            for( unsigned int b = (unsigned int)a + 1; b < s.starts[bucket + 1]; ++b ) {
+                if( s.keys[b] != own ) {
+                    continue;
+                }
+                float distanceSqr = Vector3DistanceSqr( point, s.points[b] );
+                if( distanceSqr <= radiusSqr ) {
+                    fn( s.indices[a], s.indices[b], distanceSqr );
+                    ++found;
+                }
+            }
+
+            int cx = Cell( point.x, s.inverse );
+            int cy = Cell( point.y, s.inverse );
+            int cz = Cell( point.z, s.inverse );
+            Range( point, radius, lo, hi );
+            auto visit = [&]( unsigned int b ) {
+                float distanceSqr = Vector3DistanceSqr( point, s.points[b] );
+                if( distanceSqr <= radiusSqr ) {
+                    fn( s.indices[a], s.indices[b], distanceSqr );
+                    ++found;
+                }
+            };
+            for( int z = cz; z <= hi[2]; ++z ) {
+                for( int y = z == cz ? cy : lo[1]; y <= hi[1]; ++y ) {
+                    int first = z == cz && y == cy ? cx + 1 : lo[0];
+                    if( first <= hi[0] ) {
+                        Row( first, hi[0], y, z, visit );
+                    }
+                }
+            }
+        }
+        return found;
+    }
+    template<typename Runner>
+    bool BuildWith(
+        Runner& run, size_t threads, const Vector3* points3, const Vector2* points2,
+        size_t count, float cellSize
+    ) {
+        State& s = state;
+        s.count = 0;
+        if( !( cellSize > 0.0f ) || count >= 0xFFFFFFFFu ) {
+            return false;
+        }
+        // NOTE(alicia): x wraps at 2^21 in a key, with more buckets than
+        // that the cells of a row stop hashing to consecutive buckets.
+        unsigned int bits = 4;
+        while( bits < 21 && ( (size_t)1 << bits ) < count ) {
+            ++bits;
+        }
+        size_t table  = (size_t)1 << bits;
+        size_t blocks = ( count + ChunkSize - 1 ) / ChunkSize;
+        blocks = blocks < threads ? blocks : threads;
+        blocks = blocks ? blocks : 1;
+
+        size_t bytes = count * ( sizeof(unsigned long long) + sizeof(Vector3) + 2 * sizeof(unsigned int) ) +
+            ( table + 1 + blocks * table ) * sizeof(unsigned int);
+        if( bytes > s.bytes ) {
+            std::free( s.block );
+            s = State();
+            s.block = std::malloc( bytes );
+            if( !s.block ) {
+                return false;
+            }
+            s.bytes = bytes;
+        }
+        s.bits     = bits;
+        s.cellSize = cellSize;
+        s.inverse  = 1.0f / cellSize;
+        s.flat     = !points3;
+        s.keys     = (unsigned long long*)s.block;
+        s.points   = (Vector3*)( s.keys + count );
+        s.indices  = (unsigned int*)( s.points + count );
+        s.starts   = s.indices + count;
+        unsigned int* buckets    = s.starts + table + 1;
+        unsigned int* histograms = buckets + count;
+
+        // NOTE(alicia): every block counts its points per bucket.
+        run.For( blocks, 1, [&]( size_t begin, size_t end ) {
+            for( size_t k = begin; k < end; ++k ) {
+                unsigned int* counts = histograms + k * table;
+                for( size_t b = 0; b < table; ++b ) {
+                    counts[b] = 0;
+                }
+                for( size_t i = k * count / blocks; i < ( k + 1 ) * count / blocks; ++i ) {
+                    unsigned int bucket = Hash( KeyOf( Point( points3, points2, i ) ), bits );
+                    buckets[i] = bucket;
+                    counts[bucket]++;
+                }
+            }
+        } );
+        // NOTE(alicia): where each block starts inside every bucket.
+        run.For( table, ChunkSize, [&]( size_t begin, size_t end ) {
+            for( size_t b = begin; b < end; ++b ) {
+                unsigned int sum = 0;
+                for( size_t k = 0; k < blocks; ++k ) {
+                    unsigned int n = histograms[k * table + b];
+                    histograms[k * table + b] = sum;
+                    sum += n;
+                }
+                s.starts[b] = sum;
+            }
+        } );
+        unsigned int total = 0;
+        for( size_t b = 0; b < table; ++b ) {
+            unsigned int n = s.starts[b];
+            s.starts[b] = total;
+            total += n;
+        }
+        s.starts[table] = total;
+        // NOTE(alicia): stable scatter, a bucket keeps the input order.
+        run.For( blocks, 1, [&]( size_t begin, size_t end ) {
+            for( size_t k = begin; k < end; ++k ) {
+                unsigned int* offsets = histograms + k * table;
+                for( size_t i = k * count / blocks; i < ( k + 1 ) * count / blocks; ++i ) {
+                    unsigned int bucket = buckets[i];
+                    size_t       at     = s.starts[bucket] + offsets[bucket]++;
+                    Vector3      point  = Point( points3, points2, i );
+                    s.keys[at]    = KeyOf( point );
+                    s.points[at]  = point;
+                    s.indices[at] = (unsigned int)i;
+                }
+            }
+        } );
+        s.count = count;
+        return true;
+    }
+};
+#endif
+
+// NOTE(alicia): scalar templated types.
+// Vec3T, QuatT and Mat4T port the raymath formulas with T in place of
+// float, Vec3d/Quatd/Mat4d are the double versions for positions far
+// from the origin. keep the world in double and convert to float
+// relative to the camera (RelativeTo, Rebase) right before rendering,
+// the subtraction happens in double so nearby objects keep full
+// float precision however far the camera is from the origin.
+template<typename T>
+struct ScalarMath;
+template<>
+struct ScalarMath<float> {
+    static inline float Sqrt( float x ) { return sqrtf( x ); }
+    static inline float Sin( float x ) { return sinf( x ); }
+    static inline float Cos( float x ) { return cosf( x ); }
+    static inline float Tan( float x ) { return tanf( x ); }
+    static inline float Acos( float x ) { return acosf( x ); }
+    static inline float Asin( float x ) { return asinf( x ); }
+    static inline float Atan2( float y, float x ) { return atan2f( y, x ); }
+    static inline float Fabs( float x ) { return fabsf( x ); }
+};
+template<>
+struct ScalarMath<double> {
+    static inline double Sqrt( double x ) { return sqrt( x ); }
+    static inline double Sin( double x ) { return sin( x ); }
+    static inline double Cos( double x ) { return cos( x ); }
+    static inline double Tan( double x ) { return tan( x ); }
+    static inline double Acos( double x ) { return acos( x ); }
+    static inline double Asin( double x ) { return asin( x ); }
+    static inline double Atan2( double y, double x ) { return atan2( y, x ); }
+    static inline double Fabs( double x ) { return fabs( x ); }
+};
+
+template<typename T>
+struct Mat4T;
+template<typename T>
+struct QuatT;
+
+template<typename T>
+struct Vec3T {
+    union {
+        T array[3];
+        struct { T x = 0, y = 0, z = 0; };
+    };
+
+    Vec3T() {}
+    Vec3T( T x, T y, T z ) : x(x), y(y), z(z) {}
+    explicit Vec3T( const Vector3& v ) : Vec3T( (T)v.x, (T)v.y, (T)v.z ) {}
+    template<typename U>
+    explicit Vec3T( const Vec3T<U>& v ) : Vec3T( (T)v.x, (T)v.y, (T)v.z ) {}
+
+    /// Rounds each component to float.
+    inline
+    Vec3 ToVec3() const {
+        return Vec3( (float)x, (float)y, (float)z );
+    }
+    /// *this - origin in T, then rounded to float.
+    inline
+    Vec3 RelativeTo( const Vec3T& origin ) const {
+        return Subtract( origin ).ToVec3();
+    }
+    inline
+    T operator[]( size_t idx ) const {
+        return array[idx];
+    }
+    inline
+    T& operator[]( size_t idx ) {
+        return array[idx];
+    }
+
+    inline
+    Vec3T& operator+=( const Vec3T& v2 ) {
+        return *this = this->Add( v2 );
+    }
+    inline
+    Vec3T& operator-=( const Vec3T& v2 ) {
+        return *this = this->Subtract( v2 );
+    }
+    inline
+    Vec3T& operator*=( T value ) {
+        return *this = this->Scale( value );
+    }
+    inline
+    Vec3T& operator/=( T value ) {
+        return *this = this->Scale( T(1) / value );
+    }
+    inline
+    Vec3T operator-() const {
+        return this->Negate();
+    }
+
+    static inline
+    Vec3T Zero() {
+        return Vec3T( 0, 0, 0 );
+    }
+    static inline
+    Vec3T One() {
+        return Vec3T( 1, 1, 1 );
+    }
+
+    inline
+    Vec3T Add( const Vec3T& v2 ) const {
+        return Vec3T( x + v2.x, y + v2.y, z + v2.z );
+    }
+    inline
+    Vec3T AddValue( T add ) const {
+        return Vec3T( x + add, y + add, z + add );
+    }
+    inline
+    Vec3T Subtract( const Vec3T& v2 ) const {
+        return Vec3T( x - v2.x, y - v2.y, z - v2.z );
+    }
+    inline
+    Vec3T SubtractValue( T sub ) const {
+        return Vec3T( x - sub, y - sub, z - sub );
+    }
+    inline
+    Vec3T Scale( T scalar ) const {
+        return Vec3T( x*scalar, y*scalar, z*scalar );
+    }
+    inline
+    Vec3T Multiply( const Vec3T& v2 ) const {
+        return Vec3T( x*v2.x, y*v2.y, z*v2.z );
+    }
+    inline
+    Vec3T CrossProduct( const Vec3T& v2 ) const {
+        return Vec3T( y*v2.z - z*v2.y, z*v2.x - x*v2.z, x*v2.y - y*v2.x );
+    }
+    inline
+    Vec3T Perpendicular() const {
+        T min = ScalarMath<T>::Fabs( x );
+        Vec3T cardinalAxis( 1, 0, 0 );
+        if( ScalarMath<T>::Fabs( y ) < min ) {
+            min = ScalarMath<T>::Fabs( y );
+            cardinalAxis = Vec3T( 0, 1, 0 );
+        }
+        if( ScalarMath<T>::Fabs( z ) < min ) {
+            cardinalAxis = Vec3T( 0, 0, 1 );
+        }
+        return CrossProduct( cardinalAxis );
+    }
+    inline
+    T Length() const {
+        return ScalarMath<T>::Sqrt( x*x + y*y + z*z );
+    }
+    inline
+    T LengthSqr() const {
+        return x*x + y*y + z*z;
+    }
+    inline
+    T DotProduct( const Vec3T& v2 ) const {
+        return x*v2.x + y*v2.y + z*v2.z;
+    }
+    inline
+    T Distance( const Vec3T& v2 ) const {
+        return Subtract( v2 ).Length();
+    }
+    inline
+    T DistanceSqr( const Vec3T& v2 ) const {
+        return Subtract( v2 ).LengthSqr();
+    }
+    inline
+    T Angle( const Vec3T& v2 ) const {
+        return ScalarMath<T>::Atan2( CrossProduct( v2 ).Length(), DotProduct( v2 ) );
+    }
+    inline
+    Vec3T Negate() const {
+        return Vec3T( -x, -y, -z );
+    }
+    inline
+    Vec3T Divide( const Vec3T& v2 ) const {
+        return Vec3T( x/v2.x, y/v2.y, z/v2.z );
+    }
+    inline
+    Vec3T Normalize() const {
+        T length = Length();
+        if( length != T(0) ) {
+            return Scale( T(1)/length );
+        }
+        return *this;
+    }
+    /// Same as Vector3OrthoNormalize, normalizes *this and makes v2
+    /// orthonormal to it.
+    inline
+    void OrthoNormalize( Vec3T* v2 ) {
+        T length = Length();
+        *this = Scale( T(1)/( length == T(0) ? T(1) : length ) );
+        Vec3T vn1 = CrossProduct( *v2 );
+        length = vn1.Length();
+        vn1 = vn1.Scale( T(1)/( length == T(0) ? T(1) : length ) );
+        *v2 = vn1.CrossProduct( *this );
+    }
+    inline
+    Vec3T Transform( const Mat4T<T>& mat ) const {
+        return Vec3T(
+            mat.m0*x + mat.m4*y + mat.m8*z  + mat.m12,
+            mat.m1*x + mat.m5*y + mat.m9*z  + mat.m13,
+            mat.m2*x + mat.m6*y + mat.m10*z + mat.m14 );
+    }
+    inline
+    Vec3T Rotate( const QuatT<T>& q ) const {
+        return Vec3T(
+            x*( q.x*q.x + q.w*q.w - q.y*q.y - q.z*q.z ) +
+                y*( 2*q.x*q.y - 2*q.w*q.z ) + z*( 2*q.x*q.z + 2*q.w*q.y ),
+            x*( 2*q.w*q.z + 2*q.x*q.y ) +
+                y*( q.w*q.w - q.x*q.x + q.y*q.y - q.z*q.z ) + z*( -2*q.w*q.x + 2*q.y*q.z ),
+            x*( -2*q.w*q.y + 2*q.x*q.z ) +
+                y*( 2*q.w*q.x + 2*q.y*q.z ) + z*( q.w*q.w - q.x*q.x - q.y*q.y + q.z*q.z ) );
+    }
+    /// Same as Vector3RotateByAxisAngle.
+    inline
+    Vec3T Rotate( const Vec3T& axis, T angle ) const {
+        T length = axis.Length();
+        Vec3T w = axis.Scale( ScalarMath<T>::Sin( angle/T(2) )/( length == T(0) ? T(1) : length ) );
+        Vec3T wv  = w.CrossProduct( *this );
+        Vec3T wwv = w.CrossProduct( wv );
+        return Add( wv.Scale( 2*ScalarMath<T>::Cos( angle/T(2) ) ) ).Add( wwv.Scale( 2 ) );
+    }
+    inline
+    Vec3T Lerp( const Vec3T& v2, T amount ) const {
+        return Vec3T( x + amount*( v2.x - x ), y + amount*( v2.y - y ), z + amount*( v2.z - z ) );
+    }
+    inline
+    Vec3T Invert() const {
+        return Vec3T( T(1)/x, T(1)/y, T(1)/z );
+    }
+    inline
+    Vec3T MoveTowards( const Vec3T& target, T maxDistance ) const {
+        Vec3T d = target.Subtract( *this );
+        T value = d.LengthSqr();
+        if( ( value == T(0) ) || ( ( maxDistance >= T(0) ) && ( value <= maxDistance*maxDistance ) ) ) {
+            return target;
+        }
+        T dist = ScalarMath<T>::Sqrt( value );
+        return Vec3T( x + d.x/dist*maxDistance, y + d.y/dist*maxDistance, z + d.z/dist*maxDistance );
+    }
+    inline
+    Vec3T Reflect( const Vec3T& normal ) const {
+        T dot = DotProduct( normal );
+        return Vec3T( x - 2*normal.x*dot, y - 2*normal.y*dot, z - 2*normal.z*dot );
+    }
+    /// Zero on total internal reflection, like Vector3Refract.
+    inline
+    Vec3T Refract( const Vec3T& n, T r ) const {
+        T dot = DotProduct( n );
+        T d   = T(1) - r*r*( T(1) - dot*dot );
+        if( d < T(0) ) {
+            return Zero();
+        }
+        T s = r*dot + ScalarMath<T>::Sqrt( d );
+        return Vec3T( r*x - s*n.x, r*y - s*n.y, r*z - s*n.z );
+    }
+    /// Barycentric coordinates of *this in the triangle a, b, c.
+    inline
+    Vec3T Barycenter( const Vec3T& a, const Vec3T& b, const Vec3T& c ) const {
+        Vec3T v0 = b.Subtract( a ), v1 = c.Subtract( a ), v2 = Subtract( a );
+        T d00 = v0.DotProduct( v0 );
+        T d01 = v0.DotProduct( v1 );
+        T d11 = v1.DotProduct( v1 );
+        T d20 = v2.DotProduct( v0 );
+        T d21 = v2.DotProduct( v1 );
+        T denom = d00*d11 - d01*d01;
+        T v = ( d11*d20 - d01*d21 )/denom;
+        T w = ( d00*d21 - d01*d20 )/denom;
+        return Vec3T( T(1) - ( w + v ), v, w );
+    }
+    /// Same as Vector3Unproject.
+    inline
+    Vec3T Unproject( const Mat4T<T>& projection, const Mat4T<T>& view ) const {
+        Mat4T<T> inv = view.Multiply( projection ).Invert();
+        T w = inv.m3*x + inv.m7*y + inv.m11*z + inv.m15;
+        return Vec3T(
+            ( inv.m0*x + inv.m4*y + inv.m8*z  + inv.m12 )/w,
+            ( inv.m1*x + inv.m5*y + inv.m9*z  + inv.m13 )/w,
+            ( inv.m2*x + inv.m6*y + inv.m10*z + inv.m14 )/w );
+    }
+    inline
+    Vec3T Min( const Vec3T& v2 ) const {
+        return Vec3T( x < v2.x ? x : v2.x, y < v2.y ? y : v2.y, z < v2.z ? z : v2.z );
+    }
+    inline
+    Vec3T Max( const Vec3T& v2 ) const {
+        return Vec3T( x > v2.x ? x : v2.x, y > v2.y ? y : v2.y, z > v2.z ? z : v2.z );
+    }
+    inline
+    Vec3T Clamp( const Vec3T& min, const Vec3T& max ) const {
+        return Max( min ).Min( max );
+    }
+    /// Scales the length into min..max, zero stays zero.
+    inline
+    Vec3T ClampValue( T min, T max ) const {
+        T length = LengthSqr();
+        if( length > T(0) ) {
+            length = ScalarMath<T>::Sqrt( length );
+            T scale = T(1);
+            if( length < min ) {
+                scale = min/length;
+            } else if( length > max ) {
+                scale = max/length;
+            }
+            return Scale( scale );
+        }
+        return *this;
+    }
+    /// Same tolerance as Vector3Equals.
+    inline
+    bool Equals( const Vec3T& v2 ) const {
+        return ScalarEquals( x, v2.x ) && ScalarEquals( y, v2.y ) && ScalarEquals( z, v2.z );
+    }
+
+    static inline
+    bool ScalarEquals( T a, T b ) {
+        T fa = ScalarMath<T>::Fabs( a ), fb = ScalarMath<T>::Fabs( b );
+        T scale = fa > fb ? fa : fb;
+        return ScalarMath<T>::Fabs( a - b ) <= T(EPSILON) * ( scale > T(1) ? scale : T(1) );
+    }
+};
+template<typename T> inline
+Vec3T<T> operator+( const Vec3T<T>& v1, const Vec3T<T>& v2 ) {
+    return v1.Add( v2 );
+}
+template<typename T> inline
+Vec3T<T> operator-( const Vec3T<T>& v1, const Vec3T<T>& v2 ) {
+    return v1.Subtract( v2 );
+}
+template<typename T> inline
+Vec3T<T> operator*( const Vec3T<T>& v1, T scale ) {
+    return v1.Scale( scale );
+}
+template<typename T> inline
+Vec3T<T> operator*( T scale, const Vec3T<T>& v1 ) {
+    return v1.Scale( scale );
+}
+template<typename T> inline
+Vec3T<T> operator*( const Vec3T<T>& lhs, const Mat4T<T>& rhs ) {
+    return lhs.Transform( rhs );
+}
+template<typename T> inline
+Vec3T<T> operator/( const Vec3T<T>& v1, T scale ) {
+    return v1.Scale( T(1) / scale );
+}
+template<typename T> inline
+bool operator==( const Vec3T<T>& p, const Vec3T<T>& q ) {
+    return p.Equals( q );
+}
+template<typename T> inline
+bool operator!=( const Vec3T<T>& p, const Vec3T<T>& q ) {
+    return !( p == q );
+}
+
+template<typename T>
+struct QuatT {
+    union {
+        T array[4];
+        struct { T x = 0, y = 0, z = 0, w = 0; };
+    };
+
+    QuatT() {}
+    QuatT( T x, T y, T z, T w ) : x(x), y(y), z(z), w(w) {}
+    explicit QuatT( const Quaternion& q ) : QuatT( (T)q.x, (T)q.y, (T)q.z, (T)q.w ) {}
+    template<typename U>
+    explicit QuatT( const QuatT<U>& q ) : QuatT( (T)q.x, (T)q.y, (T)q.z, (T)q.w ) {}
+
+    /// Rounds each component to float.
+    inline
+    Quat ToQuat() const {
+        return Quat( (float)x, (float)y, (float)z, (float)w );
+    }
+    inline
+    T operator[]( size_t idx ) const {
+        return array[idx];
+    }
+    inline
+    T& operator[]( size_t idx ) {
+        return array[idx];
+    }
+
+    static inline
+    QuatT Identity() {
+        return QuatT( 0, 0, 0, 1 );
+    }
+    static inline
+    QuatT FromAxisAngle( const Vec3T<T>& axis, T angle ) {
+        T axisLength = axis.Length();
+        if( axisLength == T(0) ) {
+            return Identity();
+        }
+        Vec3T<T> normal = axis.Scale( T(1)/axisLength );
+        T sinres = ScalarMath<T>::Sin( angle*T(0.5) );
+        T cosres = ScalarMath<T>::Cos( angle*T(0.5) );
+        return QuatT( normal.x*sinres, normal.y*sinres, normal.z*sinres, cosres ).Normalize();
+    }
+    /// Shortest arc from one unit vector to another.
+    static inline
+    QuatT FromVector3ToVector3( const Vec3T<T>& from, const Vec3T<T>& to ) {
+        Vec3T<T> cross = from.CrossProduct( to );
+        return QuatT( cross.x, cross.y, cross.z, T(1) + from.DotProduct( to ) ).Normalize();
+    }
+    static inline
+    QuatT FromEuler( T pitch, T yaw, T roll ) {
+        T x0 = ScalarMath<T>::Cos( pitch*T(0.5) );
+        T x1 = ScalarMath<T>::Sin( pitch*T(0.5) );
+        T y0 = ScalarMath<T>::Cos( yaw*T(0.5) );
+        T y1 = ScalarMath<T>::Sin( yaw*T(0.5) );
+        T z0 = ScalarMath<T>::Cos( roll*T(0.5) );
+        T z1 = ScalarMath<T>::Sin( roll*T(0.5) );
+        return QuatT(
+            x1*y0*z0 - x0*y1*z1,
+            x0*y1*z0 + x1*y0*z1,
+            x0*y0*z1 - x1*y1*z0,
+            x0*y0*z0 + x1*y1*z1 );
+    }
+    static inline
+    QuatT FromMatrix( const Mat4T<T>& mat ) {
+        T fourWSquaredMinus1 = mat.m0  + mat.m5 + mat.m10;
+        T fourXSquaredMinus1 = mat.m0  - mat.m5 - mat.m10;
+        T fourYSquaredMinus1 = mat.m5  - mat.m0 - mat.m10;
+        T fourZSquaredMinus1 = mat.m10 - mat.m0 - mat.m5;
+
+        int biggestIndex = 0;
+        T fourBiggestSquaredMinus1 = fourWSquaredMinus1;
+        if( fourXSquaredMinus1 > fourBiggestSquaredMinus1 ) {
+            fourBiggestSquaredMinus1 = fourXSquaredMinus1;
+            biggestIndex = 1;
+        }
+        if( fourYSquaredMinus1 > fourBiggestSquaredMinus1 ) {
+            fourBiggestSquaredMinus1 = fourYSquaredMinus1;
+            biggestIndex = 2;
+        }
+        if( fourZSquaredMinus1 > fourBiggestSquaredMinus1 ) {
+            fourBiggestSquaredMinus1 = fourZSquaredMinus1;
+            biggestIndex = 3;
+        }
+
+        T biggestVal = ScalarMath<T>::Sqrt( fourBiggestSquaredMinus1 + T(1) )*T(0.5);
+        T mult = T(0.25)/biggestVal;
+        switch( biggestIndex ) {
+            case 0: return QuatT(
+                ( mat.m6 - mat.m9 )*mult, ( mat.m8 - mat.m2 )*mult,
+                ( mat.m1 - mat.m4 )*mult, biggestVal );
+            case 1: return QuatT(
+                biggestVal, ( mat.m1 + mat.m4 )*mult,
+                ( mat.m8 + mat.m2 )*mult, ( mat.m6 - mat.m9 )*mult );
+            case 2: return QuatT(
+                ( mat.m1 + mat.m4 )*mult, biggestVal,
+                ( mat.m6 + mat.m9 )*mult, ( mat.m8 - mat.m2 )*mult );
+            default: return QuatT(
+                ( mat.m8 + mat.m2 )*mult, ( mat.m6 + mat.m9 )*mult,
+                biggestVal, ( mat.m1 - mat.m4 )*mult );
+        }
+    }
+
+    inline
+    QuatT Add( const QuatT& q2 ) const {
+        return QuatT( x + q2.x, y + q2.y, z + q2.z, w + q2.w );
+    }
+    inline
+    QuatT AddValue( T add ) const {
+        return QuatT( x + add, y + add, z + add, w + add );
+    }
+    inline
+    QuatT Subtract( const QuatT& q2 ) const {
+        return QuatT( x - q2.x, y - q2.y, z - q2.z, w - q2.w );
+    }
+    inline
+    QuatT SubtractValue( T sub ) const {
+        return QuatT( x - sub, y - sub, z - sub, w - sub );
+    }
+    inline
+    QuatT Scale( T mul ) const {
+        return QuatT( x*mul, y*mul, z*mul, w*mul );
+    }
+    inline
+    T Length() const {
+        return ScalarMath<T>::Sqrt( x*x + y*y + z*z + w*w );
+    }
+    inline
+    QuatT Normalize() const {
+        T length = Length();
+        if( length == T(0) ) {
+            length = T(1);
+        }
+        return Scale( T(1)/length );
+    }
+    inline
+    QuatT Invert() const {
+        T lengthSq = x*x + y*y + z*z + w*w;
+        if( lengthSq == T(0) ) {
+            return *this;
+        }
+        T invLength = T(1)/lengthSq;
+        return QuatT( x*-invLength, y*-invLength, z*-invLength, w*invLength );
+    }
+    inline
+    QuatT Multiply( const QuatT& q2 ) const {
+        return QuatT(
+            x*q2.w + w*q2.x + y*q2.z - z*q2.y,
+            y*q2.w + w*q2.y + z*q2.x - x*q2.z,
+            z*q2.w + w*q2.z + x*q2.y - y*q2.x,
+            w*q2.w - x*q2.x - y*q2.y - z*q2.z );
+    }
+    /// Component wise, like QuaternionDivide.
+    inline
+    QuatT Divide( const QuatT& q2 ) const {
+        return QuatT( x/q2.x, y/q2.y, z/q2.z, w/q2.w );
+    }
+    inline
+    QuatT Lerp( const QuatT& q2, T amount ) const {
+        return QuatT(
+            x + amount*( q2.x - x ), y + amount*( q2.y - y ),
+            z + amount*( q2.z - z ), w + amount*( q2.w - w ) );
+    }
+    inline
+    QuatT Nlerp( const QuatT& q2, T amount ) const {
+        return Lerp( q2, amount ).Normalize();
+    }
+    inline
+    QuatT Slerp( QuatT q2, T amount ) const {
+        T cosHalfTheta = x*q2.x + y*q2.y + z*q2.z + w*q2.w;
+        if( cosHalfTheta < T(0) ) {
+            q2 = q2.Scale( T(-1) );
+            cosHalfTheta = -cosHalfTheta;
+        }
+        if( ScalarMath<T>::Fabs( cosHalfTheta ) >= T(1) ) {
+            return *this;
+        }
+        if( cosHalfTheta > T(0.95) ) {
+            return Nlerp( q2, amount );
+        }
+        T halfTheta    = ScalarMath<T>::Acos( cosHalfTheta );
+        T sinHalfTheta = ScalarMath<T>::Sqrt( T(1) - cosHalfTheta*cosHalfTheta );
+        if( ScalarMath<T>::Fabs( sinHalfTheta ) < T(EPSILON) ) {
+            return Scale( T(0.5) ).Add( q2.Scale( T(0.5) ) );
+        }
+        T ratioA = ScalarMath<T>::Sin( ( 1 - amount )*halfTheta )/sinHalfTheta;
+        T ratioB = ScalarMath<T>::Sin( amount*halfTheta )/sinHalfTheta;
+        return Scale( ratioA ).Add( q2.Scale( ratioB ) );
+    }
+    inline
+    Mat4T<T> ToMatrix() const {
+        T a2 = x*x, b2 = y*y, c2 = z*z;
+        T ac = x*z, ab = x*y, bc = y*z;
+        T ad = w*x, bd = w*y, cd = w*z;
+        return Mat4T<T>(
+            1 - 2*( b2 + c2 ), 2*( ab - cd ),     2*( ac + bd ),     0,
+            2*( ab + cd ),     1 - 2*( a2 + c2 ), 2*( bc - ad ),     0,
+            2*( ac - bd ),     2*( bc + ad ),     1 - 2*( a2 + b2 ), 0,
+            0,                 0,                 0,                 1 );
+    }
+    inline
+    void ToAxisAngle( Vec3T<T>* outAxis, T* outAngle ) const {
+        QuatT q = ScalarMath<T>::Fabs( w ) > T(1) ? Normalize() : *this;
+        T den = ScalarMath<T>::Sqrt( T(1) - q.w*q.w );
+        *outAngle = T(2)*ScalarMath<T>::Acos( q.w );
+        // NOTE(alicia): angle is zero, any normalized axis works.
+        *outAxis  = den > T(EPSILON) ? Vec3T<T>( q.x/den, q.y/den, q.z/den ) : Vec3T<T>( 1, 0, 0 );
+    }
+    /// Pitch, yaw, roll in radians, same order as FromEuler.
+    inline
+    Vec3T<T> ToEuler() const {
+        T y0 = T(2)*( w*y - z*x );
+        y0 = y0 > T(1) ? T(1) : y0;
+        y0 = y0 < T(-1) ? T(-1) : y0;
+        return Vec3T<T>(
+            ScalarMath<T>::Atan2( T(2)*( w*x + y*z ), T(1) - T(2)*( x*x + y*y ) ),
+            ScalarMath<T>::Asin( y0 ),
+            ScalarMath<T>::Atan2( T(2)*( w*z + x*y ), T(1) - T(2)*( y*y + z*z ) ) );
+    }
+    /// mat * q with q as a 4 component vector, like QuaternionTransform.
+    inline
+    QuatT Transform( const Mat4T<T>& mat ) const {
+        return QuatT(
+            mat.m0*x + mat.m4*y + mat.m8*z  + mat.m12*w,
+            mat.m1*x + mat.m5*y + mat.m9*z  + mat.m13*w,
+            mat.m2*x + mat.m6*y + mat.m10*z + mat.m14*w,
+            mat.m3*x + mat.m7*y + mat.m11*z + mat.m15*w );
+    }
+    /// Same tolerance as QuaternionEquals, q and -q are equal.
+    inline
+    bool Equals( const QuatT& q ) const {
+        return EqualsComponents( q ) || EqualsComponents( q.Scale( T(-1) ) );
+    }
+private:
+    inline
+    bool EqualsComponents( const QuatT& q ) const {
+        return Vec3T<T>::ScalarEquals( x, q.x ) && Vec3T<T>::ScalarEquals( y, q.y ) &&
+            Vec3T<T>::ScalarEquals( z, q.z ) && Vec3T<T>::ScalarEquals( w, q.w );
+    }
+};
+template<typename T> inline
+QuatT<T> operator+( const QuatT<T>& q1, const QuatT<T>& q2 ) {
+    return q1.Add( q2 );
+}
+template<typename T> inline
+QuatT<T> operator-( const QuatT<T>& q1, const QuatT<T>& q2 ) {
+    return q1.Subtract( q2 );
+}
+template<typename T> inline
+QuatT<T> operator*( const QuatT<T>& q1, T scale ) {
+    return q1.Scale( scale );
+}
+template<typename T> inline
+QuatT<T> operator*( T scale, const QuatT<T>& q1 ) {
+    return q1.Scale( scale );
+}
+template<typename T> inline
+bool operator==( const QuatT<T>& p, const QuatT<T>& q ) {
+    return p.Equals( q );
+}
+template<typename T> inline
+bool operator!=( const QuatT<T>& p, const QuatT<T>& q ) {
+    return !( p == q );
+}
+
+template<typename T>
+struct Mat4T {
+    union {
+        T array[16];
+        struct {
+            T m0 = 0, m4 = 0,  m8 = 0, m12 = 0;
+            T m1 = 0, m5 = 0,  m9 = 0, m13 = 0;
+            T m2 = 0, m6 = 0, m10 = 0, m14 = 0;
+            T m3 = 0, m7 = 0, m11 = 0, m15 = 0;
+        };
+    };
+
+    Mat4T() {}
+    Mat4T(
+        T m0, T m4, T  m8, T m12,
+        T m1, T m5, T  m9, T m13,
+        T m2, T m6, T m10, T m14,
+        T m3, T m7, T m11, T m15
+    ) :
+        m0(m0), m4(m4),   m8(m8), m12(m12),
+        m1(m1), m5(m5),   m9(m9), m13(m13),
+        m2(m2), m6(m6), m10(m10), m14(m14),
+        m3(m3), m7(m7), m11(m11), m15(m15)
+    {}
+    explicit Mat4T( const Matrix& mat ) :
+        Mat4T(
+            mat.m0, mat.m4,  mat.m8, mat.m12,
+            mat.m1, mat.m5,  mat.m9, mat.m13,
+            mat.m2, mat.m6, mat.m10, mat.m14,
+            mat.m3, mat.m7, mat.m11, mat.m15 )
+    {}
+    template<typename U>
+    explicit Mat4T( const Mat4T<U>& mat ) :
+        Mat4T(
+            (T)mat.m0, (T)mat.m4,  (T)mat.m8, (T)mat.m12,
+            (T)mat.m1, (T)mat.m5,  (T)mat.m9, (T)mat.m13,
+            (T)mat.m2, (T)mat.m6, (T)mat.m10, (T)mat.m14,
+            (T)mat.m3, (T)mat.m7, (T)mat.m11, (T)mat.m15 )
+    {}
+
+    /// Rounds each element to float.
+    inline
+    Mat4 ToMat4() const {
+        return Mat4(
+            (float)m0, (float)m4,  (float)m8, (float)m12,
+            (float)m1, (float)m5,  (float)m9, (float)m13,
+            (float)m2, (float)m6, (float)m10, (float)m14,
+            (float)m3, (float)m7, (float)m11, (float)m15 );
+    }
+    /// *this followed by Translate( -origin ) in T, then rounded to float.
+    /// Model matrices relative to the camera position keep their
+    /// translation small, pair it with a view matrix built at the origin.
+    inline
+    Mat4 RelativeTo( const Vec3T<T>& origin ) const {
+        return Mat4(
+            (float)( m0 - origin.x*m3 ), (float)( m4 - origin.x*m7 ),
+            (float)( m8 - origin.x*m11 ), (float)( m12 - origin.x*m15 ),
+            (float)( m1 - origin.y*m3 ), (float)( m5 - origin.y*m7 ),
+            (float)( m9 - origin.y*m11 ), (float)( m13 - origin.y*m15 ),
+            (float)( m2 - origin.z*m3 ), (float)( m6 - origin.z*m7 ),
+            (float)( m10 - origin.z*m11 ), (float)( m14 - origin.z*m15 ),
+            (float)m3, (float)m7, (float)m11, (float)m15 );
+    }
+    inline
+    T operator[]( size_t idx ) const {
+        return array[idx];
+    }
+    inline
+    T& operator[]( size_t idx ) {
+        return array[idx];
+    }
+
+    static inline
+    Mat4T Identity() {
+        return Mat4T(
+            1, 0, 0, 0,
+            0, 1, 0, 0,
+            0, 0, 1, 0,
+            0, 0, 0, 1 );
+    }
+    static inline
+    Mat4T Translate( T x, T y, T z ) {
+        return Mat4T(
+            1, 0, 0, x,
+            0, 1, 0, y,
+            0, 0, 1, z,
+            0, 0, 0, 1 );
+    }
+    static inline
+    Mat4T Translate( const Vec3T<T>& translate ) {
+        return Translate( translate.x, translate.y, translate.z );
+    }
+    static inline
+    Mat4T Rotate( const Vec3T<T>& axis, T angle ) {
+        Vec3T<T> a = axis;
+        T lengthSquared = a.LengthSqr();
+        if( ( lengthSquared != T(1) ) && ( lengthSquared != T(0) ) ) {
+            a = a.Scale( T(1)/ScalarMath<T>::Sqrt( lengthSquared ) );
+        }
+        T sinres = ScalarMath<T>::Sin( angle );
+        T cosres = ScalarMath<T>::Cos( angle );
+        T t = 1 - cosres;
+        return Mat4T(
+            a.x*a.x*t + cosres,     a.x*a.y*t - a.z*sinres, a.x*a.z*t + a.y*sinres, 0,
+            a.y*a.x*t + a.z*sinres, a.y*a.y*t + cosres,     a.y*a.z*t - a.x*sinres, 0,
+            a.z*a.x*t - a.y*sinres, a.z*a.y*t + a.x*sinres, a.z*a.z*t + cosres,     0,
+            0,                      0,                      0,                      1 );
+    }
+    static inline
+    Mat4T RotateX( T angle ) {
+        T cosres = ScalarMath<T>::Cos( angle );
+        T sinres = ScalarMath<T>::Sin( angle );
+        return Mat4T(
+            1, 0,       0,      0,
+            0, cosres, -sinres, 0,
+            0, sinres,  cosres, 0,
+            0, 0,       0,      1 );
+    }
+    static inline
+    Mat4T RotateY( T angle ) {
+        T cosres = ScalarMath<T>::Cos( angle );
+        T sinres = ScalarMath<T>::Sin( angle );
+        return Mat4T(
+             cosres, 0, sinres, 0,
+             0,      1, 0,      0,
+            -sinres, 0, cosres, 0,
+             0,      0, 0,      1 );
+    }
+    static inline
+    Mat4T RotateZ( T angle ) {
+        T cosres = ScalarMath<T>::Cos( angle );
+        T sinres = ScalarMath<T>::Sin( angle );
+        return Mat4T(
+            cosres, -sinres, 0, 0,
+            sinres,  cosres, 0, 0,
+            0,       0,      1, 0,
+            0,       0,      0, 1 );
+    }
+    /// Same as MatrixRotateXYZ.
+    static inline
+    Mat4T RotateXYZ( const Vec3T<T>& angle ) {
+        T cosz = ScalarMath<T>::Cos( -angle.z ), sinz = ScalarMath<T>::Sin( -angle.z );
+        T cosy = ScalarMath<T>::Cos( -angle.y ), siny = ScalarMath<T>::Sin( -angle.y );
+        T cosx = ScalarMath<T>::Cos( -angle.x ), sinx = ScalarMath<T>::Sin( -angle.x );
+        return Mat4T(
+            cosz*cosy,                        sinz*cosy,                        -siny,     0,
+            cosz*siny*sinx - sinz*cosx, sinz*siny*sinx + cosz*cosx, cosy*sinx, 0,
+            cosz*siny*cosx + sinz*sinx, sinz*siny*cosx - cosz*sinx, cosy*cosx, 0,
+            0,                                0,                                0,         1 );
+    }
+    /// Same as MatrixRotateZYX.
+    static inline
+    Mat4T RotateZYX( const Vec3T<T>& angle ) {
+        T cz = ScalarMath<T>::Cos( angle.z ), sz = ScalarMath<T>::Sin( angle.z );
+        T cy = ScalarMath<T>::Cos( angle.y ), sy = ScalarMath<T>::Sin( angle.y );
+        T cx = ScalarMath<T>::Cos( angle.x ), sx = ScalarMath<T>::Sin( angle.x );
+        return Mat4T(
+            cz*cy, cz*sy*sx - cx*sz, sz*sx + cz*cx*sy, 0,
+            cy*sz, cz*cx + sz*sy*sx, cx*sz*sy - cz*sx, 0,
+            -sy,   cy*sx,            cy*cx,            0,
+            0,     0,                0,                1 );
+    }
+    static inline
+    Mat4T Scale( T x, T y, T z ) {
+        return Mat4T(
+            x, 0, 0, 0,
+            0, y, 0, 0,
+            0, 0, z, 0,
+            0, 0, 0, 1 );
+    }
+    static inline
+    Mat4T Scale( const Vec3T<T>& scale ) {
+        return Scale( scale.x, scale.y, scale.z );
+    }
+    /// See ComposeMatrix.
+    static inline
+    Mat4T Compose( const Vec3T<T>& translation, const QuatT<T>& rotation, const Vec3T<T>& scale ) {
+        Mat4T r = rotation.ToMatrix();
+        r.m0 *= scale.x; r.m4 *= scale.y;  r.m8 *= scale.z;
+        r.m1 *= scale.x; r.m5 *= scale.y;  r.m9 *= scale.z;
+        r.m2 *= scale.x; r.m6 *= scale.y; r.m10 *= scale.z;
+        r.m12 = translation.x;
+        r.m13 = translation.y;
+        r.m14 = translation.z;
+        return r;
+    }
+    static inline
+    Mat4T Frustum( T left, T right, T bottom, T top, T nearPlane, T farPlane ) {
+        T rl = right - left;
+        T tb = top - bottom;
+        T fn = farPlane - nearPlane;
+        return Mat4T(
+            ( nearPlane*2 )/rl, 0,                  ( right + left )/rl,      0,
+            0,                  ( nearPlane*2 )/tb, ( top + bottom )/tb,      0,
+            0,                  0,                  -( farPlane + nearPlane )/fn, -( farPlane*nearPlane*2 )/fn,
+            0,                  0,                  -1,                       0 );
+    }
+    static inline
+    Mat4T Perspective( T fovY, T aspect, T nearPlane, T farPlane ) {
+        T top   = nearPlane*ScalarMath<T>::Tan( fovY*T(0.5) );
+        T right = top*aspect;
+        return Frustum( -right, right, -top, top, nearPlane, farPlane );
+    }
+    static inline
+    Mat4T Ortho( T left, T right, T bottom, T top, T nearPlane, T farPlane ) {
+        T rl = right - left;
+        T tb = top - bottom;
+        T fn = farPlane - nearPlane;
+        return Mat4T(
+            2/rl, 0,    0,     -( left + right )/rl,
+            0,    2/tb, 0,     -( top + bottom )/tb,
+            0,    0,    -2/fn, -( farPlane + nearPlane )/fn,
+            0,    0,    0,     1 );
+    }
+    static inline
+    Mat4T LookAt( const Vec3T<T>& eye, const Vec3T<T>& target, const Vec3T<T>& up ) {
+        Vec3T<T> vz = eye.Subtract( target );
+        T length = vz.Length();
+        vz = vz.Scale( T(1)/( length == T(0) ? T(1) : length ) );
+        Vec3T<T> vx = up.CrossProduct( vz );
+        length = vx.Length();
+        vx = vx.Scale( T(1)/( length == T(0) ? T(1) : length ) );
+        Vec3T<T> vy = vz.CrossProduct( vx );
+        return Mat4T(
+            vx.x, vx.y, vx.z, -vx.DotProduct( eye ),
+            vy.x, vy.y, vy.z, -vy.DotProduct( eye ),
+            vz.x, vz.y, vz.z, -vz.DotProduct( eye ),
+            0,    0,    0,    1 );
+    }
+
+    inline
+    T Determinant() const {
+        T a00 = m0,  a01 = m1,  a02 = m2,  a03 = m3;
+        T a10 = m4,  a11 = m5,  a12 = m6,  a13 = m7;
+        T a20 = m8,  a21 = m9,  a22 = m10, a23 = m11;
+        T a30 = m12, a31 = m13, a32 = m14, a33 = m15;
+        return
+            a30*a21*a12*a03 - a20*a31*a12*a03 - a30*a11*a22*a03 + a10*a31*a22*a03 +
+            a20*a11*a32*a03 - a10*a21*a32*a03 - a30*a21*a02*a13 + a20*a31*a02*a13 +
+            a30*a01*a22*a13 - a00*a31*a22*a13 - a20*a01*a32*a13 + a00*a21*a32*a13 +
+            a30*a11*a02*a23 - a10*a31*a02*a23 - a30*a01*a12*a23 + a00*a31*a12*a23 +
+            a10*a01*a32*a23 - a00*a11*a32*a23 - a20*a11*a02*a33 + a10*a21*a02*a33 +
+            a20*a01*a12*a33 - a00*a21*a12*a33 - a10*a01*a22*a33 + a00*a11*a22*a33;
+    }
+    inline
+    T Trace() const {
+        return m0 + m5 + m10 + m15;
+    }
+    inline
+    Mat4T Transpose() const {
+        return Mat4T(
+            m0,  m1,  m2,  m3,
+            m4,  m5,  m6,  m7,
+            m8,  m9,  m10, m11,
+            m12, m13, m14, m15 );
+    }
+    /// See DecomposeMatrix, same special cases.
+    inline
+    void Decompose( Vec3T<T>* translation, QuatT<T>* rotation, Vec3T<T>* scale ) const {
+        Vec3T<T> x( m0, m1, m2 ), y( m4, m5, m6 ), z( m8, m9, m10 );
+        T lengthSqrX = x.LengthSqr(), lengthSqrY = y.LengthSqr(), lengthSqrZ = z.LengthSqr();
+        Vec3T<T> s( ScalarMath<T>::Sqrt( lengthSqrX ), ScalarMath<T>::Sqrt( lengthSqrY ),
+            ScalarMath<T>::Sqrt( lengthSqrZ ) );
+        if( x.DotProduct( y.CrossProduct( z ) ) < T(0) ) {
+            s.x = -s.x;
+        }
+        *translation = Vec3T<T>( m12, m13, m14 );
+        *scale = s;
+
+        bool hasX = lengthSqrX >= T(FastMath::Min);
+        bool hasY = lengthSqrY >= T(FastMath::Min);
+        bool hasZ = lengthSqrZ >= T(FastMath::Min);
+        if( hasX + hasY + hasZ < 2 ) {
+            *rotation = QuatT<T>::Identity();
+            if( hasX || hasY || hasZ ) {
+                T* length = hasX ? &scale->x : hasY ? &scale->y : &scale->z;
+                Vec3T<T> unit( hasX ? 1 : 0, hasY ? 1 : 0, hasZ ? 1 : 0 );
+                Vec3T<T> axis = ( hasX ? x : hasY ? y : z ).Scale( T(1)/ *length );
+                if( axis.DotProduct( unit ) < T(0) ) {
+                    axis = axis.Negate();
+                    *length = -*length;
+                }
+                *rotation = QuatT<T>::FromVector3ToVector3( unit, axis );
+            }
+            return;
+        }
+        x = hasX ? x.Scale( T(1)/s.x ) : y.Scale( T(1)/s.y ).CrossProduct( z.Scale( T(1)/s.z ) ).Normalize();
+        y = hasY ? y.Scale( T(1)/s.y ) : z.Scale( T(1)/s.z ).CrossProduct( x ).Normalize();
+        z = hasZ ? z.Scale( T(1)/s.z ) : x.CrossProduct( y ).Normalize();
+        *rotation = QuatT<T>::FromMatrix( Mat4T(
+            x.x, y.x, z.x, 0,
+            x.y, y.y, z.y, 0,
+            x.z, y.z, z.z, 0,
+            0,   0,   0,   1 ) ).Normalize();
+    }
+    inline
+    Mat4T Invert() const {
+        T a00 = m0,  a01 = m1,  a02 = m2,  a03 = m3;
+        T a10 = m4,  a11 = m5,  a12 = m6,  a13 = m7;
+        T a20 = m8,  a21 = m9,  a22 = m10, a23 = m11;
+        T a30 = m12, a31 = m13, a32 = m14, a33 = m15;
+
+        T b00 = a00*a11 - a01*a10;
+        T b01 = a00*a12 - a02*a10;
+        T b02 = a00*a13 - a03*a10;
+        T b03 = a01*a12 - a02*a11;
+        T b04 = a01*a13 - a03*a11;
+        T b05 = a02*a13 - a03*a12;
+        T b06 = a20*a31 - a21*a30;
+        T b07 = a20*a32 - a22*a30;
+        T b08 = a20*a33 - a23*a30;
+        T b09 = a21*a32 - a22*a31;
+        T b10 = a21*a33 - a23*a31;
+        T b11 = a22*a33 - a23*a32;
+
+        T invDet = T(1)/( b00*b11 - b01*b10 + b02*b09 + b03*b08 - b04*b07 + b05*b06 );
+
+        Mat4T result;
+        result.m0  = (  a11*b11 - a12*b10 + a13*b09 )*invDet;
+        result.m1  = ( -a01*b11 + a02*b10 - a03*b09 )*invDet;
+        result.m2  = (  a31*b05 - a32*b04 + a33*b03 )*invDet;
+        result.m3  = ( -a21*b05 + a22*b04 - a23*b03 )*invDet;
+        result.m4  = ( -a10*b11 + a12*b08 - a13*b07 )*invDet;
+        result.m5  = (  a00*b11 - a02*b08 + a03*b07 )*invDet;
+        result.m6  = ( -a30*b05 + a32*b02 - a33*b01 )*invDet;
+        result.m7  = (  a20*b05 - a22*b02 + a23*b01 )*invDet;
+        result.m8  = (  a10*b10 - a11*b08 + a13*b06 )*invDet;
+        result.m9  = ( -a00*b10 + a01*b08 - a03*b06 )*invDet;
+        result.m10 = (  a30*b04 - a31*b02 + a33*b00 )*invDet;
+        result.m11 = ( -a20*b04 + a21*b02 - a23*b00 )*invDet;
+        result.m12 = ( -a10*b09 + a11*b07 - a12*b06 )*invDet;
+        result.m13 = (  a00*b09 - a01*b07 + a02*b06 )*invDet;
+        result.m14 = ( -a30*b03 + a31*b01 - a32*b00 )*invDet;
+        result.m15 = (  a20*b03 - a21*b01 + a22*b00 )*invDet;
+        return result;
+    }
+    inline
+    Mat4T Add( const Mat4T& right ) const {
+        Mat4T result;
+        for( int i = 0; i < 16; ++i ) {
+            result.array[i] = array[i] + right.array[i];
+        }
+        return result;
+    }
+    inline
+    Mat4T Subtract( const Mat4T& right ) const {
+        Mat4T result;
+        for( int i = 0; i < 16; ++i ) {
+            result.array[i] = array[i] - right.array[i];
+        }
+        return result;
+    }
+    /// Same order as MatrixMultiply, *this is applied first.
+    inline
+    Mat4T Multiply( const Mat4T& right ) const {
+        Mat4T result;
+        // NOTE(alicia): array is row major, row r is array[r * 4 .. r * 4 + 3].
+        for( int r = 0; r < 4; ++r ) {
+            for( int c = 0; c < 4; ++c ) {
+                result.array[r * 4 + c] =
+                    right.array[r * 4 + 0] * array[0 * 4 + c] +
+                    right.array[r * 4 + 1] * array[1 * 4 + c] +
+                    right.array[r * 4 + 2] * array[2 * 4 + c] +
+                    right.array[r * 4 + 3] * array[3 * 4 + c];
+            }
+        }
+        return result;
+    }
+};
+template<typename T> inline
+Mat4T<T> operator+( const Mat4T<T>& left, const Mat4T<T>& right ) {
+    return left.Add( right );
+}
+template<typename T> inline
+Mat4T<T> operator-( const Mat4T<T>& left, const Mat4T<T>& right ) {
+    return left.Subtract( right );
+}
+template<typename T> inline
+Mat4T<T> operator*( const Mat4T<T>& left, const Mat4T<T>& right ) {
+    return left.Multiply( right );
+}
+
+typedef Vec3T<double> Vec3d;
+typedef QuatT<double> Quatd;
+typedef Mat4T<double> Mat4d;
+static_assert( sizeof(Vec3d) == 3 * sizeof(double), "Vec3d must be tightly packed" );
+
+// NOTE(alicia): packed storage.
+// Vec3Half      6 bytes, IEEE half floats, round to nearest even.
+// NormalOct16   4 bytes, unit vectors folded onto an octahedron,
+//               two snorm16, max error 6.5e-5 rad.
+// QuatPacked32  4 bytes, smallest three, 2 bit index + 3 x 10 bits,
+//               max error 1.7e-3 per component.
+// QuatPacked48  6 bytes, smallest three, 2 bit index + 3 x 15 bits,
+//               max error 5.5e-5 per component.
+// quaternions come back with the largest component positive
+// (q and -q are the same rotation).
+// the bulk Encode/Decode overloads work 4 (8 floats for Vec3Half)
+// elements at a time, their results match the single element ones.
+struct Packing {
+    static constexpr float OctScale     = 32767.0f;
+    static constexpr float Sqrt1_2      = 0.707106781f;
+    static constexpr float Sqrt2        = 1.41421356f;
+    static constexpr int   QuatMax32    = 1023;
+    static constexpr int   QuatMax48    = 32767;
+
+    /// Round to nearest even, like cvtps2dq.
+    static inline
+    int Round( float x ) {
+#if defined(RAYMATH_CPP_SSE2)
+        return _mm_cvtss_si32( _mm_set_ss( x ) );
+#else
+        return (int)lrintf( x );
+#endif
+    }
+    static inline
+    unsigned int FloatBits( float x ) {
+        union { float f; unsigned int u; } bits;
+        bits.f = x;
+        return bits.u;
+    }
+    static inline
+    float BitsFloat( unsigned int x ) {
+        union { unsigned int u; float f; } bits;
+        bits.u = x;
+        return bits.f;
+    }
+    /// Round to nearest even, overflow goes to infinity, NaN to 0x7E00.
+    static inline
+    unsigned short FloatToHalf( float x ) {
+#if defined(RAYMATH_CPP_F16C)
+        return (unsigned short)_cvtss_sh( x, _MM_FROUND_TO_NEAREST_INT );
+#else
+        // NOTE(alicia): Fabian Giesen's float_to_half_fast3_rtne.
+        unsigned int bits = FloatBits( x );
+        unsigned int sign = bits & 0x80000000u;
+        bits ^= sign;
+        unsigned int result;
+        if( bits >= ( 127u + 16u ) << 23 ) {
+            result = bits > 0x7F800000u ? 0x7E00u : 0x7C00u;
+        } else if( bits < 113u << 23 ) {
+            // NOTE(alicia): subnormal, let the float add do the rounding.
+            const unsigned int magic = ( ( 127u - 15u ) + ( 23u - 10u ) + 1u ) << 23;
+            result = FloatBits( BitsFloat( bits ) + BitsFloat( magic ) ) - magic;
+        } else {
+            unsigned int odd = ( bits >> 13 ) & 1u;
+            bits += ( ( 15u - 127u ) << 23 ) + 0xFFFu + odd;
+            result = bits >> 13;
+        }
+        return (unsigned short)( result | ( sign >> 16 ) );
+#endif
+    }
+    /// Exact.
+    static inline
+    float HalfToFloat( unsigned short x ) {
+#if defined(RAYMATH_CPP_F16C)
+        return _cvtsh_ss( x );
+#else
+        unsigned int bits     = ( x & 0x7FFFu ) << 13;
+        unsigned int exponent = bits & ( 0x7C00u << 13 );
+        bits += ( 127u - 15u ) << 23;
+        if( exponent == 0x7C00u << 13 ) {
+            bits += ( 128u - 16u ) << 23;
+        } else if( exponent == 0 ) {
+            bits += 1u << 23;
+            bits  = FloatBits( BitsFloat( bits ) - BitsFloat( 113u << 23 ) );
+        }
+        return BitsFloat( bits | ( ( x & 0x8000u ) << 16 ) );
+#endif
+    }
+
+    static inline
+    void EncodeOct( Vector3 n, short* x, short* y ) {
+        float sum     = fabsf( n.x ) + fabsf( n.y ) + fabsf( n.z );
+        float inverse = sum > 0.0f ? 1.0f / sum : 0.0f;
+        float px = n.x * inverse;
+        float py = n.y * inverse;
+        if( n.z < 0.0f ) {
+            float fx = ( 1.0f - fabsf( py ) ) * copysignf( 1.0f, px );
+            float fy = ( 1.0f - fabsf( px ) ) * copysignf( 1.0f, py );
+            px = fx;
+            py = fy;
+        }
+        *x = (short)Round( px * OctScale );
+        *y = (short)Round( py * OctScale );
+    }
+    static inline
+    Vector3 DecodeOct( short x, short y ) {
+        Vector3 v;
+        v.x = (float)x * ( 1.0f / OctScale );
+        v.y = (float)y * ( 1.0f / OctScale );
+        v.x = v.x > -1.0f ? v.x : -1.0f;
+        v.y = v.y > -1.0f ? v.y : -1.0f;
+        v.z = 1.0f - fabsf( v.x ) - fabsf( v.y );
+        float t = v.z < 0.0f ? -v.z : 0.0f;
+        v.x -= copysignf( t, v.x );
+        v.y -= copysignf( t, v.y );
+        float inverse = 1.0f / sqrtf( v.x * v.x + v.y * v.y + v.z * v.z );
+        return Vector3{ v.x * inverse, v.y * inverse, v.z * inverse };
+    }
+
+    static inline
+    int QuantizeQuat( float v, int max ) {
+        float t = v * Sqrt1_2 + 0.5f;
+        t = t > 0.0f ? t : 0.0f;
+        t = t < 1.0f ? t : 1.0f;
+        return Round( t * (float)max );
+    }
+    static inline
+    float DequantizeQuat( int v, int max ) {
+        return ( (float)v * ( 1.0f / (float)max ) - 0.5f ) * Sqrt2;
+    }
+    /// Index of the dropped component and the other three, quantized.
+    static inline
+    void EncodeQuat( Quaternion q, int max, int* index, int* a, int* b, int* c ) {
+        float v[4] = { q.x, q.y, q.z, q.w };
+        int largest = 0;
+        for( int i = 1; i < 4; ++i ) {
+            if( fabsf( v[i] ) > fabsf( v[largest] ) ) {
+                largest = i;
+            }
+        }
+        bool negate = v[largest] < 0.0f;
+        int quantized[3];
+        for( int i = 0, j = 0; i < 4; ++i ) {
+            if( i != largest ) {
+                quantized[j++] = QuantizeQuat( negate ? -v[i] : v[i], max );
+            }
+        }
+        *index = largest;
+        *a     = quantized[0];
+        *b     = quantized[1];
+        *c     = quantized[2];
+    }
+    static inline
+    Quaternion DecodeQuat( int index, int qa, int qb, int qc, int max ) {
+        float a = DequantizeQuat( qa, max );
+        float b = DequantizeQuat( qb, max );
+        float c = DequantizeQuat( qc, max );
+        float d = 1.0f - a * a - b * b - c * c;
+        d = sqrtf( d > 0.0f ? d : 0.0f );
+        switch( index ) {
+            case 0:  return Quaternion{ d, a, b, c };
+            case 1:  return Quaternion{ a, d, b, c };
+            case 2:  return Quaternion{ a, b, d, c };
+            default: return Quaternion{ a, b, c, d };
+        }
+    }
+
+#if defined(RAYMATH_CPP_SSE2)
+    /// 4 floats to halves in the low 16 bits of each lane,
+    /// sign extended so _mm_packs_epi32 keeps them.
+    static inline
+    __m128i FloatToHalf( __m128 x ) {
+#if defined(RAYMATH_CPP_F16C)
+        return _mm_srai_epi32( _mm_slli_epi32( _mm_cvtepu16_epi32(
+            _mm_cvtps_ph( x, _MM_FROUND_TO_NEAREST_INT ) ), 16 ), 16 );
+#else
+        // NOTE(alicia): Fabian Giesen's float_to_half_SSE2.
+        const __m128i magic = _mm_set1_epi32( ( ( 127 - 15 ) + ( 23 - 10 ) + 1 ) << 23 );
+        __m128  sign     = _mm_and_ps( x, _mm_castsi128_ps( _mm_set1_epi32( (int)0x80000000u ) ) );
+        __m128  absolute = _mm_xor_ps( x, sign );
+        __m128i bits     = _mm_castps_si128( absolute );
+        __m128i special  = _mm_or_si128(
+            _mm_and_si128( _mm_castps_si128( _mm_cmpunord_ps( absolute, absolute ) ),
+                _mm_set1_epi32( 0x200 ) ),
+            _mm_set1_epi32( 0x7C00 ) );
+        __m128i regular   = _mm_cmpgt_epi32( _mm_set1_epi32( ( 127 + 16 ) << 23 ), bits );
+        __m128i subnormal = _mm_cmpgt_epi32( _mm_set1_epi32( 113 << 23 ), bits );
+
+        __m128i small = _mm_sub_epi32( _mm_castps_si128(
+            _mm_add_ps( absolute, _mm_castsi128_ps( magic ) ) ), magic );
+        __m128i odd    = _mm_srai_epi32( _mm_slli_epi32( bits, 31 - 13 ), 31 );
+        __m128i normal = _mm_srli_epi32( _mm_sub_epi32( _mm_add_epi32( bits,
+            _mm_set1_epi32( 0xFFF - ( ( 127 - 15 ) << 23 ) ) ), odd ), 13 );
+
+        __m128i result = _mm_or_si128(
+            _mm_and_si128( subnormal, small ), _mm_andnot_si128( subnormal, normal ) );
+        result = _mm_or_si128(
+            _mm_and_si128( regular, result ), _mm_andnot_si128( regular, special ) );
+        return _mm_or_si128( result, _mm_srai_epi32( _mm_castps_si128( sign ), 16 ) );
+#endif
+    }
+    /// Halves in the low 16 bits of each lane to floats.
+    static inline
+    __m128 HalfToFloat( __m128i x ) {
+#if defined(RAYMATH_CPP_F16C)
+        return _mm_cvtph_ps( _mm_packs_epi32(
+            _mm_srai_epi32( _mm_slli_epi32( x, 16 ), 16 ), _mm_setzero_si128() ) );
+#else
+        // NOTE(alicia): Fabian Giesen's half_to_float_SSE2,
+        // subnormal halves go through a float multiply, don't run with DAZ.
+        __m128i magnitude = _mm_and_si128( x, _mm_set1_epi32( 0x7FFF ) );
+        __m128i sign      = _mm_slli_epi32( _mm_xor_si128( x, magnitude ), 16 );
+        __m128  scaled    = _mm_mul_ps( _mm_castsi128_ps( _mm_slli_epi32( magnitude, 13 ) ),
+            _mm_castsi128_ps( _mm_set1_epi32( ( 254 - 15 ) << 23 ) ) );
+        __m128i infinite  = _mm_and_si128(
+            _mm_cmpgt_epi32( magnitude, _mm_set1_epi32( 0x7BFF ) ),
+            _mm_set1_epi32( 255 << 23 ) );
+        return _mm_or_ps( scaled, _mm_castsi128_ps( _mm_or_si128( sign, infinite ) ) );
+#endif
+    }
+    static inline
+    __m128 Abs( __m128 x ) {
+        return _mm_andnot_ps( _mm_set1_ps( -0.0f ), x );
+    }
+    /// 1 or -1 with the sign of x.
+    static inline
+    __m128 Sign( __m128 x ) {
+        return _mm_or_ps( _mm_and_ps( x, _mm_set1_ps( -0.0f ) ), _mm_set1_ps( 1.0f ) );
+    }
+    static inline
+    __m128i Round( __m128 x ) {
+        return _mm_cvtps_epi32( x );
+    }
+    static inline
+    void EncodeOct( __m128 x, __m128 y, __m128 z, __m128i* ox, __m128i* oy ) {
+        __m128 sum     = _mm_add_ps( _mm_add_ps( Abs( x ), Abs( y ) ), Abs( z ) );
+        __m128 inverse = _mm_and_ps( _mm_cmpgt_ps( sum, _mm_setzero_ps() ),
+            _mm_div_ps( _mm_set1_ps( 1.0f ), sum ) );
+        __m128 px   = _mm_mul_ps( x, inverse );
+        __m128 py   = _mm_mul_ps( y, inverse );
+        __m128 one  = _mm_set1_ps( 1.0f );
+        __m128 fold = _mm_cmplt_ps( z, _mm_setzero_ps() );
+        __m128 fx   = _mm_mul_ps( _mm_sub_ps( one, Abs( py ) ), Sign( px ) );
+        __m128 fy   = _mm_mul_ps( _mm_sub_ps( one, Abs( px ) ), Sign( py ) );
+        __m128 scale = _mm_set1_ps( OctScale );
+        *ox = Round( _mm_mul_ps( Simd4::Select( fold, fx, px ), scale ) );
+        *oy = Round( _mm_mul_ps( Simd4::Select( fold, fy, py ), scale ) );
+    }
+    static inline
+    void DecodeOct( __m128i ox, __m128i oy, __m128* x, __m128* y, __m128* z ) {
+        __m128 scale = _mm_set1_ps( 1.0f / OctScale );
+        __m128 vx = _mm_max_ps( _mm_mul_ps( _mm_cvtepi32_ps( ox ), scale ), _mm_set1_ps( -1.0f ) );
+        __m128 vy = _mm_max_ps( _mm_mul_ps( _mm_cvtepi32_ps( oy ), scale ), _mm_set1_ps( -1.0f ) );
+        __m128 vz = _mm_sub_ps( _mm_sub_ps( _mm_set1_ps( 1.0f ), Abs( vx ) ), Abs( vy ) );
+        __m128 t  = _mm_and_ps( _mm_cmplt_ps( vz, _mm_setzero_ps() ),
+            _mm_sub_ps( _mm_setzero_ps(), vz ) );
+        __m128 signMask = _mm_set1_ps( -0.0f );
+        vx = _mm_sub_ps( vx, _mm_or_ps( t, _mm_and_ps( vx, signMask ) ) );
+        vy = _mm_sub_ps( vy, _mm_or_ps( t, _mm_and_ps( vy, signMask ) ) );
+        __m128 inverse = _mm_div_ps( _mm_set1_ps( 1.0f ), _mm_sqrt_ps( _mm_add_ps( _mm_add_ps(
+            _mm_mul_ps( vx, vx ), _mm_mul_ps( vy, vy ) ), _mm_mul_ps( vz, vz ) ) ) );
+        *x = _mm_mul_ps( vx, inverse );
+        *y = _mm_mul_ps( vy, inverse );
+        *z = _mm_mul_ps( vz, inverse );
+    }
+    static inline
+    __m128i QuantizeQuat( __m128 v, __m128 max ) {
+        __m128 t = _mm_add_ps( _mm_mul_ps( v, _mm_set1_ps( Sqrt1_2 ) ), _mm_set1_ps( 0.5f ) );
+        t = _mm_min_ps( _mm_max_ps( t, _mm_setzero_ps() ), _mm_set1_ps( 1.0f ) );
+        return Round( _mm_mul_ps( t, max ) );
+    }
+    static inline
+    __m128 DequantizeQuat( __m128i v, __m128 inverseMax ) {
+        return _mm_mul_ps( _mm_sub_ps( _mm_mul_ps( _mm_cvtepi32_ps( v ), inverseMax ),
+            _mm_set1_ps( 0.5f ) ), _mm_set1_ps( Sqrt2 ) );
+    }
+    static inline
+    void EncodeQuat( __m128 x, __m128 y, __m128 z, __m128 w, int max,
+        __m128i* index, __m128i* a, __m128i* b, __m128i* c
+    ) {
+        __m128 ax = Abs( x ), ay = Abs( y ), az = Abs( z ), aw = Abs( w );
+        __m128 largest = _mm_max_ps( _mm_max_ps( ax, ay ), _mm_max_ps( az, aw ) );
+        __m128 is0  = _mm_cmpeq_ps( ax, largest );
+        __m128 is1  = _mm_andnot_ps( is0, _mm_cmpeq_ps( ay, largest ) );
+        __m128 is01 = _mm_or_ps( is0, is1 );
+        __m128 is2  = _mm_andnot_ps( is01, _mm_cmpeq_ps( az, largest ) );
+        __m128 is3  = _mm_andnot_ps( _mm_or_ps( is01, is2 ), _mm_castsi128_ps( _mm_set1_epi32( -1 ) ) );
+
+        __m128 value = _mm_or_ps( _mm_or_ps( _mm_and_ps( is0, x ), _mm_and_ps( is1, y ) ),
+            _mm_or_ps( _mm_and_ps( is2, z ), _mm_and_ps( is3, w ) ) );
+        __m128 negate = _mm_and_ps( _mm_cmplt_ps( value, _mm_setzero_ps() ), _mm_set1_ps( -0.0f ) );
+        x = _mm_xor_ps( x, negate );
+        y = _mm_xor_ps( y, negate );
+        z = _mm_xor_ps( z, negate );
+        w = _mm_xor_ps( w, negate );
+
+        __m128 scale = _mm_set1_ps( (float)max );
+        *a = QuantizeQuat( Simd4::Select( is0, y, x ), scale );
+        *b = QuantizeQuat( Simd4::Select( is01, z, y ), scale );
+        *c = QuantizeQuat( Simd4::Select( is3, z, w ), scale );
+        *index = _mm_or_si128(
+            _mm_and_si128( _mm_castps_si128( _mm_or_ps( is1, is3 ) ), _mm_set1_epi32( 1 ) ),
+            _mm_and_si128( _mm_castps_si128( _mm_or_ps( is2, is3 ) ), _mm_set1_epi32( 2 ) ) );
+    }
+    static inline
+    void DecodeQuat( __m128i index, __m128i qa, __m128i qb, __m128i qc, int max,
+        __m128* x, __m128* y, __m128* z, __m128* w
+    ) {
+        __m128 inverseMax = _mm_set1_ps( 1.0f / (float)max );
+        __m128 a = DequantizeQuat( qa, inverseMax );
+        __m128 b = DequantizeQuat( qb, inverseMax );
+        __m128 c = DequantizeQuat( qc, inverseMax );
+        __m128 d = _mm_sub_ps( _mm_sub_ps( _mm_sub_ps( _mm_set1_ps( 1.0f ),
+            _mm_mul_ps( a, a ) ), _mm_mul_ps( b, b ) ), _mm_mul_ps( c, c ) );
+        d = _mm_sqrt_ps( _mm_max_ps( d, _mm_setzero_ps() ) );
+
+        __m128 is0 = _mm_castsi128_ps( _mm_cmpeq_epi32( index, _mm_setzero_si128() ) );
+        __m128 is1 = _mm_castsi128_ps( _mm_cmpeq_epi32( index, _mm_set1_epi32( 1 ) ) );
+        __m128 is2 = _mm_castsi128_ps( _mm_cmpeq_epi32( index, _mm_set1_epi32( 2 ) ) );
+        __m128 is3 = _mm_castsi128_ps( _mm_cmpeq_epi32( index, _mm_set1_epi32( 3 ) ) );
+        *x = Simd4::Select( is0, d, a );
+        *y = Simd4::Select( is0, a, Simd4::Select( is1, d, b ) );
+        *z = Simd4::Select( is3, c, Simd4::Select( is2, d, b ) );
+        *w = Simd4::Select( is3, d, c );
+    }
+    /// Writes 4 records of 3 shorts, a/b/c hold one short per lane.
+    static inline
+    void StoreQuat48( unsigned short* out, __m128i a, __m128i b, __m128i c ) {
+        // NOTE(alicia): as 32 bit words the records are
+        // a0b0 c0a1 b1c1 a2b2 c2a3 b3c3.
+        __m128 ab = _mm_castsi128_ps( _mm_or_si128( a, _mm_slli_epi32( b, 16 ) ) );
+        __m128 bc = _mm_castsi128_ps( _mm_or_si128( b, _mm_slli_epi32( c, 16 ) ) );
+        __m128 ca = _mm_castsi128_ps( _mm_or_si128( c, _mm_slli_epi32( _mm_srli_si128( a, 4 ), 16 ) ) );
+        __m128 lo = _mm_shuffle_ps( _mm_unpacklo_ps( ab, ca ),
+            _mm_shuffle_ps( bc, ab, _MM_SHUFFLE( 2, 2, 1, 1 ) ), _MM_SHUFFLE( 2, 0, 1, 0 ) );
+        __m128 hi = _mm_shuffle_ps( ca, bc, _MM_SHUFFLE( 3, 3, 2, 2 ) );
+        _mm_storeu_si128( (__m128i*)out, _mm_castps_si128( lo ) );
+        _mm_storel_epi64( (__m128i*)( out + 8 ),
+            _mm_shuffle_epi32( _mm_castps_si128( hi ), _MM_SHUFFLE( 3, 3, 2, 0 ) ) );
+    }
+    /// Reads 4 records of 3 shorts into one short per lane.
+    static inline
+    void LoadQuat48( const unsigned short* q, __m128i* a, __m128i* b, __m128i* c ) {
+        __m128 lo = _mm_castsi128_ps( _mm_loadu_si128( (const __m128i*)q ) );
+        __m128 hi = _mm_castsi128_ps( _mm_loadl_epi64( (const __m128i*)( q + 8 ) ) );
+        // NOTE(alicia): w0 w1 w3 w4, w0 w2 w3 w5 and w1 w2 w4 w5,
+        // a/b/c sit in the low or high half depending on the lane.
+        __m128i wa = _mm_castps_si128( _mm_shuffle_ps( lo,
+            _mm_shuffle_ps( lo, hi, _MM_SHUFFLE( 0, 0, 3, 3 ) ), _MM_SHUFFLE( 2, 0, 1, 0 ) ) );
+        __m128i wb = _mm_castps_si128( _mm_shuffle_ps( lo,
+            _mm_shuffle_ps( lo, hi, _MM_SHUFFLE( 1, 1, 3, 3 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+        __m128i wc = _mm_castps_si128( _mm_shuffle_ps( lo, hi, _MM_SHUFFLE( 1, 0, 2, 1 ) ) );
+        __m128i odd  = _mm_set_epi32( -1, 0, -1, 0 );
+        __m128i mask = _mm_set1_epi32( 0xFFFF );
+        *a = _mm_or_si128( _mm_andnot_si128( odd, _mm_and_si128( wa, mask ) ),
+            _mm_and_si128( odd, _mm_srli_epi32( wa, 16 ) ) );
+        *b = _mm_or_si128( _mm_andnot_si128( odd, _mm_srli_epi32( wb, 16 ) ),
+            _mm_and_si128( odd, _mm_and_si128( wb, mask ) ) );
+        *c = _mm_or_si128( _mm_andnot_si128( odd, _mm_and_si128( wc, mask ) ),
+            _mm_and_si128( odd, _mm_srli_epi32( wc, 16 ) ) );
+    }
+#endif
+};
+
+/// Vector3 as 3 half floats.
+struct Vec3Half {
+    unsigned short x = 0, y = 0, z = 0;
+
+    Vec3Half() {}
+    explicit Vec3Half( Vector3 v ) :
+        x( Packing::FloatToHalf( v.x ) ),
+        y( Packing::FloatToHalf( v.y ) ),
+        z( Packing::FloatToHalf( v.z ) )
+    {}
+    inline
+    Vec3 ToVec3() const {
+        return Vec3( Packing::HalfToFloat( x ), Packing::HalfToFloat( y ), Packing::HalfToFloat( z ) );
+    }
+};
+/// Unit vector, octahedral encoding in two snorm16.
+struct NormalOct16 {
+    short x = 0, y = 0;
+
+    NormalOct16() {}
+    /// normal should be unit length, other lengths are projected.
+    explicit NormalOct16( Vector3 normal ) {
+        Packing::EncodeOct( normal, &x, &y );
+    }
+    inline
+    Vec3 ToVec3() const {
+        return Packing::DecodeOct( x, y );
+    }
+};
+/// Unit quaternion, smallest three in 32 bits:
+/// bits 30-31 index of the dropped component, then 3 x 10 bits.
+struct QuatPacked32 {
+    unsigned int bits = 0;
+
+    QuatPacked32() {}
+    explicit QuatPacked32( Quaternion q ) {
+        int index, a, b, c;
+        Packing::EncodeQuat( q, Packing::QuatMax32, &index, &a, &b, &c );
+        bits = ( (unsigned int)index << 30 ) | ( (unsigned int)a << 20 ) |
+            ( (unsigned int)b << 10 ) | (unsigned int)c;
+    }
+    inline
+    Quat ToQuat() const {
+        return Packing::DecodeQuat( (int)( bits >> 30 ), (int)( ( bits >> 20 ) & 1023u ),
+            (int)( ( bits >> 10 ) & 1023u ), (int)( bits & 1023u ), Packing::QuatMax32 );
+    }
+};
+/// Unit quaternion, smallest three in 48 bits: 3 x 15 bits,
+/// bit 15 of bits[0] and bits[1] hold the index of the dropped component.
+/// bit 15 of bits[2] is unused and ignored.
+struct QuatPacked48 {
+    unsigned short bits[3] = {};
+
+    QuatPacked48() {}
+    explicit QuatPacked48( Quaternion q ) {
+        int index, a, b, c;
+        Packing::EncodeQuat( q, Packing::QuatMax48, &index, &a, &b, &c );
+        bits[0] = (unsigned short)( a | ( ( index & 1 ) << 15 ) );
+        bits[1] = (unsigned short)( b | ( ( index >> 1 ) << 15 ) );
+        bits[2] = (unsigned short)c;
+    }
+    inline
+    Quat ToQuat() const {
+        return Packing::DecodeQuat( ( bits[0] >> 15 ) | ( ( bits[1] >> 15 ) << 1 ),
+            bits[0] & 0x7FFF, bits[1] & 0x7FFF, bits[2] & 0x7FFF, Packing::QuatMax48 );
+    }
+};
+static_assert( sizeof(Vec3Half) == 6,     "Vec3Half must be 6 bytes" );
+static_assert( sizeof(NormalOct16) == 4,  "NormalOct16 must be 4 bytes" );
+static_assert( sizeof(QuatPacked32) == 4, "QuatPacked32 must be 4 bytes" );
+static_assert( sizeof(QuatPacked48) == 6, "QuatPacked48 must be 6 bytes" );
+
+// NOTE(alicia): SoA streams.
+// every component lives in its own float array so bulk loops
+// touch contiguous memory and vectorize without shuffles.
+// out streams may alias the inputs (same index in, same index out).
+struct SoAStream {
+    static inline
+    void Add( const float* a, const float* b, float* out, size_t count ) {
+        Apply<AddOp>( a, b, out, count );
+    }
+    static inline
+    void AddValue( const float* a, float value, float* out, size_t count ) {
+        ApplyValue<AddOp>( a, value, out, count );
+    }
+    static inline
+    void Subtract( const float* a, const float* b, float* out, size_t count ) {
+        Apply<SubtractOp>( a, b, out, count );
+    }
+    static inline
+    void Multiply( const float* a, const float* b, float* out, size_t count ) {
+        Apply<MultiplyOp>( a, b, out, count );
+    }
+    static inline
+    void Scale( const float* a, float scale, float* out, size_t count ) {
+        ApplyValue<MultiplyOp>( a, scale, out, count );
+    }
+    static inline
+    void Divide( const float* a, const float* b, float* out, size_t count ) {
+        Apply<DivideOp>( a, b, out, count );
+    }
+    static inline
+    void Invert( const float* a, float* out, size_t count ) {
+        size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+        __m128 one = _mm_set1_ps( 1.0f );
+        for( ; i + 4 <= count; i += 4 ) {
+            _mm_storeu_ps( out + i, _mm_div_ps( one, _mm_loadu_ps( a + i ) ) );
+        }
+#endif
+        for( ; i < count; ++i ) {
+            out[i] = 1.0f / a[i];
+        }
+    }
+    static inline
+    void Min( const float* a, const float* b, float* out, size_t count ) {
+        Apply<MinOp>( a, b, out, count );
+    }
+    static inline
+    void MinValue( const float* a, float value, float* out, size_t count ) {
+        ApplyValue<MinOp>( a, value, out, count );
+    }
+    static inline
+    void Max( const float* a, const float* b, float* out, size_t count ) {
+        Apply<MaxOp>( a, b, out, count );
+    }
+    static inline
+    void MaxValue( const float* a, float value, float* out, size_t count ) {
+        ApplyValue<MaxOp>( a, value, out, count );
+    }
+    static inline
+    void ClampValue( const float* a, float min, float max, float* out, size_t count ) {
+        ApplyValue<MaxOp>( a, min, out, count );
+        ApplyValue<MinOp>( out, max, out, count );
+    }
+    static inline
+    void Lerp( const float* a, const float* b, float amount, float* out, size_t count ) {
+        size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+        __m128 t = _mm_set1_ps( amount );
+        for( ; i + 4 <= count; i += 4 ) {
+            __m128 va = _mm_loadu_ps( a + i );
+            __m128 vb = _mm_loadu_ps( b + i );
+            _mm_storeu_ps( out + i,
+                _mm_add_ps( va, _mm_mul_ps( t, _mm_sub_ps( vb, va ) ) ) );
+        }
+#endif
+        for( ; i < count; ++i ) {
+            out[i] = a[i] + amount * ( b[i] - a[i] );
+        }
+    }
+    static inline
+    void LerpValue( const float* a, float b, float amount, float* out, size_t count ) {
+        size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+        __m128 t  = _mm_set1_ps( amount );
+        __m128 vb = _mm_set1_ps( b );
+        for( ; i + 4 <= count; i += 4 ) {
+            __m128 va = _mm_loadu_ps( a + i );
+            _mm_storeu_ps( out + i,
+                _mm_add_ps( va, _mm_mul_ps( t, _mm_sub_ps( vb, va ) ) ) );
+        }
+#endif
+        for( ; i < count; ++i ) {
+            out[i] = a[i] + amount * ( b - a[i] );
+        }
+    }
+    /// out = a * scale + b
+    static inline
+    void MultiplyAdd( const float* a, float scale, const float* b, float* out, size_t count ) {
+        size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+        __m128 s = _mm_set1_ps( scale );
+        for( ; i + 4 <= count; i += 4 ) {
+            _mm_storeu_ps( out + i, _mm_add_ps(
+                _mm_mul_ps( _mm_loadu_ps( a + i ), s ), _mm_loadu_ps( b + i ) ) );
+        }
+#endif
+        for( ; i < count; ++i ) {
+            out[i] = a[i] * scale + b[i];
+        }
+    }
+    /// out = a * b + c
+    static inline
+    void MultiplyAdd( const float* a, const float* b, const float* c, float* out, size_t count ) {
+        size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+        for( ; i + 4 <= count; i += 4 ) {
+            _mm_storeu_ps( out + i, _mm_add_ps(
+                _mm_mul_ps( _mm_loadu_ps( a + i ), _mm_loadu_ps( b + i ) ),
+                _mm_loadu_ps( c + i ) ) );
+        }
+#endif
+        for( ; i < count; ++i ) {
+            out[i] = a[i] * b[i] + c[i];
+        }
+    }
+    static inline
+    void Sqrt( const float* a, float* out, size_t count ) {
+        size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+        for( ; i + 4 <= count; i += 4 ) {
+            _mm_storeu_ps( out + i, _mm_sqrt_ps( _mm_loadu_ps( a + i ) ) );
+        }
+#endif
+        for( ; i < count; ++i ) {
+            out[i] = sqrtf( a[i] );
+        }
+    }
+    /// out = 1 / sqrt( a ), zero lengths give 1 so that
+    /// scaling by out leaves zero vectors unchanged like raymath.
+    static inline
+    void InverseLength( const float* a, float* out, size_t count ) {
+        size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+        for( ; i + 4 <= count; i += 4 ) {
+            _mm_storeu_ps( out + i, Simd4::InverseLength( _mm_loadu_ps( a + i ) ) );
+        }
+#endif
+        for( ; i < count; ++i ) {
+            out[i] = a[i] == 0.0f ? 1.0f : 1.0f / sqrtf( a[i] );
+        }
+    }
+    /// Squared distance between a and b, components arrays each.
+    static inline
+    void DistanceSqr( const float* const* a, const float* const* b, int components, float* out, size_t count ) {
+        size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+        for( ; i + 4 <= count; i += 4 ) {
+            __m128 d   = _mm_sub_ps( _mm_loadu_ps( b[0] + i ), _mm_loadu_ps( a[0] + i ) );
+            __m128 sum = _mm_mul_ps( d, d );
+            for( int c = 1; c < components; ++c ) {
+                d   = _mm_sub_ps( _mm_loadu_ps( b[c] + i ), _mm_loadu_ps( a[c] + i ) );
+                sum = _mm_add_ps( sum, _mm_mul_ps( d, d ) );
+            }
+            _mm_storeu_ps( out + i, sum );
+        }
+#endif
+        for( ; i < count; ++i ) {
+            float d   = b[0][i] - a[0][i];
+            float sum = d*d;
+            for( int c = 1; c < components; ++c ) {
+                d    = b[c][i] - a[c][i];
+                sum += d*d;
+            }
+            out[i] = sum;
+        }
+    }
+    /// Cross product of a and b, out may alias either.
+    static inline
+    void CrossProduct(
+        const float* ax, const float* ay, const float* az,
+        const float* bx, const float* by, const float* bz,
+        float* outX, float* outY, float* outZ, size_t count
+    ) {
+        size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+        for( ; i + 4 <= count; i += 4 ) {
+            __m128 x1 = _mm_loadu_ps( ax + i ), y1 = _mm_loadu_ps( ay + i ), z1 = _mm_loadu_ps( az + i );
+            __m128 x2 = _mm_loadu_ps( bx + i ), y2 = _mm_loadu_ps( by + i ), z2 = _mm_loadu_ps( bz + i );
+            _mm_storeu_ps( outX + i, _mm_sub_ps( _mm_mul_ps( y1, z2 ), _mm_mul_ps( z1, y2 ) ) );
+            _mm_storeu_ps( outY + i, _mm_sub_ps( _mm_mul_ps( z1, x2 ), _mm_mul_ps( x1, z2 ) ) );
+            _mm_storeu_ps( outZ + i, _mm_sub_ps( _mm_mul_ps( x1, y2 ), _mm_mul_ps( y1, x2 ) ) );
+        }
+#endif
+        for( ; i < count; ++i ) {
+            float cx = ay[i]*bz[i] - az[i]*by[i];
+            float cy = az[i]*bx[i] - ax[i]*bz[i];
+            float cz = ax[i]*by[i] - ay[i]*bx[i];
+            outX[i] = cx;
+            outY[i] = cy;
+            outZ[i] = cz;
+        }
+    }
+    /// Rows 0 .. Rows - 1 of mat times ( x, y, z, w ), w null for 1.
+    /// out may alias the inputs. Matrix memory is row by row,
+    /// m0 m4 m8 m12 first.
+    template<int Rows> static inline
+    void Transform(
+        const Matrix& mat, const float* x, const float* y, const float* z, const float* w,
+        float* const* out, size_t count
+    ) {
+        const float* m = &mat.m0;
+        size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+        for( ; i + 4 <= count; i += 4 ) {
+            __m128 vx = _mm_loadu_ps( x + i ), vy = _mm_loadu_ps( y + i ), vz = _mm_loadu_ps( z + i );
+            __m128 vw = w ? _mm_loadu_ps( w + i ) : _mm_set1_ps( 1.0f );
+            __m128 r[Rows];
+            for( int k = 0; k < Rows; ++k ) {
+                const float* row = m + 4 * k;
+                r[k] = _mm_add_ps( _mm_add_ps( _mm_add_ps(
+                    _mm_mul_ps( _mm_set1_ps( row[0] ), vx ),
+                    _mm_mul_ps( _mm_set1_ps( row[1] ), vy ) ),
+                    _mm_mul_ps( _mm_set1_ps( row[2] ), vz ) ),
+                    w ? _mm_mul_ps( _mm_set1_ps( row[3] ), vw ) : _mm_set1_ps( row[3] ) );
+            }
+            for( int k = 0; k < Rows; ++k ) {
+                _mm_storeu_ps( out[k] + i, r[k] );
+            }
+        }
+#endif
+        for( ; i < count; ++i ) {
+            float vx = x[i], vy = y[i], vz = z[i];
+            float r[Rows];
+            for( int k = 0; k < Rows; ++k ) {
+                const float* row = m + 4 * k;
+                r[k] = row[0]*vx + row[1]*vy + row[2]*vz + ( w ? row[3]*w[i] : row[3] );
+            }
+            for( int k = 0; k < Rows; ++k ) {
+                out[k][i] = r[k];
+            }
+        }
+    }
+    /// InverseLength with FastMath.
+    static inline
+    void InverseLengthFast( const float* a, float* out, size_t count ) {
+        size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+        for( ; i + 4 <= count; i += 4 ) {
+            _mm_storeu_ps( out + i, FastMath::InverseLength( _mm_loadu_ps( a + i ) ) );
+        }
+#endif
+        for( ; i < count; ++i ) {
+            out[i] = FastMath::InverseLength( a[i] );
+        }
+    }
+    /// Normalizes Components arrays in one pass, out may alias in.
+    template<int Components>
+    static void Normalize( const float* const* in, float* const* out, size_t count ) {
+        size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+        for( ; i + 4 <= count; i += 4 ) {
+            __m128 v[Components];
+            v[0] = _mm_loadu_ps( in[0] + i );
+            __m128 lengthSqr = _mm_mul_ps( v[0], v[0] );
+            for( int c = 1; c < Components; ++c ) {
+                v[c] = _mm_loadu_ps( in[c] + i );
+                lengthSqr = _mm_add_ps( _mm_mul_ps( v[c], v[c] ), lengthSqr );
+            }
+            __m128 inverse = Simd4::InverseLength( lengthSqr );
+            for( int c = 0; c < Components; ++c ) {
+                _mm_storeu_ps( out[c] + i, _mm_mul_ps( v[c], inverse ) );
+            }
+        }
+#endif
+        for( ; i < count; ++i ) {
+            float v[Components];
+            v[0] = in[0][i];
+            float lengthSqr = v[0]*v[0];
+            for( int c = 1; c < Components; ++c ) {
+                v[c] = in[c][i];
+                lengthSqr = v[c]*v[c] + lengthSqr;
+            }
+            float inverse = lengthSqr == 0.0f ? 1.0f : 1.0f / sqrtf( lengthSqr );
+            for( int c = 0; c < Components; ++c ) {
+                out[c][i] = v[c] * inverse;
+            }
+        }
+    }
+
+private:
+    // NOTE(alicia): GCC only auto-vectorizes these at -O3
+    // (and sqrtf only with -fno-math-errno) so the SSE
+    // path is spelled out, the scalar loop handles the tail.
+    struct AddOp {
+        static inline float Scalar( float a, float b ) { return a + b; }
+#if defined(RAYMATH_CPP_SSE2)
+        static inline __m128 Wide( __m128 a, __m128 b ) { return _mm_add_ps( a, b ); }
+#endif
+    };
+    struct SubtractOp {
+        static inline float Scalar( float a, float b ) { return a - b; }
+#if defined(RAYMATH_CPP_SSE2)
+        static inline __m128 Wide( __m128 a, __m128 b ) { return _mm_sub_ps( a, b ); }
+#endif
+    };
+    struct MultiplyOp {
+        static inline float Scalar( float a, float b ) { return a * b; }
+#if defined(RAYMATH_CPP_SSE2)
+        static inline __m128 Wide( __m128 a, __m128 b ) { return _mm_mul_ps( a, b ); }
+#endif
+    };
+    struct DivideOp {
+        static inline float Scalar( float a, float b ) { return a / b; }
+#if defined(RAYMATH_CPP_SSE2)
+        static inline __m128 Wide( __m128 a, __m128 b ) { return _mm_div_ps( a, b ); }
+#endif
+    };
+    struct MinOp {
+        static inline float Scalar( float a, float b ) { return b < a ? b : a; }
+#if defined(RAYMATH_CPP_SSE2)
+        static inline __m128 Wide( __m128 a, __m128 b ) { return _mm_min_ps( b, a ); }
+#endif
+    };
+    struct MaxOp {
+        static inline float Scalar( float a, float b ) { return b > a ? b : a; }
+#if defined(RAYMATH_CPP_SSE2)
+        static inline __m128 Wide( __m128 a, __m128 b ) { return _mm_max_ps( b, a ); }
+#endif
+    };
+
+    template<typename Op> static inline
+    void Apply( const float* a, const float* b, float* out, size_t count ) {
+        size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+        for( ; i + 4 <= count; i += 4 ) {
+            _mm_storeu_ps( out + i,
+                Op::Wide( _mm_loadu_ps( a + i ), _mm_loadu_ps( b + i ) ) );
+        }
+#endif
+        for( ; i < count; ++i ) {
+            out[i] = Op::Scalar( a[i], b[i] );
+        }
+    }
+    template<typename Op> static inline
+    void ApplyValue( const float* a, float value, float* out, size_t count ) {
+        size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+        __m128 b = _mm_set1_ps( value );
+        for( ; i + 4 <= count; i += 4 ) {
+            _mm_storeu_ps( out + i, Op::Wide( _mm_loadu_ps( a + i ), b ) );
+        }
+#endif
+        for( ; i < count; ++i ) {
+            out[i] = Op::Scalar( a[i], value );
+        }
+    }
+};
+
+#if !defined(RAYMATH_CPP_NO_STDLIB)
+// NOTE(alicia): one allocation for every component,
+// each component starts on a 32 byte boundary.
+struct SoAStorage {
+    static const size_t Alignment = 32;
+
+    static inline
+    size_t Stride( size_t count ) {
+        size_t lanes = Alignment / sizeof(float);
+        return ( count + lanes - 1 ) / lanes * lanes;
+    }
+    static inline
+    float* Allocate( size_t components, size_t count, void** outBlock ) {
+        size_t size = components * Stride( count ) * sizeof(float) + Alignment;
+        void* block = std::malloc( size ? size : 1 );
+        *outBlock   = block;
+        if( !block ) {
+            return nullptr;
+        }
+        size_t address = ( (size_t)block + Alignment - 1 ) & ~( Alignment - 1 );
+        return (float*)address;
+    }
+};
+#endif
+
+struct Vec3SoA {
+    float* x     = nullptr;
+    float* y     = nullptr;
+    float* z     = nullptr;
+    size_t count = 0;
+
+    Vec3SoA() {}
+    /// View over existing component arrays, does not take ownership.
+    Vec3SoA( float* x, float* y, float* z, size_t count )
+        : x(x), y(y), z(z), count(count) {}
+#if !defined(RAYMATH_CPP_NO_STDLIB)
+    /// Allocates zeroed, 32 byte aligned component arrays.
+    /// Copies always own their storage, even copies of views.
+    explicit Vec3SoA( size_t count ) : count(count) {
+        size_t stride = SoAStorage::Stride( count );
+        x = SoAStorage::Allocate( 3, count, &block );
+        if( !x ) {
+            this->count = 0;
+            return;
+        }
+        y = x + stride;
+        z = y + stride;
+        for( size_t i = 0; i < stride * 3; ++i ) {
+            x[i] = 0.0f;
+        }
+    }
+    Vec3SoA( const Vec3SoA& other ) : Vec3SoA( other.count ) {
+        CopyFrom( other );
+    }
+    Vec3SoA( Vec3SoA&& other )
+        : x(other.x), y(other.y), z(other.z), count(other.count), block(other.block)
+    {
+        other.block = nullptr;
+    }
+    Vec3SoA& operator=( const Vec3SoA& other ) {
+        if( this != &other ) {
+            Vec3SoA copy( other );
+            *this = std::move( copy );
+        }
+        return *this;
+    }
+    Vec3SoA& operator=( Vec3SoA&& other ) {
+        if( this != &other ) {
+            std::free( block );
+            x = other.x; y = other.y; z = other.z;
+            count = other.count;
+            block = other.block;
+            other.block = nullptr;
+        }
+        return *this;
+    }
+    ~Vec3SoA() {
+        std::free( block );
+    }
+#endif
+
+    inline
+    size_t Count() const {
+        return count;
+    }
+    inline
+    Vec3 operator[]( size_t idx ) const {
+        return Vec3( x[idx], y[idx], z[idx] );
+    }
+    inline
+    void Set( size_t idx, Vector3 v ) {
+        x[idx] = v.x;
+        y[idx] = v.y;
+        z[idx] = v.z;
+    }
+    inline
+    void CopyFrom( const Vec3SoA& other ) {
+        for( size_t i = 0; i < count; ++i ) {
+            x[i] = other.x[i];
+            y[i] = other.y[i];
+            z[i] = other.z[i];
+        }
+    }
+    /// Load Count() vectors from an AoS array.
+    inline
+    void FromArray( const Vector3* src ) {
+        for( size_t i = 0; i < count; ++i ) {
+            Set( i, src[i] );
+        }
+    }
+    /// Store Count() vectors to an AoS array.
+    inline
+    void ToArray( Vector3* dst ) const {
+        for( size_t i = 0; i < count; ++i ) {
+            dst[i] = Vector3{ x[i], y[i], z[i] };
+        }
+    }
+
+    // NOTE(alicia): bulk versions of the Vec3 methods.
+    // out must hold at least Count() elements and may be this.
+
+    inline
+    void Add( const Vec3SoA& v2, Vec3SoA* out ) const {
+        SoAStream::Add( x, v2.x, out->x, count );
+        SoAStream::Add( y, v2.y, out->y, count );
+        SoAStream::Add( z, v2.z, out->z, count );
+    }
+    inline
+    void Add( Vector3 v2, Vec3SoA* out ) const {
+        SoAStream::AddValue( x, v2.x, out->x, count );
+        SoAStream::AddValue( y, v2.y, out->y, count );
+        SoAStream::AddValue( z, v2.z, out->z, count );
+    }
+    inline
+    void AddValue( float add, Vec3SoA* out ) const {
+        Add( Vector3{ add, add, add }, out );
+    }
+    inline
+    void Subtract( const Vec3SoA& v2, Vec3SoA* out ) const {
+        SoAStream::Subtract( x, v2.x, out->x, count );
+        SoAStream::Subtract( y, v2.y, out->y, count );
+        SoAStream::Subtract( z, v2.z, out->z, count );
+    }
+    inline
+    void Subtract( Vector3 v2, Vec3SoA* out ) const {
+        SoAStream::AddValue( x, -v2.x, out->x, count );
+        SoAStream::AddValue( y, -v2.y, out->y, count );
+        SoAStream::AddValue( z, -v2.z, out->z, count );
+    }
+    inline
+    void SubtractValue( float sub, Vec3SoA* out ) const {
+        Subtract( Vector3{ sub, sub, sub }, out );
+    }
+    inline
+    void Scale( float scalar, Vec3SoA* out ) const {
+        SoAStream::Scale( x, scalar, out->x, count );
+        SoAStream::Scale( y, scalar, out->y, count );
+        SoAStream::Scale( z, scalar, out->z, count );
+    }
+    inline
+    void Multiply( const Vec3SoA& v2, Vec3SoA* out ) const {
+        SoAStream::Multiply( x, v2.x, out->x, count );
+        SoAStream::Multiply( y, v2.y, out->y, count );
+        SoAStream::Multiply( z, v2.z, out->z, count );
+    }
+    inline
+    void Multiply( Vector3 v2, Vec3SoA* out ) const {
+        SoAStream::Scale( x, v2.x, out->x, count );
+        SoAStream::Scale( y, v2.y, out->y, count );
+        SoAStream::Scale( z, v2.z, out->z, count );
+    }
+    inline
+    void Divide( const Vec3SoA& v2, Vec3SoA* out ) const {
+        SoAStream::Divide( x, v2.x, out->x, count );
+        SoAStream::Divide( y, v2.y, out->y, count );
+        SoAStream::Divide( z, v2.z, out->z, count );
+    }
+    inline
+    void Negate( Vec3SoA* out ) const {
+        Scale( -1.0f, out );
+    }
+    inline
+    void Invert( Vec3SoA* out ) const {
+        SoAStream::Invert( x, out->x, count );
+        SoAStream::Invert( y, out->y, count );
+        SoAStream::Invert( z, out->z, count );
+    }
+    inline
+    void CrossProduct( const Vec3SoA& v2, Vec3SoA* out ) const {
+        SoAStream::CrossProduct( x, y, z, v2.x, v2.y, v2.z, out->x, out->y, out->z, count );
+    }
+    inline
+    void DotProduct( const Vec3SoA& v2, float* out ) const {
+        SoAStream::Multiply( x, v2.x, out, count );
+        SoAStream::MultiplyAdd( y, v2.y, out, out, count );
+        SoAStream::MultiplyAdd( z, v2.z, out, out, count );
+    }
+    inline
+    void DotProduct( Vector3 v2, float* out ) const {
+        SoAStream::Scale( x, v2.x, out, count );
+        SoAStream::MultiplyAdd( y, v2.y, out, out, count );
+        SoAStream::MultiplyAdd( z, v2.z, out, out, count );
+    }
+    inline
+    void LengthSqr( float* out ) const {
+        DotProduct( *this, out );
+    }
+    inline
+    void Length( float* out ) const {
+        LengthSqr( out );
+        SoAStream::Sqrt( out, out, count );
+    }
+    inline
+    void DistanceSqr( const Vec3SoA& v2, float* out ) const {
+        const float* a[3] = { x, y, z };
+        const float* b[3] = { v2.x, v2.y, v2.z };
+        SoAStream::DistanceSqr( a, b, 3, out, count );
+    }
+    inline
+    void Distance( const Vec3SoA& v2, float* out ) const {
+        DistanceSqr( v2, out );
+        SoAStream::Sqrt( out, out, count );
+    }
+    inline
+    void Normalize( Vec3SoA* out ) const {
+        const float* in[3] = { x, y, z };
+        float* dst[3] = { out->x, out->y, out->z };
+        SoAStream::Normalize<3>( in, dst, count );
+    }
+    inline
+    void Lerp( const Vec3SoA& v2, float amount, Vec3SoA* out ) const {
+        SoAStream::Lerp( x, v2.x, amount, out->x, count );
+        SoAStream::Lerp( y, v2.y, amount, out->y, count );
+        SoAStream::Lerp( z, v2.z, amount, out->z, count );
+    }
+    inline
+    void Lerp( Vector3 v2, float amount, Vec3SoA* out ) const {
+        SoAStream::LerpValue( x, v2.x, amount, out->x, count );
+        SoAStream::LerpValue( y, v2.y, amount, out->y, count );
+        SoAStream::LerpValue( z, v2.z, amount, out->z, count );
+    }
+    inline
+    void Min( const Vec3SoA& v2, Vec3SoA* out ) const {
+        SoAStream::Min( x, v2.x, out->x, count );
+        SoAStream::Min( y, v2.y, out->y, count );
+        SoAStream::Min( z, v2.z, out->z, count );
+    }
+    inline
+    void Min( Vector3 v2, Vec3SoA* out ) const {
+        SoAStream::MinValue( x, v2.x, out->x, count );
+        SoAStream::MinValue( y, v2.y, out->y, count );
+        SoAStream::MinValue( z, v2.z, out->z, count );
+    }
+    inline
+    void Max( const Vec3SoA& v2, Vec3SoA* out ) const {
+        SoAStream::Max( x, v2.x, out->x, count );
+        SoAStream::Max( y, v2.y, out->y, count );
+        SoAStream::Max( z, v2.z, out->z, count );
+    }
+    inline
+    void Max( Vector3 v2, Vec3SoA* out ) const {
+        SoAStream::MaxValue( x, v2.x, out->x, count );
+        SoAStream::MaxValue( y, v2.y, out->y, count );
+        SoAStream::MaxValue( z, v2.z, out->z, count );
+    }
+    inline
+    void Clamp( Vector3 min, Vector3 max, Vec3SoA* out ) const {
+        SoAStream::ClampValue( x, min.x, max.x, out->x, count );
+        SoAStream::ClampValue( y, min.y, max.y, out->y, count );
+        SoAStream::ClampValue( z, min.z, max.z, out->z, count );
+    }
+    inline
+    void Reflect( Vector3 normal, Vec3SoA* out ) const {
+        // NOTE(alicia): x - 2n * dot as dot * -2n + x, the same rounding.
+        const size_t BlockSize = 256;
+        float dot[BlockSize];
+        for( size_t start = 0; start < count; start += BlockSize ) {
+            size_t n = count - start < BlockSize ? count - start : BlockSize;
+            Vec3SoA in  = Offset( start, n );
+            Vec3SoA dst = out->Offset( start, n );
+            in.DotProduct( normal, dot );
+            SoAStream::MultiplyAdd( dot, -2.0f * normal.x, in.x, dst.x, n );
+            SoAStream::MultiplyAdd( dot, -2.0f * normal.y, in.y, dst.y, n );
+            SoAStream::MultiplyAdd( dot, -2.0f * normal.z, in.z, dst.z, n );
+        }
+    }
+    inline
+    void Transform( const Matrix& mat, Vec3SoA* out ) const {
+        float* rows[3] = { out->x, out->y, out->z };
+        SoAStream::Transform<3>( mat, x, y, z, nullptr, rows, count );
+    }
+    inline
+    void Rotate( Quaternion q, Vec3SoA* out ) const {
+        Transform( RotationMatrix( q ), out );
+    }
+
+    /// View over elements [start, start + n).
+    inline
+    Vec3SoA Offset( size_t start, size_t n ) const {
+        return Vec3SoA( x + start, y + start, z + start, n );
+    }
+
+#if !defined(RAYMATH_CPP_NO_STDLIB)
+private:
+    void* block = nullptr;
+#endif
+};
+
+struct Vec4SoA {
+    float* x     = nullptr;
+    float* y     = nullptr;
+    float* z     = nullptr;
+    float* w     = nullptr;
+    size_t count = 0;
+
+    Vec4SoA() {}
+    /// View over existing component arrays, does not take ownership.
+    Vec4SoA( float* x, float* y, float* z, float* w, size_t count )
+        : x(x), y(y), z(z), w(w), count(count) {}
+#if !defined(RAYMATH_CPP_NO_STDLIB)
+    /// Allocates zeroed, 32 byte aligned component arrays.
+    /// Copies always own their storage, even copies of views.
+    explicit Vec4SoA( size_t count ) : count(count) {
+        size_t stride = SoAStorage::Stride( count );
+        x = SoAStorage::Allocate( 4, count, &block );
+        if( !x ) {
+            this->count = 0;
+            return;
+        }
+        y = x + stride;
+        z = y + stride;
+        w = z + stride;
+        for( size_t i = 0; i < stride * 4; ++i ) {
+            x[i] = 0.0f;
+        }
+    }
+    Vec4SoA( const Vec4SoA& other ) : Vec4SoA( other.count ) {
+        CopyFrom( other );
+    }
+    Vec4SoA( Vec4SoA&& other )
+        : x(other.x), y(other.y), z(other.z), w(other.w),
+        count(other.count), block(other.block)
+    {
+        other.block = nullptr;
+    }
+    Vec4SoA& operator=( const Vec4SoA& other ) {
+        if( this != &other ) {
+            Vec4SoA copy( other );
+            *this = std::move( copy );
+        }
+        return *this;
+    }
+    Vec4SoA& operator=( Vec4SoA&& other ) {
+        if( this != &other ) {
+            std::free( block );
+            x = other.x; y = other.y; z = other.z; w = other.w;
+            count = other.count;
+            block = other.block;
+            other.block = nullptr;
+        }
+        return *this;
+    }
+    ~Vec4SoA() {
+        std::free( block );
+    }
+#endif
+
+    inline
+    size_t Count() const {
+        return count;
+    }
+    inline
+    Vec4 operator[]( size_t idx ) const {
+        return Vec4( x[idx], y[idx], z[idx], w[idx] );
+    }
+    inline
+    void Set( size_t idx, Vector4 v ) {
+        x[idx] = v.x;
+        y[idx] = v.y;
+        z[idx] = v.z;
+        w[idx] = v.w;
+    }
+    inline
+    void CopyFrom( const Vec4SoA& other ) {
+        for( size_t i = 0; i < count; ++i ) {
+            x[i] = other.x[i];
+            y[i] = other.y[i];
+            z[i] = other.z[i];
+            w[i] = other.w[i];
+        }
+    }
+    /// Load Count() vectors from an AoS array.
+    inline
+    void FromArray( const Vector4* src ) {
+        for( size_t i = 0; i < count; ++i ) {
+            Set( i, src[i] );
+        }
+    }
+    /// Store Count() vectors to an AoS array.
+    inline
+    void ToArray( Vector4* dst ) const {
+        for( size_t i = 0; i < count; ++i ) {
+            dst[i] = Vector4{ x[i], y[i], z[i], w[i] };
+        }
+    }
+
+    // NOTE(alicia): bulk versions of the Vec4 methods.
+    // out must hold at least Count() elements and may be this.
 
-    Vec3() {}
-    Vec3( float x, float y, float z ) : x(x), y(y), z(z) {}
-    Vec3( const Vector3& v ) : Vec3( v.x, v.y, v.z ) {}
+    inline
+    void Add( const Vec4SoA& v2, Vec4SoA* out ) const {
+        SoAStream::Add( x, v2.x, out->x, count );
+        SoAStream::Add( y, v2.y, out->y, count );
+        SoAStream::Add( z, v2.z, out->z, count );
+        SoAStream::Add( w, v2.w, out->w, count );
+    }
+    inline
+    void Add( Vector4 v2, Vec4SoA* out ) const {
+        SoAStream::AddValue( x, v2.x, out->x, count );
+        SoAStream::AddValue( y, v2.y, out->y, count );
+        SoAStream::AddValue( z, v2.z, out->z, count );
+        SoAStream::AddValue( w, v2.w, out->w, count );
+    }
+    inline
+    void AddValue( float add, Vec4SoA* out ) const {
+        Add( Vector4{ add, add, add, add }, out );
+    }
+    inline
+    void Subtract( const Vec4SoA& v2, Vec4SoA* out ) const {
+        SoAStream::Subtract( x, v2.x, out->x, count );
+        SoAStream::Subtract( y, v2.y, out->y, count );
+        SoAStream::Subtract( z, v2.z, out->z, count );
+        SoAStream::Subtract( w, v2.w, out->w, count );
+    }
+    inline
+    void Subtract( Vector4 v2, Vec4SoA* out ) const {
+        SoAStream::AddValue( x, -v2.x, out->x, count );
+        SoAStream::AddValue( y, -v2.y, out->y, count );
+        SoAStream::AddValue( z, -v2.z, out->z, count );
+        SoAStream::AddValue( w, -v2.w, out->w, count );
+    }
+    inline
+    void SubtractValue( float sub, Vec4SoA* out ) const {
+        Subtract( Vector4{ sub, sub, sub, sub }, out );
+    }
+    inline
+    void Scale( float scalar, Vec4SoA* out ) const {
+        SoAStream::Scale( x, scalar, out->x, count );
+        SoAStream::Scale( y, scalar, out->y, count );
+        SoAStream::Scale( z, scalar, out->z, count );
+        SoAStream::Scale( w, scalar, out->w, count );
+    }
+    inline
+    void Multiply( const Vec4SoA& v2, Vec4SoA* out ) const {
+        SoAStream::Multiply( x, v2.x, out->x, count );
+        SoAStream::Multiply( y, v2.y, out->y, count );
+        SoAStream::Multiply( z, v2.z, out->z, count );
+        SoAStream::Multiply( w, v2.w, out->w, count );
+    }
+    inline
+    void Multiply( Vector4 v2, Vec4SoA* out ) const {
+        SoAStream::Scale( x, v2.x, out->x, count );
+        SoAStream::Scale( y, v2.y, out->y, count );
+        SoAStream::Scale( z, v2.z, out->z, count );
+        SoAStream::Scale( w, v2.w, out->w, count );
+    }
+    inline
+    void Divide( const Vec4SoA& v2, Vec4SoA* out ) const {
+        SoAStream::Divide( x, v2.x, out->x, count );
+        SoAStream::Divide( y, v2.y, out->y, count );
+        SoAStream::Divide( z, v2.z, out->z, count );
+        SoAStream::Divide( w, v2.w, out->w, count );
+    }
+    inline
+    void Negate( Vec4SoA* out ) const {
+        Scale( -1.0f, out );
+    }
+    inline
+    void Invert( Vec4SoA* out ) const {
+        SoAStream::Invert( x, out->x, count );
+        SoAStream::Invert( y, out->y, count );
+        SoAStream::Invert( z, out->z, count );
+        SoAStream::Invert( w, out->w, count );
+    }
+    inline
+    void DotProduct( const Vec4SoA& v2, float* out ) const {
+        SoAStream::Multiply( x, v2.x, out, count );
+        SoAStream::MultiplyAdd( y, v2.y, out, out, count );
+        SoAStream::MultiplyAdd( z, v2.z, out, out, count );
+        SoAStream::MultiplyAdd( w, v2.w, out, out, count );
+    }
+    inline
+    void DotProduct( Vector4 v2, float* out ) const {
+        SoAStream::Scale( x, v2.x, out, count );
+        SoAStream::MultiplyAdd( y, v2.y, out, out, count );
+        SoAStream::MultiplyAdd( z, v2.z, out, out, count );
+        SoAStream::MultiplyAdd( w, v2.w, out, out, count );
+    }
+    inline
+    void LengthSqr( float* out ) const {
+        DotProduct( *this, out );
+    }
+    inline
+    void Length( float* out ) const {
+        LengthSqr( out );
+        SoAStream::Sqrt( out, out, count );
+    }
+    inline
+    void DistanceSqr( const Vec4SoA& v2, float* out ) const {
+        const float* a[4] = { x, y, z, w };
+        const float* b[4] = { v2.x, v2.y, v2.z, v2.w };
+        SoAStream::DistanceSqr( a, b, 4, out, count );
+    }
+    inline
+    void Distance( const Vec4SoA& v2, float* out ) const {
+        DistanceSqr( v2, out );
+        SoAStream::Sqrt( out, out, count );
+    }
+    inline
+    void Normalize( Vec4SoA* out ) const {
+        const float* in[4] = { x, y, z, w };
+        float* dst[4] = { out->x, out->y, out->z, out->w };
+        SoAStream::Normalize<4>( in, dst, count );
+    }
+    inline
+    void Lerp( const Vec4SoA& v2, float amount, Vec4SoA* out ) const {
+        SoAStream::Lerp( x, v2.x, amount, out->x, count );
+        SoAStream::Lerp( y, v2.y, amount, out->y, count );
+        SoAStream::Lerp( z, v2.z, amount, out->z, count );
+        SoAStream::Lerp( w, v2.w, amount, out->w, count );
+    }
+    inline
+    void Lerp( Vector4 v2, float amount, Vec4SoA* out ) const {
+        SoAStream::LerpValue( x, v2.x, amount, out->x, count );
+        SoAStream::LerpValue( y, v2.y, amount, out->y, count );
+        SoAStream::LerpValue( z, v2.z, amount, out->z, count );
+        SoAStream::LerpValue( w, v2.w, amount, out->w, count );
+    }
+    inline
+    void Min( const Vec4SoA& v2, Vec4SoA* out ) const {
+        SoAStream::Min( x, v2.x, out->x, count );
+        SoAStream::Min( y, v2.y, out->y, count );
+        SoAStream::Min( z, v2.z, out->z, count );
+        SoAStream::Min( w, v2.w, out->w, count );
+    }
+    inline
+    void Max( const Vec4SoA& v2, Vec4SoA* out ) const {
+        SoAStream::Max( x, v2.x, out->x, count );
+        SoAStream::Max( y, v2.y, out->y, count );
+        SoAStream::Max( z, v2.z, out->z, count );
+        SoAStream::Max( w, v2.w, out->w, count );
+    }
+    inline
+    void Clamp( Vector4 min, Vector4 max, Vec4SoA* out ) const {
+        SoAStream::ClampValue( x, min.x, max.x, out->x, count );
+        SoAStream::ClampValue( y, min.y, max.y, out->y, count );
+        SoAStream::ClampValue( z, min.z, max.z, out->z, count );
+        SoAStream::ClampValue( w, min.w, max.w, out->w, count );
+    }
+    /// Full 4x4 transform, same as QuaternionTransform per element.
+    inline
+    void Transform( const Matrix& mat, Vec4SoA* out ) const {
+        float* rows[4] = { out->x, out->y, out->z, out->w };
+        SoAStream::Transform<4>( mat, x, y, z, w, rows, count );
+    }
 
+    /// View over elements [start, start + n).
     inline
-    operator Vector3() const {
-        return *(Vector3*)this;
+    Vec4SoA Offset( size_t start, size_t n ) const {
+        return Vec4SoA( x + start, y + start, z + start, w + start, n );
+    }
+
+#if !defined(RAYMATH_CPP_NO_STDLIB)
+private:
+    void* block = nullptr;
+#endif
+};
+
+// NOTE(alicia): batch overloads.
+// work on contiguous AoS arrays in place, 4 elements per step
+// when SSE2 is available. out may be the same array as the input.
+// the scalar tail uses the same arithmetic as the wide path so an
+// element's result does not depend on where it sits in the array.
+static_assert( sizeof(Vec2) == sizeof(Vector2), "Vec2 must alias Vector2" );
+static_assert( sizeof(Vec3) == sizeof(Vector3), "Vec3 must alias Vector3" );
+static_assert( sizeof(Vec4) == sizeof(Vector4), "Vec4 must alias Vector4" );
+
+inline
+void LengthSqr( const Vector2* v, float* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x, y;
+        Simd4::Load( v + i, &x, &y );
+        _mm_storeu_ps( out + i, _mm_add_ps( _mm_mul_ps( x, x ), _mm_mul_ps( y, y ) ) );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector2LengthSqr( v[i] );
+    }
+}
+inline
+void Length( const Vector2* v, float* out, size_t count ) {
+    LengthSqr( v, out, count );
+    SoAStream::Sqrt( out, out, count );
+}
+inline
+void DotProduct( const Vector2* v1, const Vector2* v2, float* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x1, y1, x2, y2;
+        Simd4::Load( v1 + i, &x1, &y1 );
+        Simd4::Load( v2 + i, &x2, &y2 );
+        _mm_storeu_ps( out + i,
+            _mm_add_ps( _mm_mul_ps( x1, x2 ), _mm_mul_ps( y1, y2 ) ) );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector2DotProduct( v1[i], v2[i] );
+    }
+}
+inline
+void DistanceSqr( const Vector2* v1, const Vector2* v2, float* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x1, y1, x2, y2;
+        Simd4::Load( v1 + i, &x1, &y1 );
+        Simd4::Load( v2 + i, &x2, &y2 );
+        __m128 dx = _mm_sub_ps( x1, x2 );
+        __m128 dy = _mm_sub_ps( y1, y2 );
+        _mm_storeu_ps( out + i, _mm_add_ps( _mm_mul_ps( dx, dx ), _mm_mul_ps( dy, dy ) ) );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector2DistanceSqr( v1[i], v2[i] );
+    }
+}
+inline
+void Distance( const Vector2* v1, const Vector2* v2, float* out, size_t count ) {
+    DistanceSqr( v1, v2, out, count );
+    SoAStream::Sqrt( out, out, count );
+}
+inline
+void Normalize( const Vector2* v, Vector2* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x, y;
+        Simd4::Load( v + i, &x, &y );
+        __m128 inverse = Simd4::InverseLength(
+            _mm_add_ps( _mm_mul_ps( x, x ), _mm_mul_ps( y, y ) ) );
+        Simd4::Store( out + i, _mm_mul_ps( x, inverse ), _mm_mul_ps( y, inverse ) );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector2Normalize( v[i] );
+    }
+}
+inline
+void Lerp( const Vector2* v1, const Vector2* v2, float amount, Vector2* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    __m128 t = _mm_set1_ps( amount );
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x1, y1, x2, y2;
+        Simd4::Load( v1 + i, &x1, &y1 );
+        Simd4::Load( v2 + i, &x2, &y2 );
+        Simd4::Store( out + i,
+            _mm_add_ps( x1, _mm_mul_ps( t, _mm_sub_ps( x2, x1 ) ) ),
+            _mm_add_ps( y1, _mm_mul_ps( t, _mm_sub_ps( y2, y1 ) ) ) );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector2Lerp( v1[i], v2[i], amount );
+    }
+}
+inline
+void Reflect( const Vector2* v, Vector2 normal, Vector2* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    __m128 nx  = _mm_set1_ps( normal.x );
+    __m128 ny  = _mm_set1_ps( normal.y );
+    __m128 nx2 = _mm_set1_ps( 2.0f * normal.x );
+    __m128 ny2 = _mm_set1_ps( 2.0f * normal.y );
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x, y;
+        Simd4::Load( v + i, &x, &y );
+        __m128 dot = _mm_add_ps( _mm_mul_ps( x, nx ), _mm_mul_ps( y, ny ) );
+        Simd4::Store( out + i,
+            _mm_sub_ps( x, _mm_mul_ps( nx2, dot ) ),
+            _mm_sub_ps( y, _mm_mul_ps( ny2, dot ) ) );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector2Reflect( v[i], normal );
+    }
+}
+inline
+void Rotate( const Vector2* v, float angle, Vector2* out, size_t count ) {
+    float c = cosf( angle );
+    float s = sinf( angle );
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    __m128 vc = _mm_set1_ps( c );
+    __m128 vs = _mm_set1_ps( s );
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x, y;
+        Simd4::Load( v + i, &x, &y );
+        Simd4::Store( out + i,
+            _mm_sub_ps( _mm_mul_ps( x, vc ), _mm_mul_ps( y, vs ) ),
+            _mm_add_ps( _mm_mul_ps( x, vs ), _mm_mul_ps( y, vc ) ) );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        Vector2 p = v[i];
+        out[i] = Vector2{ p.x*c - p.y*s, p.x*s + p.y*c };
+    }
+}
+inline
+void Clamp( const Vector2* v, Vector2 min, Vector2 max, Vector2* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    __m128 minX = _mm_set1_ps( min.x ), maxX = _mm_set1_ps( max.x );
+    __m128 minY = _mm_set1_ps( min.y ), maxY = _mm_set1_ps( max.y );
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x, y;
+        Simd4::Load( v + i, &x, &y );
+        Simd4::Store( out + i,
+            _mm_min_ps( _mm_max_ps( x, minX ), maxX ),
+            _mm_min_ps( _mm_max_ps( y, minY ), maxY ) );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector2Clamp( v[i], min, max );
+    }
+}
+inline
+void Clamp( const Vector2* v, float min, float max, Vector2* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    __m128 vmin = _mm_set1_ps( min );
+    __m128 vmax = _mm_set1_ps( max );
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x, y;
+        Simd4::Load( v + i, &x, &y );
+        __m128 scale = Simd4::ClampLengthScale(
+            _mm_add_ps( _mm_mul_ps( x, x ), _mm_mul_ps( y, y ) ), vmin, vmax );
+        Simd4::Store( out + i, _mm_mul_ps( x, scale ), _mm_mul_ps( y, scale ) );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector2ClampValue( v[i], min, max );
+    }
+}
+
+inline
+void LengthSqr( const Vector3* v, float* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x, y, z;
+        Simd4::Load( v + i, &x, &y, &z );
+        _mm_storeu_ps( out + i, _mm_add_ps( _mm_add_ps(
+            _mm_mul_ps( x, x ), _mm_mul_ps( y, y ) ), _mm_mul_ps( z, z ) ) );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector3LengthSqr( v[i] );
+    }
+}
+inline
+void Length( const Vector3* v, float* out, size_t count ) {
+    LengthSqr( v, out, count );
+    SoAStream::Sqrt( out, out, count );
+}
+inline
+void DotProduct( const Vector3* v1, const Vector3* v2, float* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x1, y1, z1, x2, y2, z2;
+        Simd4::Load( v1 + i, &x1, &y1, &z1 );
+        Simd4::Load( v2 + i, &x2, &y2, &z2 );
+        _mm_storeu_ps( out + i, _mm_add_ps( _mm_add_ps(
+            _mm_mul_ps( x1, x2 ), _mm_mul_ps( y1, y2 ) ), _mm_mul_ps( z1, z2 ) ) );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector3DotProduct( v1[i], v2[i] );
+    }
+}
+inline
+void CrossProduct( const Vector3* v1, const Vector3* v2, Vector3* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x1, y1, z1, x2, y2, z2;
+        Simd4::Load( v1 + i, &x1, &y1, &z1 );
+        Simd4::Load( v2 + i, &x2, &y2, &z2 );
+        Simd4::Store( out + i,
+            _mm_sub_ps( _mm_mul_ps( y1, z2 ), _mm_mul_ps( z1, y2 ) ),
+            _mm_sub_ps( _mm_mul_ps( z1, x2 ), _mm_mul_ps( x1, z2 ) ),
+            _mm_sub_ps( _mm_mul_ps( x1, y2 ), _mm_mul_ps( y1, x2 ) ) );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector3CrossProduct( v1[i], v2[i] );
+    }
+}
+inline
+void DistanceSqr( const Vector3* v1, const Vector3* v2, float* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x1, y1, z1, x2, y2, z2;
+        Simd4::Load( v1 + i, &x1, &y1, &z1 );
+        Simd4::Load( v2 + i, &x2, &y2, &z2 );
+        __m128 dx = _mm_sub_ps( x2, x1 );
+        __m128 dy = _mm_sub_ps( y2, y1 );
+        __m128 dz = _mm_sub_ps( z2, z1 );
+        _mm_storeu_ps( out + i, _mm_add_ps( _mm_add_ps(
+            _mm_mul_ps( dx, dx ), _mm_mul_ps( dy, dy ) ), _mm_mul_ps( dz, dz ) ) );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector3DistanceSqr( v1[i], v2[i] );
+    }
+}
+inline
+void Distance( const Vector3* v1, const Vector3* v2, float* out, size_t count ) {
+    DistanceSqr( v1, v2, out, count );
+    SoAStream::Sqrt( out, out, count );
+}
+inline
+void Normalize( const Vector3* v, Vector3* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x, y, z;
+        Simd4::Load( v + i, &x, &y, &z );
+        __m128 inverse = Simd4::InverseLength( _mm_add_ps( _mm_add_ps(
+            _mm_mul_ps( x, x ), _mm_mul_ps( y, y ) ), _mm_mul_ps( z, z ) ) );
+        Simd4::Store( out + i,
+            _mm_mul_ps( x, inverse ), _mm_mul_ps( y, inverse ), _mm_mul_ps( z, inverse ) );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector3Normalize( v[i] );
+    }
+}
+inline
+void Lerp( const Vector3* v1, const Vector3* v2, float amount, Vector3* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    __m128 t = _mm_set1_ps( amount );
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x1, y1, z1, x2, y2, z2;
+        Simd4::Load( v1 + i, &x1, &y1, &z1 );
+        Simd4::Load( v2 + i, &x2, &y2, &z2 );
+        Simd4::Store( out + i,
+            _mm_add_ps( x1, _mm_mul_ps( t, _mm_sub_ps( x2, x1 ) ) ),
+            _mm_add_ps( y1, _mm_mul_ps( t, _mm_sub_ps( y2, y1 ) ) ),
+            _mm_add_ps( z1, _mm_mul_ps( t, _mm_sub_ps( z2, z1 ) ) ) );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector3Lerp( v1[i], v2[i], amount );
+    }
+}
+inline
+void Reflect( const Vector3* v, Vector3 normal, Vector3* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    __m128 nx  = _mm_set1_ps( normal.x );
+    __m128 ny  = _mm_set1_ps( normal.y );
+    __m128 nz  = _mm_set1_ps( normal.z );
+    __m128 nx2 = _mm_set1_ps( 2.0f * normal.x );
+    __m128 ny2 = _mm_set1_ps( 2.0f * normal.y );
+    __m128 nz2 = _mm_set1_ps( 2.0f * normal.z );
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x, y, z;
+        Simd4::Load( v + i, &x, &y, &z );
+        __m128 dot = _mm_add_ps( _mm_add_ps(
+            _mm_mul_ps( x, nx ), _mm_mul_ps( y, ny ) ), _mm_mul_ps( z, nz ) );
+        Simd4::Store( out + i,
+            _mm_sub_ps( x, _mm_mul_ps( nx2, dot ) ),
+            _mm_sub_ps( y, _mm_mul_ps( ny2, dot ) ),
+            _mm_sub_ps( z, _mm_mul_ps( nz2, dot ) ) );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector3Reflect( v[i], normal );
+    }
+}
+// NOTE(alicia): one matrix, many vectors.
+// columns are loaded once, every vector is then 3 broadcasts
+// and 3 multiply-adds, summed in the same order as Vector3Transform.
+template<bool Translate, bool Divide> inline
+void TransformStream( const Vector3* v, const Matrix& mat, Vector3* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    // NOTE(alicia): with the divide, 4 points as x, y, z registers take
+    // 3 divisions where 4 broadcast points take 4.
+    if( Divide ) {
+        __m128 m0 = _mm_set1_ps( mat.m0 ), m4 = _mm_set1_ps( mat.m4 ), m8  = _mm_set1_ps( mat.m8 );
+        __m128 m1 = _mm_set1_ps( mat.m1 ), m5 = _mm_set1_ps( mat.m5 ), m9  = _mm_set1_ps( mat.m9 );
+        __m128 m2 = _mm_set1_ps( mat.m2 ), m6 = _mm_set1_ps( mat.m6 ), m10 = _mm_set1_ps( mat.m10 );
+        __m128 m3 = _mm_set1_ps( mat.m3 ), m7 = _mm_set1_ps( mat.m7 ), m11 = _mm_set1_ps( mat.m11 );
+        __m128 m12 = _mm_set1_ps( mat.m12 ), m13 = _mm_set1_ps( mat.m13 );
+        __m128 m14 = _mm_set1_ps( mat.m14 ), m15 = _mm_set1_ps( mat.m15 );
+        for( ; i + 4 <= count; i += 4 ) {
+            __m128 x, y, z;
+            Simd4::Load( v + i, &x, &y, &z );
+            __m128 rx = _mm_add_ps( _mm_add_ps( _mm_mul_ps( m0, x ), _mm_mul_ps( m4, y ) ), _mm_mul_ps( m8, z ) );
+            __m128 ry = _mm_add_ps( _mm_add_ps( _mm_mul_ps( m1, x ), _mm_mul_ps( m5, y ) ), _mm_mul_ps( m9, z ) );
+            __m128 rz = _mm_add_ps( _mm_add_ps( _mm_mul_ps( m2, x ), _mm_mul_ps( m6, y ) ), _mm_mul_ps( m10, z ) );
+            __m128 rw = _mm_add_ps( _mm_add_ps( _mm_mul_ps( m3, x ), _mm_mul_ps( m7, y ) ), _mm_mul_ps( m11, z ) );
+            if( Translate ) {
+                rx = _mm_add_ps( rx, m12 );
+                ry = _mm_add_ps( ry, m13 );
+                rz = _mm_add_ps( rz, m14 );
+                rw = _mm_add_ps( rw, m15 );
+            }
+            Simd4::Store( out + i, _mm_div_ps( rx, rw ), _mm_div_ps( ry, rw ), _mm_div_ps( rz, rw ) );
+        }
+    }
+    __m128 c0, c1, c2, c3;
+    Simd4::Columns( mat, &c0, &c1, &c2, &c3 );
+    for( ; i + 4 <= count; i += 4 ) {
+        const float* p = (const float*)( v + i );
+        __m128 a = _mm_loadu_ps( p + 0 );
+        __m128 b = _mm_loadu_ps( p + 4 );
+        __m128 c = _mm_loadu_ps( p + 8 );
+
+        __m128 r[4];
+        __m128 xyz[12] = {
+            Simd4::Broadcast<0>( a ), Simd4::Broadcast<1>( a ), Simd4::Broadcast<2>( a ),
+            Simd4::Broadcast<3>( a ), Simd4::Broadcast<0>( b ), Simd4::Broadcast<1>( b ),
+            Simd4::Broadcast<2>( b ), Simd4::Broadcast<3>( b ), Simd4::Broadcast<0>( c ),
+            Simd4::Broadcast<1>( c ), Simd4::Broadcast<2>( c ), Simd4::Broadcast<3>( c ),
+        };
+        for( int j = 0; j < 4; ++j ) {
+            __m128 t = _mm_add_ps( _mm_add_ps(
+                _mm_mul_ps( c0, xyz[j * 3 + 0] ),
+                _mm_mul_ps( c1, xyz[j * 3 + 1] ) ),
+                _mm_mul_ps( c2, xyz[j * 3 + 2] ) );
+            if( Translate ) {
+                t = _mm_add_ps( t, c3 );
+            }
+            if( Divide ) {
+                t = _mm_div_ps( t, Simd4::Broadcast<3>( t ) );
+            }
+            r[j] = t;
+        }
+        Simd4::Store3( out + i, r[0], r[1], r[2], r[3] );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        float x = v[i].x, y = v[i].y, z = v[i].z;
+        Vector3 result = {
+            mat.m0*x + mat.m4*y + mat.m8*z,
+            mat.m1*x + mat.m5*y + mat.m9*z,
+            mat.m2*x + mat.m6*y + mat.m10*z };
+        float w = mat.m3*x + mat.m7*y + mat.m11*z;
+        if( Translate ) {
+            result.x += mat.m12;
+            result.y += mat.m13;
+            result.z += mat.m14;
+            w += mat.m15;
+        }
+        if( Divide ) {
+            result.x /= w;
+            result.y /= w;
+            result.z /= w;
+        }
+        out[i] = result;
+    }
+}
+/// Points ( w = 1 ), same as Vector3Transform per element.
+inline
+void Transform( const Vector3* v, const Matrix& mat, Vector3* out, size_t count ) {
+    TransformStream<true, false>( v, mat, out, count );
+}
+/// Directions ( w = 0 ), translation is ignored.
+inline
+void TransformDirection( const Vector3* v, const Matrix& mat, Vector3* out, size_t count ) {
+    TransformStream<false, false>( v, mat, out, count );
+}
+/// Points ( w = 1 ) with perspective divide, e.g. through a view-projection.
+inline
+void TransformProject( const Vector3* v, const Matrix& mat, Vector3* out, size_t count ) {
+    TransformStream<true, true>( v, mat, out, count );
+}
+/// Points ( w = 1 ) through an affine transform.
+inline
+void Transform( const Vector3* v, const Affine3x4& affine, Vector3* out, size_t count ) {
+    TransformStream<true, false>( v, affine.ToMatrix(), out, count );
+}
+/// Directions ( w = 0 ) through an affine transform.
+inline
+void TransformDirection( const Vector3* v, const Affine3x4& affine, Vector3* out, size_t count ) {
+    TransformStream<false, false>( v, affine.ToMatrix(), out, count );
+}
+/// left[i] * right, e.g. instance transforms into world space.
+inline
+void Multiply( const Affine3x4* left, const Affine3x4& right, Affine3x4* out, size_t count ) {
+    for( size_t i = 0; i < count; ++i ) {
+        Affine3x4MultiplyKernel( left[i], right, out + i );
+    }
+}
+#if defined(RAYMATH_CPP_SSE2)
+/// Mat3::NormalMatrix of 4 matrices.
+inline
+void NormalMatrix4( const Matrix* models, Mat3* out ) {
+    // NOTE(alicia): rows of 4 matrices are transposed so every register
+    // holds one element of 4 matrices, then the cofactors are computed
+    // like the scalar version and transposed back into 9 float records.
+    const float* p = (const float*)models;
+    __m128 m0 = _mm_loadu_ps( p + 0 ), m4 = _mm_loadu_ps( p + 16 );
+    __m128 m8 = _mm_loadu_ps( p + 32 ), m12 = _mm_loadu_ps( p + 48 );
+    __m128 m1 = _mm_loadu_ps( p + 4 ), m5 = _mm_loadu_ps( p + 20 );
+    __m128 m9 = _mm_loadu_ps( p + 36 ), m13 = _mm_loadu_ps( p + 52 );
+    __m128 m2 = _mm_loadu_ps( p + 8 ), m6 = _mm_loadu_ps( p + 24 );
+    __m128 m10 = _mm_loadu_ps( p + 40 ), m14 = _mm_loadu_ps( p + 56 );
+    _MM_TRANSPOSE4_PS( m0, m4, m8, m12 );
+    _MM_TRANSPOSE4_PS( m1, m5, m9, m13 );
+    _MM_TRANSPOSE4_PS( m2, m6, m10, m14 );
+
+    __m128 r0 = _mm_sub_ps( _mm_mul_ps( m5, m10 ), _mm_mul_ps( m9, m6 ) );
+    __m128 r3 = _mm_sub_ps( _mm_mul_ps( m9, m2 ),  _mm_mul_ps( m1, m10 ) );
+    __m128 r6 = _mm_sub_ps( _mm_mul_ps( m1, m6 ),  _mm_mul_ps( m5, m2 ) );
+    __m128 r1 = _mm_sub_ps( _mm_mul_ps( m8, m6 ),  _mm_mul_ps( m4, m10 ) );
+    __m128 r4 = _mm_sub_ps( _mm_mul_ps( m0, m10 ), _mm_mul_ps( m8, m2 ) );
+    __m128 r7 = _mm_sub_ps( _mm_mul_ps( m4, m2 ),  _mm_mul_ps( m0, m6 ) );
+    __m128 r2 = _mm_sub_ps( _mm_mul_ps( m4, m9 ),  _mm_mul_ps( m8, m5 ) );
+    __m128 r5 = _mm_sub_ps( _mm_mul_ps( m8, m1 ),  _mm_mul_ps( m0, m9 ) );
+    __m128 r8 = _mm_sub_ps( _mm_mul_ps( m0, m5 ),  _mm_mul_ps( m4, m1 ) );
+    __m128 invDet = _mm_div_ps( _mm_set1_ps( 1.0f ), _mm_add_ps( _mm_add_ps(
+        _mm_mul_ps( m0, r0 ), _mm_mul_ps( m4, r3 ) ), _mm_mul_ps( m8, r6 ) ) );
+
+    // NOTE(alicia): records are m0 m3 m6 m1 m4 m7 m2 m5 m8.
+    __m128 a = _mm_mul_ps( r0, invDet ), b = _mm_mul_ps( r3, invDet );
+    __m128 c = _mm_mul_ps( r6, invDet ), d = _mm_mul_ps( r1, invDet );
+    __m128 e = _mm_mul_ps( r4, invDet ), f = _mm_mul_ps( r7, invDet );
+    __m128 g = _mm_mul_ps( r2, invDet ), h = _mm_mul_ps( r5, invDet );
+    __m128 last = _mm_mul_ps( r8, invDet );
+    _MM_TRANSPOSE4_PS( a, b, c, d );
+    _MM_TRANSPOSE4_PS( e, f, g, h );
+
+    float* o = (float*)out;
+    _mm_storeu_ps( o + 0,  a ); _mm_storeu_ps( o + 4,  e );
+    _mm_store_ss( o + 8,  last );
+    _mm_storeu_ps( o + 9,  b ); _mm_storeu_ps( o + 13, f );
+    _mm_store_ss( o + 17, Simd4::Broadcast<1>( last ) );
+    _mm_storeu_ps( o + 18, c ); _mm_storeu_ps( o + 22, g );
+    _mm_store_ss( o + 26, Simd4::Broadcast<2>( last ) );
+    _mm_storeu_ps( o + 27, d ); _mm_storeu_ps( o + 31, h );
+    _mm_store_ss( o + 35, Simd4::Broadcast<3>( last ) );
+}
+#endif
+/// Mat3::NormalMatrix per element, e.g. for instance model matrices.
+inline
+void NormalMatrix( const Matrix* models, Mat3* out, size_t count ) {
+#if defined(RAYMATH_CPP_SSE2)
+    // NOTE(alicia): the last 1-3 go through the wide path as well, padded
+    // with identities, so a result doesn't depend on where in the array
+    // its matrix is. it matches Mat3::NormalMatrix unless a*b + c gets fused.
+    size_t i = 0;
+    for( ; i + 4 <= count; i += 4 ) {
+        NormalMatrix4( models + i, out + i );
+    }
+    if( i < count ) {
+        Matrix model[4] = { MatrixIdentity(), MatrixIdentity(), MatrixIdentity(), MatrixIdentity() };
+        Mat3   normal[4];
+        size_t tail = count - i;
+        for( size_t j = 0; j < tail; ++j ) {
+            model[j] = models[i + j];
+        }
+        NormalMatrix4( model, normal );
+        for( size_t j = 0; j < tail; ++j ) {
+            out[i + j] = normal[j];
+        }
+    }
+#else
+    for( size_t i = 0; i < count; ++i ) {
+        out[i] = Mat3::NormalMatrix( models[i] );
+    }
+#endif
+}
+#if defined(RAYMATH_CPP_SSE2)
+/// ComposeMatrix of 4 elements.
+inline
+void ComposeMatrix4(
+    const Vector3* translations, const Quaternion* rotations, const Vector3* scales, Matrix* out
+) {
+    // NOTE(alicia): RotationMatrix for 4 rotations at once,
+    // same terms in the same order, transposed into rows on the way out.
+    __m128 two = _mm_set1_ps( 2.0f );
+    __m128 minusTwo = _mm_set1_ps( -2.0f );
+    __m128 lastRow  = _mm_set_ps( 1.0f, 0.0f, 0.0f, 0.0f );
+    __m128 x, y, z, w, tx, ty, tz, sx, sy, sz;
+    Simd4::Load( rotations, &x, &y, &z, &w );
+    Simd4::Load( translations, &tx, &ty, &tz );
+    Simd4::Load( scales, &sx, &sy, &sz );
+
+    __m128 xx = _mm_mul_ps( x, x ), yy = _mm_mul_ps( y, y );
+    __m128 zz = _mm_mul_ps( z, z ), ww = _mm_mul_ps( w, w );
+    __m128 x2 = _mm_mul_ps( two, x ), y2 = _mm_mul_ps( two, y );
+    __m128 w2 = _mm_mul_ps( two, w ), wm2 = _mm_mul_ps( minusTwo, w );
+
+    __m128 m0  = _mm_sub_ps( _mm_sub_ps( _mm_add_ps( xx, ww ), yy ), zz );
+    __m128 m4  = _mm_sub_ps( _mm_mul_ps( x2, y ), _mm_mul_ps( w2, z ) );
+    __m128 m8  = _mm_add_ps( _mm_mul_ps( x2, z ), _mm_mul_ps( w2, y ) );
+    __m128 m1  = _mm_add_ps( _mm_mul_ps( w2, z ), _mm_mul_ps( x2, y ) );
+    __m128 m5  = _mm_sub_ps( _mm_add_ps( _mm_sub_ps( ww, xx ), yy ), zz );
+    __m128 m9  = _mm_add_ps( _mm_mul_ps( wm2, x ), _mm_mul_ps( y2, z ) );
+    __m128 m2  = _mm_add_ps( _mm_mul_ps( wm2, y ), _mm_mul_ps( x2, z ) );
+    __m128 m6  = _mm_add_ps( _mm_mul_ps( w2, x ), _mm_mul_ps( y2, z ) );
+    __m128 m10 = _mm_add_ps( _mm_sub_ps( _mm_sub_ps( ww, xx ), yy ), zz );
+
+    m0 = _mm_mul_ps( m0, sx ); m4 = _mm_mul_ps( m4, sy );  m8 = _mm_mul_ps( m8, sz );
+    m1 = _mm_mul_ps( m1, sx ); m5 = _mm_mul_ps( m5, sy );  m9 = _mm_mul_ps( m9, sz );
+    m2 = _mm_mul_ps( m2, sx ); m6 = _mm_mul_ps( m6, sy ); m10 = _mm_mul_ps( m10, sz );
+    _MM_TRANSPOSE4_PS( m0, m4, m8, tx );
+    _MM_TRANSPOSE4_PS( m1, m5, m9, ty );
+    _MM_TRANSPOSE4_PS( m2, m6, m10, tz );
+
+    float* o = (float*)out;
+    __m128 rows[16] = {
+        m0, m1, m2, lastRow, m4, m5, m6, lastRow,
+        m8, m9, m10, lastRow, tx, ty, tz, lastRow };
+    for( int j = 0; j < 16; ++j ) {
+        _mm_storeu_ps( o + j * 4, rows[j] );
+    }
+}
+#endif
+/// ComposeMatrix per element, e.g. instance transforms.
+inline
+void ComposeMatrix(
+    const Vector3* translations, const Quaternion* rotations, const Vector3* scales,
+    Matrix* out, size_t count
+) {
+#if defined(RAYMATH_CPP_SSE2)
+    // NOTE(alicia): the last 1-3 go through the wide path as well, padded
+    // with identity transforms, see NormalMatrix.
+    size_t i = 0;
+    for( ; i + 4 <= count; i += 4 ) {
+        ComposeMatrix4( translations + i, rotations + i, scales + i, out + i );
+    }
+    if( i < count ) {
+        Vector3    translation[4] = {};
+        Quaternion rotation[4];
+        Vector3    scale[4];
+        Matrix     matrix[4];
+        size_t tail = count - i;
+        for( size_t j = 0; j < 4; ++j ) {
+            rotation[j] = Quaternion{ 0.0f, 0.0f, 0.0f, 1.0f };
+            scale[j]    = Vector3{ 1.0f, 1.0f, 1.0f };
+        }
+        for( size_t j = 0; j < tail; ++j ) {
+            translation[j] = translations[i + j];
+            rotation[j]    = rotations[i + j];
+            scale[j]       = scales[i + j];
+        }
+        ComposeMatrix4( translation, rotation, scale, matrix );
+        for( size_t j = 0; j < tail; ++j ) {
+            out[i + j] = matrix[j];
+        }
+    }
+#else
+    for( size_t i = 0; i < count; ++i ) {
+        out[i] = ComposeMatrix( translations[i], rotations[i], scales[i] );
+    }
+#endif
+}
+#if defined(RAYMATH_CPP_SSE2)
+/// DecomposeMatrix of 4 matrices.
+inline
+void DecomposeMatrix4(
+    const Matrix* matrices, Vector3* translations, Quaternion* rotations, Vector3* scales
+) {
+    // NOTE(alicia): every case of the quaternion is computed and the
+    // biggest one is selected like DecomposeMatrix branches on it.
+    // elements with a 0 length axis go through DecomposeMatrix instead.
+    __m128 one  = _mm_set1_ps( 1.0f );
+    __m128 half = _mm_set1_ps( 0.5f );
+    __m128 quarter = _mm_set1_ps( 0.25f );
+    __m128 sign = _mm_set1_ps( -0.0f );
+    __m128 min  = _mm_set1_ps( FastMath::Min );
+    const float* p = (const float*)matrices;
+    __m128 m0 = _mm_loadu_ps( p + 0 ), m4 = _mm_loadu_ps( p + 16 );
+    __m128 m8 = _mm_loadu_ps( p + 32 ), m12 = _mm_loadu_ps( p + 48 );
+    __m128 m1 = _mm_loadu_ps( p + 4 ), m5 = _mm_loadu_ps( p + 20 );
+    __m128 m9 = _mm_loadu_ps( p + 36 ), m13 = _mm_loadu_ps( p + 52 );
+    __m128 m2 = _mm_loadu_ps( p + 8 ), m6 = _mm_loadu_ps( p + 24 );
+    __m128 m10 = _mm_loadu_ps( p + 40 ), m14 = _mm_loadu_ps( p + 56 );
+    _MM_TRANSPOSE4_PS( m0, m4, m8, m12 );
+    _MM_TRANSPOSE4_PS( m1, m5, m9, m13 );
+    _MM_TRANSPOSE4_PS( m2, m6, m10, m14 );
+
+    __m128 lengthSqrX = _mm_add_ps( _mm_add_ps(
+        _mm_mul_ps( m0, m0 ), _mm_mul_ps( m1, m1 ) ), _mm_mul_ps( m2, m2 ) );
+    __m128 lengthSqrY = _mm_add_ps( _mm_add_ps(
+        _mm_mul_ps( m4, m4 ), _mm_mul_ps( m5, m5 ) ), _mm_mul_ps( m6, m6 ) );
+    __m128 lengthSqrZ = _mm_add_ps( _mm_add_ps(
+        _mm_mul_ps( m8, m8 ), _mm_mul_ps( m9, m9 ) ), _mm_mul_ps( m10, m10 ) );
+    __m128 degenerate = _mm_or_ps( _mm_cmpnge_ps( lengthSqrX, min ),
+        _mm_or_ps( _mm_cmpnge_ps( lengthSqrY, min ), _mm_cmpnge_ps( lengthSqrZ, min ) ) );
+
+    __m128 det = _mm_add_ps( _mm_sub_ps(
+        _mm_mul_ps( m0, _mm_sub_ps( _mm_mul_ps( m5, m10 ), _mm_mul_ps( m9, m6 ) ) ),
+        _mm_mul_ps( m4, _mm_sub_ps( _mm_mul_ps( m1, m10 ), _mm_mul_ps( m9, m2 ) ) ) ),
+        _mm_mul_ps( m8, _mm_sub_ps( _mm_mul_ps( m1, m6 ), _mm_mul_ps( m5, m2 ) ) ) );
+    __m128 sx = _mm_sqrt_ps( lengthSqrX );
+    __m128 sy = _mm_sqrt_ps( lengthSqrY );
+    __m128 sz = _mm_sqrt_ps( lengthSqrZ );
+    sx = _mm_xor_ps( sx, _mm_and_ps( sign, _mm_cmplt_ps( det, _mm_setzero_ps() ) ) );
+    Simd4::Store( translations, m12, m13, m14 );
+    Simd4::Store( scales, sx, sy, sz );
+
+    __m128 ix = _mm_div_ps( one, sx );
+    __m128 iy = _mm_div_ps( one, sy );
+    __m128 iz = _mm_div_ps( one, sz );
+    m0 = _mm_mul_ps( m0, ix ); m1 = _mm_mul_ps( m1, ix );  m2 = _mm_mul_ps( m2, ix );
+    m4 = _mm_mul_ps( m4, iy ); m5 = _mm_mul_ps( m5, iy );  m6 = _mm_mul_ps( m6, iy );
+    m8 = _mm_mul_ps( m8, iz ); m9 = _mm_mul_ps( m9, iz ); m10 = _mm_mul_ps( m10, iz );
+
+    __m128 fourW = _mm_add_ps( _mm_add_ps( m0, m5 ), m10 );
+    __m128 fourX = _mm_sub_ps( _mm_sub_ps( m0, m5 ), m10 );
+    __m128 fourY = _mm_sub_ps( _mm_sub_ps( m5, m0 ), m10 );
+    __m128 fourZ = _mm_sub_ps( _mm_sub_ps( m10, m0 ), m5 );
+    __m128 biggest = fourW;
+    __m128 isX = _mm_cmpgt_ps( fourX, biggest );
+    biggest = Simd4::Select( isX, fourX, biggest );
+    __m128 isY = _mm_cmpgt_ps( fourY, biggest );
+    biggest = Simd4::Select( isY, fourY, biggest );
+    __m128 isZ = _mm_cmpgt_ps( fourZ, biggest );
+    biggest = Simd4::Select( isZ, fourZ, biggest );
+    isY = _mm_andnot_ps( isZ, isY );
+    isX = _mm_andnot_ps( _mm_or_ps( isY, isZ ), isX );
+
+    __m128 biggestVal = _mm_mul_ps( _mm_sqrt_ps( _mm_add_ps( biggest, one ) ), half );
+    __m128 mult = _mm_div_ps( quarter, biggestVal );
+    __m128 a = _mm_mul_ps( _mm_sub_ps( m6, m9 ), mult );
+    __m128 b = _mm_mul_ps( _mm_sub_ps( m8, m2 ), mult );
+    __m128 c = _mm_mul_ps( _mm_sub_ps( m1, m4 ), mult );
+    __m128 d = _mm_mul_ps( _mm_add_ps( m1, m4 ), mult );
+    __m128 e = _mm_mul_ps( _mm_add_ps( m8, m2 ), mult );
+    __m128 f = _mm_mul_ps( _mm_add_ps( m6, m9 ), mult );
+    __m128 qx = Simd4::Select( isX, biggestVal, Simd4::Select( isY, d, Simd4::Select( isZ, e, a ) ) );
+    __m128 qy = Simd4::Select( isX, d, Simd4::Select( isY, biggestVal, Simd4::Select( isZ, f, b ) ) );
+    __m128 qz = Simd4::Select( isX, e, Simd4::Select( isY, f, Simd4::Select( isZ, biggestVal, c ) ) );
+    __m128 qw = Simd4::Select( isX, a, Simd4::Select( isY, b, Simd4::Select( isZ, c, biggestVal ) ) );
+    __m128 ilength = _mm_div_ps( one, _mm_sqrt_ps( _mm_add_ps( _mm_add_ps( _mm_add_ps(
+        _mm_mul_ps( qx, qx ), _mm_mul_ps( qy, qy ) ), _mm_mul_ps( qz, qz ) ), _mm_mul_ps( qw, qw ) ) ) );
+    Simd4::Store( rotations,
+        _mm_mul_ps( qx, ilength ), _mm_mul_ps( qy, ilength ),
+        _mm_mul_ps( qz, ilength ), _mm_mul_ps( qw, ilength ) );
+
+    int mask = _mm_movemask_ps( degenerate );
+    for( int j = 0; j < 4; ++j ) {
+        if( mask & ( 1 << j ) ) {
+            DecomposeMatrix( matrices[j], translations + j, rotations + j, scales + j );
+        }
+    }
+}
+#endif
+/// DecomposeMatrix per element.
+inline
+void DecomposeMatrix(
+    const Matrix* matrices, Vector3* translations, Quaternion* rotations, Vector3* scales,
+    size_t count
+) {
+#if defined(RAYMATH_CPP_SSE2)
+    // NOTE(alicia): the last 1-3 go through the wide path as well, padded
+    // with identities, see NormalMatrix.
+    size_t i = 0;
+    for( ; i + 4 <= count; i += 4 ) {
+        DecomposeMatrix4( matrices + i, translations + i, rotations + i, scales + i );
+    }
+    if( i < count ) {
+        Matrix     matrix[4] = { MatrixIdentity(), MatrixIdentity(), MatrixIdentity(), MatrixIdentity() };
+        Vector3    translation[4], scale[4];
+        Quaternion rotation[4];
+        size_t tail = count - i;
+        for( size_t j = 0; j < tail; ++j ) {
+            matrix[j] = matrices[i + j];
+        }
+        DecomposeMatrix4( matrix, translation, rotation, scale );
+        for( size_t j = 0; j < tail; ++j ) {
+            translations[i + j] = translation[j];
+            rotations[i + j]    = rotation[j];
+            scales[i + j]       = scale[j];
+        }
+    }
+#else
+    for( size_t i = 0; i < count; ++i ) {
+        DecomposeMatrix( matrices[i], translations + i, rotations + i, scales + i );
+    }
+#endif
+}
+/// Full 4x4 transform, same as QuaternionTransform per element.
+inline
+void Transform( const Vector4* v, const Matrix& mat, Vector4* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    __m128 c0, c1, c2, c3;
+    Simd4::Columns( mat, &c0, &c1, &c2, &c3 );
+    for( ; i < count; ++i ) {
+        __m128 p = _mm_loadu_ps( (const float*)( v + i ) );
+        __m128 r = _mm_add_ps( _mm_add_ps( _mm_add_ps(
+            _mm_mul_ps( c0, Simd4::Broadcast<0>( p ) ),
+            _mm_mul_ps( c1, Simd4::Broadcast<1>( p ) ) ),
+            _mm_mul_ps( c2, Simd4::Broadcast<2>( p ) ) ),
+            _mm_mul_ps( c3, Simd4::Broadcast<3>( p ) ) );
+        _mm_storeu_ps( (float*)( out + i ), r );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = QuaternionTransform( v[i], mat );
+    }
+}
+inline
+void Rotate( const Vector3* v, Quaternion q, Vector3* out, size_t count ) {
+    TransformDirection( v, RotationMatrix( q ), out, count );
+}
+inline
+void Rotate( const Vector3* v, Vector3 axis, float angle, Vector3* out, size_t count ) {
+    TransformDirection( v, MatrixRotate( axis, angle ), out, count );
+}
+inline
+void Clamp( const Vector3* v, Vector3 min, Vector3 max, Vector3* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    __m128 minX = _mm_set1_ps( min.x ), maxX = _mm_set1_ps( max.x );
+    __m128 minY = _mm_set1_ps( min.y ), maxY = _mm_set1_ps( max.y );
+    __m128 minZ = _mm_set1_ps( min.z ), maxZ = _mm_set1_ps( max.z );
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x, y, z;
+        Simd4::Load( v + i, &x, &y, &z );
+        Simd4::Store( out + i,
+            _mm_min_ps( _mm_max_ps( x, minX ), maxX ),
+            _mm_min_ps( _mm_max_ps( y, minY ), maxY ),
+            _mm_min_ps( _mm_max_ps( z, minZ ), maxZ ) );
     }
-    inline
-    float operator[]( size_t idx ) const {
-        return array[idx];
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector3Clamp( v[i], min, max );
     }
-    inline
-    float& operator[]( size_t idx ) {
-        return array[idx];
+}
+inline
+void Clamp( const Vector3* v, float min, float max, Vector3* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    __m128 vmin = _mm_set1_ps( min );
+    __m128 vmax = _mm_set1_ps( max );
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x, y, z;
+        Simd4::Load( v + i, &x, &y, &z );
+        __m128 scale = Simd4::ClampLengthScale( _mm_add_ps( _mm_add_ps(
+            _mm_mul_ps( x, x ), _mm_mul_ps( y, y ) ), _mm_mul_ps( z, z ) ), vmin, vmax );
+        Simd4::Store( out + i,
+            _mm_mul_ps( x, scale ), _mm_mul_ps( y, scale ), _mm_mul_ps( z, scale ) );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector3ClampValue( v[i], min, max );
     }
+}
 
-    inline
-    Vec3& operator+=( Vec3 v2 ) {
-        return *this = this->Add( v2 );
+inline
+void LengthSqr( const Vector4* v, float* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x, y, z, w;
+        Simd4::Load( v + i, &x, &y, &z, &w );
+        _mm_storeu_ps( out + i, _mm_add_ps( _mm_add_ps( _mm_add_ps(
+            _mm_mul_ps( x, x ), _mm_mul_ps( y, y ) ),
+            _mm_mul_ps( z, z ) ), _mm_mul_ps( w, w ) ) );
     }
-    inline
-    Vec3& operator-=( Vec3 v2 ) {
-        return *this = this->Subtract( v2 );
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector4LengthSqr( v[i] );
     }
-    inline
-    Vec3& operator*=( float value ) {
-        return *this = this->Scale( value );
+}
+inline
+void Length( const Vector4* v, float* out, size_t count ) {
+    LengthSqr( v, out, count );
+    SoAStream::Sqrt( out, out, count );
+}
+inline
+void DotProduct( const Vector4* v1, const Vector4* v2, float* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x1, y1, z1, w1, x2, y2, z2, w2;
+        Simd4::Load( v1 + i, &x1, &y1, &z1, &w1 );
+        Simd4::Load( v2 + i, &x2, &y2, &z2, &w2 );
+        _mm_storeu_ps( out + i, _mm_add_ps( _mm_add_ps( _mm_add_ps(
+            _mm_mul_ps( x1, x2 ), _mm_mul_ps( y1, y2 ) ),
+            _mm_mul_ps( z1, z2 ) ), _mm_mul_ps( w1, w2 ) ) );
     }
-    inline
-    Vec3& operator/=( float value ) {
-        return *this = this->Scale( 1.0f / value );
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector4DotProduct( v1[i], v2[i] );
     }
-    inline
-    Vec3 operator-() const {
-        return this->Negate();
+}
+inline
+void DistanceSqr( const Vector4* v1, const Vector4* v2, float* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x1, y1, z1, w1, x2, y2, z2, w2;
+        Simd4::Load( v1 + i, &x1, &y1, &z1, &w1 );
+        Simd4::Load( v2 + i, &x2, &y2, &z2, &w2 );
+        __m128 dx = _mm_sub_ps( x1, x2 );
+        __m128 dy = _mm_sub_ps( y1, y2 );
+        __m128 dz = _mm_sub_ps( z1, z2 );
+        __m128 dw = _mm_sub_ps( w1, w2 );
+        _mm_storeu_ps( out + i, _mm_add_ps( _mm_add_ps( _mm_add_ps(
+            _mm_mul_ps( dx, dx ), _mm_mul_ps( dy, dy ) ),
+            _mm_mul_ps( dz, dz ) ), _mm_mul_ps( dw, dw ) ) );
     }
-
-    static inline
-    Vec3 Zero() {
-        return Vector3Zero();
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector4DistanceSqr( v1[i], v2[i] );
     }
-    static inline
-    Vec3 One() {
-        return Vector3One();
+}
+inline
+void Distance( const Vector4* v1, const Vector4* v2, float* out, size_t count ) {
+    DistanceSqr( v1, v2, out, count );
+    SoAStream::Sqrt( out, out, count );
+}
+inline
+void Normalize( const Vector4* v, Vector4* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x, y, z, w;
+        Simd4::Load( v + i, &x, &y, &z, &w );
+        __m128 inverse = Simd4::InverseLength( _mm_add_ps( _mm_add_ps( _mm_add_ps(
+            _mm_mul_ps( x, x ), _mm_mul_ps( y, y ) ),
+            _mm_mul_ps( z, z ) ), _mm_mul_ps( w, w ) ) );
+        Simd4::Store( out + i,
+            _mm_mul_ps( x, inverse ), _mm_mul_ps( y, inverse ),
+            _mm_mul_ps( z, inverse ), _mm_mul_ps( w, inverse ) );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector4Normalize( v[i] );
+    }
+}
+inline
+void Lerp( const Vector4* v1, const Vector4* v2, float amount, Vector4* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    // NOTE(alicia): lerp is per component, no transpose needed.
+    __m128 t = _mm_set1_ps( amount );
+    for( ; i < count; ++i ) {
+        __m128 a = _mm_loadu_ps( (const float*)( v1 + i ) );
+        __m128 b = _mm_loadu_ps( (const float*)( v2 + i ) );
+        _mm_storeu_ps( (float*)( out + i ), _mm_add_ps( a, _mm_mul_ps( t, _mm_sub_ps( b, a ) ) ) );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = Vector4Lerp( v1[i], v2[i], amount );
     }
+}
+/// Lerp then normalize, quaternions share Vector4's
+/// Lerp/Normalize/Length/LengthSqr batch overloads.
+inline
+void Nlerp( const Quaternion* q1, const Quaternion* q2, float amount, Quaternion* out, size_t count ) {
+    Lerp( q1, q2, amount, out, count );
+    Normalize( out, out, count );
+}
 
-    inline
-    Vec3 Add( Vector3 v2 ) const {
-        return Vector3Add( *this, v2 );
+// NOTE(alicia): cached camera projection.
+// Vector3Unproject multiplies and inverts view * projection on every call,
+// Unprojector does it once. every point then costs one TransformProject,
+// with the same result as Vector3Unproject unless a*b + c gets fused
+// (see RAYMATH_CPP_NO_FMA).
+struct Unprojector {
+    Matrix inverse;
+
+    RAYMATH_CPP_CONSTEXPR Unprojector() : inverse( MatrixIdentity() ) {}
+    /// Same arguments as Vec3::Unproject.
+    RAYMATH_CPP_CONSTEXPR Unprojector( const Matrix& projection, const Matrix& view ) :
+        inverse( MatrixInvert( MatrixMultiply( view, projection ) ) ) {}
+    /// viewProjection as view * projection.
+    explicit RAYMATH_CPP_CONSTEXPR Unprojector( const Matrix& viewProjection ) :
+        inverse( MatrixInvert( viewProjection ) ) {}
+
+    /// Normalized device coordinates to world space.
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Unproject( Vector3 point ) const {
+        float x = inverse.m0*point.x + inverse.m4*point.y + inverse.m8*point.z  + inverse.m12;
+        float y = inverse.m1*point.x + inverse.m5*point.y + inverse.m9*point.z  + inverse.m13;
+        float z = inverse.m2*point.x + inverse.m6*point.y + inverse.m10*point.z + inverse.m14;
+        float w = inverse.m3*point.x + inverse.m7*point.y + inverse.m11*point.z + inverse.m15;
+        return Vec3( x/w, y/w, z/w );
     }
     inline
-    Vec3 AddValue( float add ) const {
-        return Vector3AddValue( *this, add );
+    void Unproject( const Vector3* points, Vector3* out, size_t count ) const {
+        TransformProject( points, inverse, out, count );
     }
     inline
-    Vec3 Subtract( Vector3 v2 ) const {
-        return Vector3Subtract( *this, v2 );
+    void Unproject( const Vec3* points, Vec3* out, size_t count ) const {
+        TransformProject( (const Vector3*)points, inverse, (Vector3*)out, count );
     }
+    /// Ray from the near plane ( z = -1 ) through the far plane ( z = 1 ),
+    /// ndc in [-1, 1] with y up. direction is normalized.
     inline
-    Vec3 SubtractValue( float sub ) const {
-        return Vector3SubtractValue( *this, sub );
+    Ray3 Ray( Vector2 ndc ) const {
+        Vec3 nearPoint = Unproject( Vector3{ ndc.x, ndc.y, -1.0f } );
+        Vec3 farPoint  = Unproject( Vector3{ ndc.x, ndc.y,  1.0f } );
+        return Ray3( nearPoint, Vector3Normalize( Vector3Subtract( farPoint, nearPoint ) ) );
     }
-    inline
-    Vec3 Scale( float scalar ) const {
-        return Vector3Scale( *this, scalar );
+};
+/// World space to normalized device coordinates, same as TransformProject.
+struct Projector {
+    Matrix viewProjection;
+
+    RAYMATH_CPP_CONSTEXPR Projector() : viewProjection( MatrixIdentity() ) {}
+    RAYMATH_CPP_CONSTEXPR Projector( const Matrix& projection, const Matrix& view ) :
+        viewProjection( MatrixMultiply( view, projection ) ) {}
+    explicit RAYMATH_CPP_CONSTEXPR Projector( const Matrix& viewProjection ) :
+        viewProjection( viewProjection ) {}
+
+    RAYMATH_CPP_CONSTEXPR inline
+    Vec3 Project( Vector3 point ) const {
+        const Matrix& m = viewProjection;
+        float x = m.m0*point.x + m.m4*point.y + m.m8*point.z  + m.m12;
+        float y = m.m1*point.x + m.m5*point.y + m.m9*point.z  + m.m13;
+        float z = m.m2*point.x + m.m6*point.y + m.m10*point.z + m.m14;
+        float w = m.m3*point.x + m.m7*point.y + m.m11*point.z + m.m15;
+        return Vec3( x/w, y/w, z/w );
     }
     inline
-    Vec3 Multiply( Vector3 v2 ) const {
-        return Vector3Multiply( *this, v2 );
+    void Project( const Vector3* points, Vector3* out, size_t count ) const {
+        TransformProject( points, viewProjection, out, count );
     }
     inline
-    Vec3 CrossProduct( Vector3 v2 ) const {
-        return Vector3CrossProduct( *this, v2 );
+    void Project( const Vec3* points, Vec3* out, size_t count ) const {
+        TransformProject( (const Vector3*)points, viewProjection, (Vector3*)out, count );
     }
-    inline
-    Vec3 Perpendicular() const {
-        return Vector3Perpendicular( *this );
+    /// Unprojector for the same camera.
+    RAYMATH_CPP_CONSTEXPR inline
+    Unprojector Inverse() const {
+        return Unprojector( viewProjection );
     }
-    inline
-    float Length() const {
-        return Vector3Length( *this );
+};
+
+// NOTE(alicia): pose blending.
+// Slerp and SlerpFast take the shorter arc (q2 is negated when
+// dot( q1, q2 ) < 0) and normalize the result. there are no branches,
+// the scalar and 4-wide paths run the same arithmetic.
+// Slerp evaluates acos and sin as polynomials, within 1e-6 radians of
+// an exact slerp. it only falls back to nlerp above cos 0.9995,
+// QuaternionSlerp does so above 0.95.
+// SlerpFast is nlerp with the amount corrected towards constant angular
+// speed (fit from zeux.io "Approximating slerp"), at about half the cost.
+// it is within 1e-4 radians of an exact slerp for rotations up to
+// 120 degrees apart and within 8e-4 radians up to 180.
+// amount is expected in [0, 1].
+struct QuatBlend {
+    /// sin( x ) for x in [-PI/2, PI/2].
+    static inline
+    float Sin( float x ) {
+        float z = x*x;
+        return x + ( x*z )*( -1.6666667e-1f + z*( 8.3333338e-3f +
+            z*( -1.9841270e-4f + z*( 2.7557319e-6f + z*-2.5052108e-8f ) ) ) );
     }
-    inline
-    float LengthSqr() const {
-        return Vector3LengthSqr( *this );
+    /// acos( x ) for x in [0, 1].
+    static inline
+    float Acos( float x ) {
+        bool  wide = x > 0.5f;
+        float z = wide ? 0.5f*( 1.0f - x ) : x*x;
+        float s = wide ? sqrtf( z ) : x;
+        float asin = s + ( s*z )*( 1.6666752422e-1f + z*( 7.4953002686e-2f +
+            z*( 4.5470025998e-2f + z*( 2.4181311049e-2f + z*4.2163199048e-2f ) ) ) );
+        return wide ? asin + asin : 1.5707963268f - asin;
+    }
+    // NOTE(alicia): pointers like the wide one, gcc -O2 does not inline
+    // this and passing the quaternions by value went through the stack
+    // at about 4 times the cost.
+    template<bool Fast> static inline
+    void Blend( const Quaternion* a, const Quaternion* b, float t, Quaternion* out ) {
+        Quaternion q1 = *a, q2 = *b;
+        float dot = q1.x*q2.x + q1.y*q2.y + q1.z*q2.z + q1.w*q2.w;
+        float d   = fabsf( dot );
+        float wa, wb;
+        if( Fast ) {
+            float a = 1.0904f + d*( -3.2452f + d*( 3.55645f + d*-1.43519f ) );
+            float b = 0.848013f + d*( -1.06021f + d*0.215638f );
+            float u = t - 0.5f;
+            float k = ( a*u )*u + b;
+            wb = t + ( ( t*u )*( t - 1.0f ) )*k;
+            wa = 1.0f - wb;
+        } else {
+            float theta    = Acos( d );
+            float sinTheta = sqrtf( 1.0f - d*d );
+            float inverse  = 1.0f/( sinTheta > EPSILON ? sinTheta : EPSILON );
+            bool  linear   = d > 0.9995f;
+            wa = linear ? 1.0f - t : Sin( ( 1.0f - t )*theta )*inverse;
+            wb = linear ? t : Sin( t*theta )*inverse;
+        }
+        wb = dot < 0.0f ? -wb : wb;
+
+        Quaternion result = {
+            q1.x*wa + q2.x*wb, q1.y*wa + q2.y*wb,
+            q1.z*wa + q2.z*wb, q1.w*wa + q2.w*wb };
+        float lengthSqr = result.x*result.x + result.y*result.y +
+            result.z*result.z + result.w*result.w;
+        float inverse = lengthSqr == 0.0f ? 1.0f : 1.0f/sqrtf( lengthSqr );
+        result.x *= inverse;
+        result.y *= inverse;
+        result.z *= inverse;
+        result.w *= inverse;
+        *out = result;
+    }
+#if defined(RAYMATH_CPP_SSE2)
+    static inline
+    __m128 Sin( __m128 x ) {
+        __m128 z = _mm_mul_ps( x, x );
+        __m128 p = _mm_add_ps( _mm_set1_ps( 2.7557319e-6f ), _mm_mul_ps( z, _mm_set1_ps( -2.5052108e-8f ) ) );
+        p = _mm_add_ps( _mm_set1_ps( -1.9841270e-4f ), _mm_mul_ps( z, p ) );
+        p = _mm_add_ps( _mm_set1_ps( 8.3333338e-3f ), _mm_mul_ps( z, p ) );
+        p = _mm_add_ps( _mm_set1_ps( -1.6666667e-1f ), _mm_mul_ps( z, p ) );
+        return _mm_add_ps( x, _mm_mul_ps( _mm_mul_ps( x, z ), p ) );
     }
-    inline
-    float DotProduct( Vector3 v2 ) const {
-        return Vector3DotProduct( *this, v2 );
+    static inline
+    __m128 Acos( __m128 x ) {
+        __m128 half = _mm_set1_ps( 0.5f );
+        __m128 wide = _mm_cmpgt_ps( x, half );
+        __m128 z = Simd4::Select( wide,
+            _mm_mul_ps( half, _mm_sub_ps( _mm_set1_ps( 1.0f ), x ) ), _mm_mul_ps( x, x ) );
+        __m128 s = Simd4::Select( wide, _mm_sqrt_ps( z ), x );
+        __m128 p = _mm_add_ps( _mm_set1_ps( 2.4181311049e-2f ), _mm_mul_ps( z, _mm_set1_ps( 4.2163199048e-2f ) ) );
+        p = _mm_add_ps( _mm_set1_ps( 4.5470025998e-2f ), _mm_mul_ps( z, p ) );
+        p = _mm_add_ps( _mm_set1_ps( 7.4953002686e-2f ), _mm_mul_ps( z, p ) );
+        p = _mm_add_ps( _mm_set1_ps( 1.6666752422e-1f ), _mm_mul_ps( z, p ) );
+        __m128 asin = _mm_add_ps( s, _mm_mul_ps( _mm_mul_ps( s, z ), p ) );
+        return Simd4::Select( wide,
+            _mm_add_ps( asin, asin ), _mm_sub_ps( _mm_set1_ps( 1.5707963268f ), asin ) );
+    }
+    template<bool Fast> static inline
+    void Blend( const Quaternion* q1, const Quaternion* q2, __m128 t, Quaternion* out ) {
+        __m128 x1, y1, z1, w1, x2, y2, z2, w2;
+        Simd4::Load( q1, &x1, &y1, &z1, &w1 );
+        Simd4::Load( q2, &x2, &y2, &z2, &w2 );
+
+        __m128 one  = _mm_set1_ps( 1.0f );
+        __m128 sign = _mm_set1_ps( -0.0f );
+        __m128 dot  = _mm_add_ps( _mm_add_ps( _mm_add_ps(
+            _mm_mul_ps( x1, x2 ), _mm_mul_ps( y1, y2 ) ),
+            _mm_mul_ps( z1, z2 ) ), _mm_mul_ps( w1, w2 ) );
+        __m128 d = _mm_andnot_ps( sign, dot );
+        __m128 wa, wb;
+        if( Fast ) {
+            __m128 a = _mm_add_ps( _mm_set1_ps( 3.55645f ), _mm_mul_ps( d, _mm_set1_ps( -1.43519f ) ) );
+            a = _mm_add_ps( _mm_set1_ps( -3.2452f ), _mm_mul_ps( d, a ) );
+            a = _mm_add_ps( _mm_set1_ps( 1.0904f ), _mm_mul_ps( d, a ) );
+            __m128 b = _mm_add_ps( _mm_set1_ps( -1.06021f ), _mm_mul_ps( d, _mm_set1_ps( 0.215638f ) ) );
+            b = _mm_add_ps( _mm_set1_ps( 0.848013f ), _mm_mul_ps( d, b ) );
+            __m128 u = _mm_sub_ps( t, _mm_set1_ps( 0.5f ) );
+            __m128 k = _mm_add_ps( _mm_mul_ps( _mm_mul_ps( a, u ), u ), b );
+            wb = _mm_add_ps( t, _mm_mul_ps(
+                _mm_mul_ps( _mm_mul_ps( t, u ), _mm_sub_ps( t, one ) ), k ) );
+            wa = _mm_sub_ps( one, wb );
+        } else {
+            __m128 theta    = Acos( d );
+            __m128 sinTheta = _mm_sqrt_ps( _mm_sub_ps( one, _mm_mul_ps( d, d ) ) );
+            __m128 inverse  = _mm_div_ps( one, _mm_max_ps( sinTheta, _mm_set1_ps( EPSILON ) ) );
+            __m128 linear   = _mm_cmpgt_ps( d, _mm_set1_ps( 0.9995f ) );
+            wa = Simd4::Select( linear, _mm_sub_ps( one, t ),
+                _mm_mul_ps( Sin( _mm_mul_ps( _mm_sub_ps( one, t ), theta ) ), inverse ) );
+            wb = Simd4::Select( linear, t,
+                _mm_mul_ps( Sin( _mm_mul_ps( t, theta ) ), inverse ) );
+        }
+        wb = _mm_xor_ps( wb, _mm_and_ps( _mm_cmplt_ps( dot, _mm_setzero_ps() ), sign ) );
+
+        __m128 x = _mm_add_ps( _mm_mul_ps( x1, wa ), _mm_mul_ps( x2, wb ) );
+        __m128 y = _mm_add_ps( _mm_mul_ps( y1, wa ), _mm_mul_ps( y2, wb ) );
+        __m128 z = _mm_add_ps( _mm_mul_ps( z1, wa ), _mm_mul_ps( z2, wb ) );
+        __m128 w = _mm_add_ps( _mm_mul_ps( w1, wa ), _mm_mul_ps( w2, wb ) );
+        __m128 inverse = Simd4::InverseLength( _mm_add_ps( _mm_add_ps( _mm_add_ps(
+            _mm_mul_ps( x, x ), _mm_mul_ps( y, y ) ),
+            _mm_mul_ps( z, z ) ), _mm_mul_ps( w, w ) ) );
+        Simd4::Store( out,
+            _mm_mul_ps( x, inverse ), _mm_mul_ps( y, inverse ),
+            _mm_mul_ps( z, inverse ), _mm_mul_ps( w, inverse ) );
     }
-    inline
-    float Distance( Vector3 v2 ) const {
-        return Vector3Distance( *this, v2 );
+#endif
+    /// amount is one weight for every element, or one per element.
+    template<bool Fast, bool PerElement> static inline
+    void Stream(
+        const Quaternion* q1, const Quaternion* q2,
+        const float* amount, Quaternion* out, size_t count
+    ) {
+        size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+        __m128 t = _mm_set1_ps( amount[0] );
+        for( ; i + 4 <= count; i += 4 ) {
+            if( PerElement ) {
+                t = _mm_loadu_ps( amount + i );
+            }
+            Blend<Fast>( q1 + i, q2 + i, t, out + i );
+        }
+        if( i < count ) {
+            // NOTE(alicia): the last 1-3 go through the wide path as well,
+            // padded with zero quaternions.
+            Quaternion a[4] = {}, b[4] = {}, result[4];
+            float weights[4] = {};
+            size_t tail = count - i;
+            for( size_t j = 0; j < tail; ++j ) {
+                a[j] = q1[i + j];
+                b[j] = q2[i + j];
+                weights[j] = amount[PerElement ? i + j : 0];
+            }
+            Blend<Fast>( a, b, PerElement ? _mm_loadu_ps( weights ) : t, result );
+            for( size_t j = 0; j < tail; ++j ) {
+                out[i + j] = result[j];
+            }
+        }
+#else
+        for( ; i < count; ++i ) {
+            Blend<Fast>( q1 + i, q2 + i, amount[PerElement ? i : 0], out + i );
+        }
+#endif
     }
-    inline
-    float DistanceSqr( Vector3 v2 ) const {
-        return Vector3DistanceSqr( *this, v2 );
+};
+/// Shortest arc slerp, see QuatBlend.
+inline
+void Slerp( const Quaternion* q1, const Quaternion* q2, float amount, Quaternion* out, size_t count ) {
+    QuatBlend::Stream<false, false>( q1, q2, &amount, out, count );
+}
+/// Shortest arc slerp with one amount per element, e.g. a bone mask.
+inline
+void Slerp( const Quaternion* q1, const Quaternion* q2, const float* amount, Quaternion* out, size_t count ) {
+    QuatBlend::Stream<false, true>( q1, q2, amount, out, count );
+}
+/// Approximate shortest arc slerp, see QuatBlend.
+inline
+void SlerpFast( const Quaternion* q1, const Quaternion* q2, float amount, Quaternion* out, size_t count ) {
+    QuatBlend::Stream<true, false>( q1, q2, &amount, out, count );
+}
+/// Approximate shortest arc slerp with one amount per element.
+inline
+void SlerpFast( const Quaternion* q1, const Quaternion* q2, const float* amount, Quaternion* out, size_t count ) {
+    QuatBlend::Stream<true, true>( q1, q2, amount, out, count );
+}
+
+// NOTE(alicia): skinning.
+// like raylib's Mesh, every vertex has 4 entries in boneIds and
+// boneWeights, unused slots have weight 0. positions and normals are
+// skinned in the same pass, normals may be null.
+// DualQuat bones are blended linearly with every bone flipped onto the
+// same hemisphere as the first one, then normalized.
+// Matrix bones are blended as the weighted sum of their top 3 rows,
+// normals use the blended 3x3. a vertex with the same ids and weights
+// as the one before it reuses its blended matrix.
+// the scalar and 4-wide paths run the same arithmetic.
+struct Skinning {
+    /// Last blended matrix and the influences it was blended from.
+    struct Palette {
+        const unsigned char* ids     = nullptr;
+        const float*         weights = nullptr;
+        alignas(16) float    rows[12];
+    };
+
+    static inline
+    void Skin(
+        const DualQuat* bones, const unsigned char* ids, const float* weights,
+        const Vector3* position, const Vector3* normal, Vector3* outPosition, Vector3* outNormal, Palette*
+    ) {
+        const Quat& first = bones[ids[0]].real;
+        float r[4], d[4];
+        for( int c = 0; c < 4; ++c ) {
+            r[c] = bones[ids[0]].real.array[c]*weights[0];
+            d[c] = bones[ids[0]].dual.array[c]*weights[0];
+        }
+        for( int k = 1; k < 4; ++k ) {
+            const DualQuat& bone = bones[ids[k]];
+            float dot = bone.real.x*first.x + bone.real.y*first.y +
+                bone.real.z*first.z + bone.real.w*first.w;
+            float w = dot < 0.0f ? -weights[k] : weights[k];
+            for( int c = 0; c < 4; ++c ) {
+                r[c] = r[c] + bone.real.array[c]*w;
+                d[c] = d[c] + bone.dual.array[c]*w;
+            }
+        }
+        float lengthSqr = r[0]*r[0] + r[1]*r[1] + r[2]*r[2] + r[3]*r[3];
+        float inverse   = lengthSqr == 0.0f ? 1.0f : 1.0f/sqrtf( lengthSqr );
+        for( int c = 0; c < 4; ++c ) {
+            r[c] *= inverse;
+            d[c] *= inverse;
+        }
+        // NOTE(alicia): see DualQuat::Translation and TransformDirection.
+        float tx = ( r[3]*d[0] - d[3]*r[0] ) + ( r[1]*d[2] - r[2]*d[1] );
+        float ty = ( r[3]*d[1] - d[3]*r[1] ) + ( r[2]*d[0] - r[0]*d[2] );
+        float tz = ( r[3]*d[2] - d[3]*r[2] ) + ( r[0]*d[1] - r[1]*d[0] );
+        Vector3 p = Rotate( r, *position );
+        *outPosition = Vector3{ p.x + ( tx + tx ), p.y + ( ty + ty ), p.z + ( tz + tz ) };
+        if( normal ) {
+            *outNormal = Rotate( r, *normal );
+        }
     }
-    inline
-    float Angle( Vector3 v2 ) const {
-        return Vector3Angle( *this, v2 );
+    static inline
+    Vector3 Rotate( const float* r, Vector3 v ) {
+        float cx = ( r[1]*v.z - r[2]*v.y ) + r[3]*v.x;
+        float cy = ( r[2]*v.x - r[0]*v.z ) + r[3]*v.y;
+        float cz = ( r[0]*v.y - r[1]*v.x ) + r[3]*v.z;
+        float ex = r[1]*cz - r[2]*cy;
+        float ey = r[2]*cx - r[0]*cz;
+        float ez = r[0]*cy - r[1]*cx;
+        return Vector3{ v.x + ( ex + ex ), v.y + ( ey + ey ), v.z + ( ez + ez ) };
+    }
+#if defined(RAYMATH_CPP_SSE2)
+    /// Bone k of 4 vertices, one register per component.
+    static inline
+    void Gather( const DualQuat* bones, const unsigned char* ids, int k, __m128* real, __m128* dual ) {
+        const DualQuat& b0 = bones[ids[k]];
+        const DualQuat& b1 = bones[ids[k + 4]];
+        const DualQuat& b2 = bones[ids[k + 8]];
+        const DualQuat& b3 = bones[ids[k + 12]];
+        __m128 r0 = _mm_loadu_ps( b0.real.array ), d0 = _mm_loadu_ps( b0.dual.array );
+        __m128 r1 = _mm_loadu_ps( b1.real.array ), d1 = _mm_loadu_ps( b1.dual.array );
+        __m128 r2 = _mm_loadu_ps( b2.real.array ), d2 = _mm_loadu_ps( b2.dual.array );
+        __m128 r3 = _mm_loadu_ps( b3.real.array ), d3 = _mm_loadu_ps( b3.dual.array );
+        _MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+        _MM_TRANSPOSE4_PS( d0, d1, d2, d3 );
+        real[0] = r0; real[1] = r1; real[2] = r2; real[3] = r3;
+        dual[0] = d0; dual[1] = d1; dual[2] = d2; dual[3] = d3;
     }
-    inline
-    Vec3 Negate() const {
-        return Vector3Negate( *this );
+    static inline
+    void Rotate( const __m128* r, __m128* x, __m128* y, __m128* z ) {
+        __m128 cx = _mm_add_ps( _mm_sub_ps( _mm_mul_ps( r[1], *z ), _mm_mul_ps( r[2], *y ) ), _mm_mul_ps( r[3], *x ) );
+        __m128 cy = _mm_add_ps( _mm_sub_ps( _mm_mul_ps( r[2], *x ), _mm_mul_ps( r[0], *z ) ), _mm_mul_ps( r[3], *y ) );
+        __m128 cz = _mm_add_ps( _mm_sub_ps( _mm_mul_ps( r[0], *y ), _mm_mul_ps( r[1], *x ) ), _mm_mul_ps( r[3], *z ) );
+        __m128 ex = _mm_sub_ps( _mm_mul_ps( r[1], cz ), _mm_mul_ps( r[2], cy ) );
+        __m128 ey = _mm_sub_ps( _mm_mul_ps( r[2], cx ), _mm_mul_ps( r[0], cz ) );
+        __m128 ez = _mm_sub_ps( _mm_mul_ps( r[0], cy ), _mm_mul_ps( r[1], cx ) );
+        *x = _mm_add_ps( *x, _mm_add_ps( ex, ex ) );
+        *y = _mm_add_ps( *y, _mm_add_ps( ey, ey ) );
+        *z = _mm_add_ps( *z, _mm_add_ps( ez, ez ) );
+    }
+    /// 4 vertices, ids and weights start at the first one.
+    static inline
+    void Skin4(
+        const DualQuat* bones, const unsigned char* ids, const float* weights,
+        const Vector3* position, const Vector3* normal, Vector3* outPosition, Vector3* outNormal, Palette*
+    ) {
+        __m128 w[4];
+        Simd4::Load( (const Vector4*)weights, w + 0, w + 1, w + 2, w + 3 );
+        __m128 first[4], r[4], d[4];
+        Gather( bones, ids, 0, first, d );
+        for( int c = 0; c < 4; ++c ) {
+            r[c] = _mm_mul_ps( first[c], w[0] );
+            d[c] = _mm_mul_ps( d[c], w[0] );
+        }
+        __m128 sign = _mm_set1_ps( -0.0f );
+        for( int k = 1; k < 4; ++k ) {
+            __m128 real[4], dual[4];
+            Gather( bones, ids, k, real, dual );
+            __m128 dot = _mm_add_ps( _mm_add_ps( _mm_add_ps(
+                _mm_mul_ps( real[0], first[0] ), _mm_mul_ps( real[1], first[1] ) ),
+                _mm_mul_ps( real[2], first[2] ) ), _mm_mul_ps( real[3], first[3] ) );
+            __m128 wk = _mm_xor_ps( w[k], _mm_and_ps( _mm_cmplt_ps( dot, _mm_setzero_ps() ), sign ) );
+            for( int c = 0; c < 4; ++c ) {
+                r[c] = _mm_add_ps( r[c], _mm_mul_ps( real[c], wk ) );
+                d[c] = _mm_add_ps( d[c], _mm_mul_ps( dual[c], wk ) );
+            }
+        }
+        __m128 inverse = Simd4::InverseLength( _mm_add_ps( _mm_add_ps( _mm_add_ps(
+            _mm_mul_ps( r[0], r[0] ), _mm_mul_ps( r[1], r[1] ) ),
+            _mm_mul_ps( r[2], r[2] ) ), _mm_mul_ps( r[3], r[3] ) ) );
+        for( int c = 0; c < 4; ++c ) {
+            r[c] = _mm_mul_ps( r[c], inverse );
+            d[c] = _mm_mul_ps( d[c], inverse );
+        }
+        __m128 tx = _mm_add_ps(
+            _mm_sub_ps( _mm_mul_ps( r[3], d[0] ), _mm_mul_ps( d[3], r[0] ) ),
+            _mm_sub_ps( _mm_mul_ps( r[1], d[2] ), _mm_mul_ps( r[2], d[1] ) ) );
+        __m128 ty = _mm_add_ps(
+            _mm_sub_ps( _mm_mul_ps( r[3], d[1] ), _mm_mul_ps( d[3], r[1] ) ),
+            _mm_sub_ps( _mm_mul_ps( r[2], d[0] ), _mm_mul_ps( r[0], d[2] ) ) );
+        __m128 tz = _mm_add_ps(
+            _mm_sub_ps( _mm_mul_ps( r[3], d[2] ), _mm_mul_ps( d[3], r[2] ) ),
+            _mm_sub_ps( _mm_mul_ps( r[0], d[1] ), _mm_mul_ps( r[1], d[0] ) ) );
+        __m128 x, y, z;
+        Simd4::Load( position, &x, &y, &z );
+        Rotate( r, &x, &y, &z );
+        Simd4::Store( outPosition,
+            _mm_add_ps( x, _mm_add_ps( tx, tx ) ),
+            _mm_add_ps( y, _mm_add_ps( ty, ty ) ),
+            _mm_add_ps( z, _mm_add_ps( tz, tz ) ) );
+        if( normal ) {
+            Simd4::Load( normal, &x, &y, &z );
+            Rotate( r, &x, &y, &z );
+            Simd4::Store( outNormal, x, y, z );
+        }
     }
-    inline
-    Vec3 Divide( Vector3 v2 ) const {
-        return Vector3Divide( *this, v2 );
+#endif
+    static inline
+    bool Same( const unsigned char* ids, const float* weights, const Palette& last ) {
+        return last.ids &&
+            ids[0] == last.ids[0] && ids[1] == last.ids[1] &&
+            ids[2] == last.ids[2] && ids[3] == last.ids[3] &&
+            weights[0] == last.weights[0] && weights[1] == last.weights[1] &&
+            weights[2] == last.weights[2] && weights[3] == last.weights[3];
+    }
+    /// Blended top 3 rows for one vertex, valid until the next call.
+    static inline
+    const float* Blend( const Matrix* bones, const unsigned char* ids, const float* weights, Palette* last ) {
+        if( Same( ids, weights, *last ) ) {
+            last->ids     = ids;
+            last->weights = weights;
+            return last->rows;
+        }
+        last->ids     = ids;
+        last->weights = weights;
+#if defined(RAYMATH_CPP_SSE2)
+        const float* m = &bones[ids[0]].m0;
+        __m128 w  = _mm_set1_ps( weights[0] );
+        __m128 r0 = _mm_mul_ps( _mm_loadu_ps( m + 0 ), w );
+        __m128 r1 = _mm_mul_ps( _mm_loadu_ps( m + 4 ), w );
+        __m128 r2 = _mm_mul_ps( _mm_loadu_ps( m + 8 ), w );
+        for( int k = 1; k < 4; ++k ) {
+            m  = &bones[ids[k]].m0;
+            w  = _mm_set1_ps( weights[k] );
+            r0 = _mm_add_ps( r0, _mm_mul_ps( _mm_loadu_ps( m + 0 ), w ) );
+            r1 = _mm_add_ps( r1, _mm_mul_ps( _mm_loadu_ps( m + 4 ), w ) );
+            r2 = _mm_add_ps( r2, _mm_mul_ps( _mm_loadu_ps( m + 8 ), w ) );
+        }
+        _mm_store_ps( last->rows + 0, r0 );
+        _mm_store_ps( last->rows + 4, r1 );
+        _mm_store_ps( last->rows + 8, r2 );
+#else
+        const float* m = &bones[ids[0]].m0;
+        for( int c = 0; c < 12; ++c ) {
+            last->rows[c] = m[c]*weights[0];
+        }
+        for( int k = 1; k < 4; ++k ) {
+            m = &bones[ids[k]].m0;
+            for( int c = 0; c < 12; ++c ) {
+                last->rows[c] = last->rows[c] + m[c]*weights[k];
+            }
+        }
+#endif
+        return last->rows;
+    }
+    static inline
+    void Skin(
+        const Matrix* bones, const unsigned char* ids, const float* weights,
+        const Vector3* position, const Vector3* normal, Vector3* outPosition, Vector3* outNormal, Palette* last
+    ) {
+        // NOTE(alicia): same terms as Vector3Transform.
+        const float* m = Blend( bones, ids, weights, last );
+        Vector3 p = *position;
+        *outPosition = Vector3{
+            m[0]*p.x + m[1]*p.y + m[2]*p.z  + m[3],
+            m[4]*p.x + m[5]*p.y + m[6]*p.z  + m[7],
+            m[8]*p.x + m[9]*p.y + m[10]*p.z + m[11] };
+        if( normal ) {
+            Vector3 n = *normal;
+            *outNormal = Vector3{
+                m[0]*n.x + m[1]*n.y + m[2]*n.z,
+                m[4]*n.x + m[5]*n.y + m[6]*n.z,
+                m[8]*n.x + m[9]*n.y + m[10]*n.z };
+        }
+    }
+#if defined(RAYMATH_CPP_SSE2)
+    static inline
+    void Skin4(
+        const Matrix* bones, const unsigned char* ids, const float* weights,
+        const Vector3* position, const Vector3* normal, Vector3* outPosition, Vector3* outNormal, Palette* last
+    ) {
+        __m128 r0[4], r1[4], r2[4];
+        for( int j = 0; j < 4; ++j ) {
+            const float* m = Blend( bones, ids + 4 * j, weights + 4 * j, last );
+            r0[j] = _mm_load_ps( m + 0 );
+            r1[j] = _mm_load_ps( m + 4 );
+            r2[j] = _mm_load_ps( m + 8 );
+        }
+        // NOTE(alicia): one register per matrix element, 4 vertices each.
+        _MM_TRANSPOSE4_PS( r0[0], r0[1], r0[2], r0[3] );
+        _MM_TRANSPOSE4_PS( r1[0], r1[1], r1[2], r1[3] );
+        _MM_TRANSPOSE4_PS( r2[0], r2[1], r2[2], r2[3] );
+        __m128 x, y, z;
+        Simd4::Load( position, &x, &y, &z );
+        Simd4::Store( outPosition,
+            _mm_add_ps( Dot( r0, x, y, z ), r0[3] ),
+            _mm_add_ps( Dot( r1, x, y, z ), r1[3] ),
+            _mm_add_ps( Dot( r2, x, y, z ), r2[3] ) );
+        if( normal ) {
+            Simd4::Load( normal, &x, &y, &z );
+            Simd4::Store( outNormal, Dot( r0, x, y, z ), Dot( r1, x, y, z ), Dot( r2, x, y, z ) );
+        }
+    }
+    static inline
+    __m128 Dot( const __m128* row, __m128 x, __m128 y, __m128 z ) {
+        return _mm_add_ps( _mm_add_ps( _mm_mul_ps( row[0], x ), _mm_mul_ps( row[1], y ) ), _mm_mul_ps( row[2], z ) );
+    }
+#endif
+    template<typename Bone> static inline
+    void Stream(
+        const Bone* bones, const unsigned char* boneIds, const float* boneWeights,
+        const Vector3* positions, const Vector3* normals,
+        Vector3* outPositions, Vector3* outNormals, size_t count
+    ) {
+        Palette palette;
+        size_t  i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+        for( ; i + 4 <= count; i += 4 ) {
+            Skin4( bones, boneIds + 4 * i, boneWeights + 4 * i, positions + i,
+                normals ? normals + i : nullptr, outPositions + i, normals ? outNormals + i : nullptr, &palette );
+        }
+        if( i < count ) {
+            // NOTE(alicia): the last 1-3 go through the wide path as well,
+            // padded with weightless vertices on bone 0.
+            unsigned char ids[16] = {};
+            float   weights[16] = {};
+            Vector3 position[4] = {}, normal[4] = {}, outPosition[4], outNormal[4];
+            size_t tail = count - i;
+            for( size_t j = 0; j < tail; ++j ) {
+                for( int k = 0; k < 4; ++k ) {
+                    ids[4 * j + k]     = boneIds[4 * ( i + j ) + k];
+                    weights[4 * j + k] = boneWeights[4 * ( i + j ) + k];
+                }
+                position[j] = positions[i + j];
+                if( normals ) {
+                    normal[j] = normals[i + j];
+                }
+            }
+            Skin4( bones, ids, weights, position,
+                normals ? normal : nullptr, outPosition, normals ? outNormal : nullptr, &palette );
+            for( size_t j = 0; j < tail; ++j ) {
+                outPositions[i + j] = outPosition[j];
+                if( normals ) {
+                    outNormals[i + j] = outNormal[j];
+                }
+            }
+        }
+#else
+        for( ; i < count; ++i ) {
+            Skin( bones, boneIds + 4 * i, boneWeights + 4 * i, positions + i,
+                normals ? normals + i : nullptr, outPositions + i, normals ? outNormals + i : nullptr, &palette );
+        }
+#endif
     }
+};
+/// Dual quaternion skinning, see Skinning. bones are the joint
+/// transforms times the inverse bind pose.
+inline
+void Skin(
+    const DualQuat* bones, const unsigned char* boneIds, const float* boneWeights,
+    const Vector3* positions, const Vector3* normals,
+    Vector3* outPositions, Vector3* outNormals, size_t count
+) {
+    Skinning::Stream( bones, boneIds, boneWeights, positions, normals, outPositions, outNormals, count );
+}
+/// Linear blend skinning with a matrix palette, see Skinning.
+/// bones are the joint transforms times the inverse bind pose.
+inline
+void Skin(
+    const Matrix* bones, const unsigned char* boneIds, const float* boneWeights,
+    const Vector3* positions, const Vector3* normals,
+    Vector3* outPositions, Vector3* outNormals, size_t count
+) {
+    Skinning::Stream( bones, boneIds, boneWeights, positions, normals, outPositions, outNormals, count );
+}
 
-    inline
-    Vec3 Normalize() const {
-        return Vector3Normalize( *this );
+// NOTE(alicia): packed storage codecs, see Packing.
+inline
+void Encode( const Vector3* v, Vec3Half* out, size_t count ) {
+    // NOTE(alicia): both sides are flat arrays of 3 * count components.
+    const float*    src = (const float*)v;
+    unsigned short* dst = (unsigned short*)out;
+    size_t n = count * 3;
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    for( ; i + 8 <= n; i += 8 ) {
+        _mm_storeu_si128( (__m128i*)( dst + i ), _mm_packs_epi32(
+            Packing::FloatToHalf( _mm_loadu_ps( src + i ) ),
+            Packing::FloatToHalf( _mm_loadu_ps( src + i + 4 ) ) ) );
     }
-    inline
-    void OrthoNormalize( Vector3 *v2 ) {
-        Vector3OrthoNormalize( (Vector3*)this, v2 );
+#endif
+    for( ; i < n; ++i ) {
+        dst[i] = Packing::FloatToHalf( src[i] );
     }
-    inline
-    Vec3 Transform( const Matrix& mat ) const {
-        return Vector3Transform( *this, mat );
+}
+inline
+void Decode( const Vec3Half* v, Vector3* out, size_t count ) {
+    const unsigned short* src = (const unsigned short*)v;
+    float* dst = (float*)out;
+    size_t n = count * 3;
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    for( ; i + 8 <= n; i += 8 ) {
+        __m128i halves = _mm_loadu_si128( (const __m128i*)( src + i ) );
+        _mm_storeu_ps( dst + i, Packing::HalfToFloat(
+            _mm_unpacklo_epi16( halves, _mm_setzero_si128() ) ) );
+        _mm_storeu_ps( dst + i + 4, Packing::HalfToFloat(
+            _mm_unpackhi_epi16( halves, _mm_setzero_si128() ) ) );
     }
-    inline
-    Vec3 Rotate( Quaternion q ) const {
-        return Vector3RotateByQuaternion( *this, q );
+#endif
+    for( ; i < n; ++i ) {
+        dst[i] = Packing::HalfToFloat( src[i] );
     }
-    inline
-    Vec3 Rotate( Vector3 axis, float angle ) const {
-        return Vector3RotateByAxisAngle( *this, axis, angle );
+}
+inline
+void Encode( const Vector3* normals, NormalOct16* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x, y, z;
+        Simd4::Load( normals + i, &x, &y, &z );
+        __m128i ox, oy;
+        Packing::EncodeOct( x, y, z, &ox, &oy );
+        _mm_storeu_si128( (__m128i*)( out + i ), _mm_packs_epi32(
+            _mm_unpacklo_epi32( ox, oy ), _mm_unpackhi_epi32( ox, oy ) ) );
     }
-    inline
-    Vec3 MoveTowards( Vector3 target, float maxDistance ) const {
-        return Vector3MoveTowards( *this, target, maxDistance );
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = NormalOct16( normals[i] );
     }
-    inline
-    Vec3 Lerp( Vector3 v2, float amount ) const {
-        return Vector3Lerp( *this, v2, amount );
+}
+inline
+void Decode( const NormalOct16* normals, Vector3* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128i packed = _mm_loadu_si128( (const __m128i*)( normals + i ) );
+        __m128  lo = _mm_cvtepi32_ps( _mm_srai_epi32( _mm_unpacklo_epi16( packed, packed ), 16 ) );
+        __m128  hi = _mm_cvtepi32_ps( _mm_srai_epi32( _mm_unpackhi_epi16( packed, packed ), 16 ) );
+        __m128  x, y, z;
+        Packing::DecodeOct(
+            _mm_cvtps_epi32( _mm_shuffle_ps( lo, hi, _MM_SHUFFLE( 2, 0, 2, 0 ) ) ),
+            _mm_cvtps_epi32( _mm_shuffle_ps( lo, hi, _MM_SHUFFLE( 3, 1, 3, 1 ) ) ),
+            &x, &y, &z );
+        Simd4::Store( out + i, x, y, z );
     }
-    inline
-    Vec3 Reflect( Vector3 normal ) const {
-        return Vector3Reflect( *this, normal );
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = normals[i].ToVec3();
     }
-    inline
-    Vec3 Min( Vector3 v2 ) const {
-        return Vector3Min( *this, v2 );
+}
+inline
+void Encode( const Quaternion* q, QuatPacked32* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x, y, z, w;
+        Simd4::Load( q + i, &x, &y, &z, &w );
+        __m128i index, a, b, c;
+        Packing::EncodeQuat( x, y, z, w, Packing::QuatMax32, &index, &a, &b, &c );
+        _mm_storeu_si128( (__m128i*)( out + i ), _mm_or_si128(
+            _mm_or_si128( _mm_slli_epi32( index, 30 ), _mm_slli_epi32( a, 20 ) ),
+            _mm_or_si128( _mm_slli_epi32( b, 10 ), c ) ) );
     }
-    inline
-    Vec3 Max( Vector3 v2 ) const {
-        return Vector3Max( *this, v2 );
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = QuatPacked32( q[i] );
     }
-    inline
-    Vec3 Barycenter( Vector3 a, Vector3 b, Vector3 c ) const {
-        return Vector3Barycenter( *this, a, b, c );
+}
+inline
+void Decode( const QuatPacked32* q, Quaternion* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128i bits = _mm_loadu_si128( (const __m128i*)( q + i ) );
+        __m128i mask = _mm_set1_epi32( 1023 );
+        __m128 x, y, z, w;
+        Packing::DecodeQuat( _mm_srli_epi32( bits, 30 ),
+            _mm_and_si128( _mm_srli_epi32( bits, 20 ), mask ),
+            _mm_and_si128( _mm_srli_epi32( bits, 10 ), mask ),
+            _mm_and_si128( bits, mask ), Packing::QuatMax32, &x, &y, &z, &w );
+        Simd4::Store( out + i, x, y, z, w );
     }
-    inline
-    Vec3 Unproject( const Matrix& projection, const Matrix& view ) const {
-        return Vector3Unproject( *this, projection, view );
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = q[i].ToQuat();
     }
-    inline
-    float3 ToFloatV() const {
-        return Vector3ToFloatV( *this );
+}
+inline
+void Encode( const Quaternion* q, QuatPacked48* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128 x, y, z, w;
+        Simd4::Load( q + i, &x, &y, &z, &w );
+        __m128i index, a, b, c;
+        Packing::EncodeQuat( x, y, z, w, Packing::QuatMax48, &index, &a, &b, &c );
+        Packing::StoreQuat48( (unsigned short*)( out + i ),
+            _mm_or_si128( a, _mm_slli_epi32( _mm_and_si128( index, _mm_set1_epi32( 1 ) ), 15 ) ),
+            _mm_or_si128( b, _mm_slli_epi32( _mm_srli_epi32( index, 1 ), 15 ) ), c );
     }
-    inline
-    Vec3 Invert() const {
-        return Vector3Invert( *this );
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = QuatPacked48( q[i] );
     }
-    inline
-    Vec3 Clamp( Vector3 min, Vector3 max ) const {
-        return Vector3Clamp( *this, min, max );
+}
+inline
+void Decode( const QuatPacked48* q, Quaternion* out, size_t count ) {
+    size_t i = 0;
+#if defined(RAYMATH_CPP_SSE2)
+    for( ; i + 4 <= count; i += 4 ) {
+        __m128i a, b, c;
+        Packing::LoadQuat48( (const unsigned short*)( q + i ), &a, &b, &c );
+        __m128i mask = _mm_set1_epi32( 0x7FFF );
+        __m128 x, y, z, w;
+        Packing::DecodeQuat(
+            _mm_or_si128( _mm_srli_epi32( a, 15 ), _mm_slli_epi32( _mm_srli_epi32( b, 15 ), 1 ) ),
+            _mm_and_si128( a, mask ), _mm_and_si128( b, mask ), _mm_and_si128( c, mask ),
+            Packing::QuatMax48, &x, &y, &z, &w );
+        Simd4::Store( out + i, x, y, z, w );
+    }
+#endif
+    for( ; i < count; ++i ) {
+        out[i] = q[i].ToQuat();
     }
-    inline
-    Vec3 ClampValue( float min, float max ) const {
-        return Vector3ClampValue( *this, min, max );
+}
+
+// NOTE(alicia): camera relative rebasing, see Vec3T.
+/// out[i] = ( positions[i] - origin ) rounded to float,
+/// same result as positions[i].RelativeTo( origin ).
+inline
+void Rebase( const Vec3T<double>* positions, const Vec3T<double>& origin, Vector3* out, size_t count ) {
+    // NOTE(alicia): both sides are flat arrays of 3 * count components,
+    // 4 positions are 12 components so the origin pattern lines up
+    // with whole registers.
+    const double* src = (const double*)positions;
+    float*        dst = (float*)out;
+    size_t n = count * 3;
+    size_t i = 0;
+#if defined(RAYMATH_CPP_AVX)
+    __m256d o0 = _mm256_setr_pd( origin.x, origin.y, origin.z, origin.x );
+    __m256d o1 = _mm256_setr_pd( origin.y, origin.z, origin.x, origin.y );
+    __m256d o2 = _mm256_setr_pd( origin.z, origin.x, origin.y, origin.z );
+    for( ; i + 12 <= n; i += 12 ) {
+        _mm_storeu_ps( dst + i,     _mm256_cvtpd_ps( _mm256_sub_pd( _mm256_loadu_pd( src + i ),     o0 ) ) );
+        _mm_storeu_ps( dst + i + 4, _mm256_cvtpd_ps( _mm256_sub_pd( _mm256_loadu_pd( src + i + 4 ), o1 ) ) );
+        _mm_storeu_ps( dst + i + 8, _mm256_cvtpd_ps( _mm256_sub_pd( _mm256_loadu_pd( src + i + 8 ), o2 ) ) );
+    }
+#elif defined(RAYMATH_CPP_SSE2)
+    __m128d o0 = _mm_setr_pd( origin.x, origin.y );
+    __m128d o1 = _mm_setr_pd( origin.z, origin.x );
+    __m128d o2 = _mm_setr_pd( origin.y, origin.z );
+    for( ; i + 12 <= n; i += 12 ) {
+        __m128 a = _mm_cvtpd_ps( _mm_sub_pd( _mm_loadu_pd( src + i ),      o0 ) );
+        __m128 b = _mm_cvtpd_ps( _mm_sub_pd( _mm_loadu_pd( src + i + 2 ),  o1 ) );
+        __m128 c = _mm_cvtpd_ps( _mm_sub_pd( _mm_loadu_pd( src + i + 4 ),  o2 ) );
+        __m128 d = _mm_cvtpd_ps( _mm_sub_pd( _mm_loadu_pd( src + i + 6 ),  o0 ) );
+        __m128 e = _mm_cvtpd_ps( _mm_sub_pd( _mm_loadu_pd( src + i + 8 ),  o1 ) );
+        __m128 f = _mm_cvtpd_ps( _mm_sub_pd( _mm_loadu_pd( src + i + 10 ), o2 ) );
+        _mm_storeu_ps( dst + i,     _mm_movelh_ps( a, b ) );
+        _mm_storeu_ps( dst + i + 4, _mm_movelh_ps( c, d ) );
+        _mm_storeu_ps( dst + i + 8, _mm_movelh_ps( e, f ) );
     }
-    inline
-    bool Equals( Vector3 q ) const {
-        return Vector3Equals( *this, q );
+#endif
+    for( ; i < n; ++i ) {
+        dst[i] = (float)( src[i] - origin.array[i % 3] );
     }
-    inline
-    Vec3 Refract( Vector3 n, float r ) const {
-        return Vector3Refract( *this, n, r );
+}
+/// out[i] = matrices[i].RelativeTo( origin ).
+inline
+void Rebase( const Mat4T<double>* matrices, const Vec3T<double>& origin, Matrix* out, size_t count ) {
+    for( size_t i = 0; i < count; ++i ) {
+        out[i] = matrices[i].RelativeTo( origin );
     }
-};
+}
+
+// NOTE(alicia): Vec2/Vec3/Vec4 arrays alias the raymath types.
 inline
-Vec3 operator+( Vector3 v1, Vector3 v2 ) {
-    return Vector3Add( v1, v2 );
+void Length( const Vec2* v, float* out, size_t count ) {
+    Length( (const Vector2*)v, out, count );
 }
 inline
-Vec3 operator-( Vector3 v1, Vector3 v2 ) {
-    return Vector3Subtract( v1, v2 );
+void LengthSqr( const Vec2* v, float* out, size_t count ) {
+    LengthSqr( (const Vector2*)v, out, count );
 }
 inline
-Vec3 operator*( Vector3 v1, float scale ) {
-    return Vector3Scale( v1, scale );
+void DotProduct( const Vec2* v1, const Vec2* v2, float* out, size_t count ) {
+    DotProduct( (const Vector2*)v1, (const Vector2*)v2, out, count );
 }
 inline
-Vec3 operator*( float scale, Vector3 v1 ) {
-    return Vector3Scale( v1, scale );
+void Distance( const Vec2* v1, const Vec2* v2, float* out, size_t count ) {
+    Distance( (const Vector2*)v1, (const Vector2*)v2, out, count );
 }
 inline
-Vec3 operator*( Vector3 lhs, const Matrix& rhs ) {
-    return Vector3Transform( lhs, rhs );
+void DistanceSqr( const Vec2* v1, const Vec2* v2, float* out, size_t count ) {
+    DistanceSqr( (const Vector2*)v1, (const Vector2*)v2, out, count );
 }
 inline
-Vec3 operator/( Vector3 v1, float scale ) {
-    return Vector3Scale( v1, 1.0f / scale );
+void Normalize( const Vec2* v, Vec2* out, size_t count ) {
+    Normalize( (const Vector2*)v, (Vector2*)out, count );
 }
 inline
-bool operator==( Vector3 p, Vector3 q ) {
-    return Vector3Equals( p, q );
+void Lerp( const Vec2* v1, const Vec2* v2, float amount, Vec2* out, size_t count ) {
+    Lerp( (const Vector2*)v1, (const Vector2*)v2, amount, (Vector2*)out, count );
 }
 inline
-bool operator!=( Vector3 p, Vector3 q ) {
-    return !( p == q );
+void Reflect( const Vec2* v, Vector2 normal, Vec2* out, size_t count ) {
+    Reflect( (const Vector2*)v, normal, (Vector2*)out, count );
 }
 inline
-float Length( Vector3 v ) {
-    return Vector3Length( v );
+void Rotate( const Vec2* v, float angle, Vec2* out, size_t count ) {
+    Rotate( (const Vector2*)v, angle, (Vector2*)out, count );
 }
 inline
-float LengthSqr( Vector3 v ) {
-    return Vector3LengthSqr( v );
+void Clamp( const Vec2* v, Vector2 min, Vector2 max, Vec2* out, size_t count ) {
+    Clamp( (const Vector2*)v, min, max, (Vector2*)out, count );
 }
 inline
-float DotProduct( Vector3 v1, Vector3 v2 ) {
-    return Vector3DotProduct( v1, v2 );
+void Clamp( const Vec2* v, float min, float max, Vec2* out, size_t count ) {
+    Clamp( (const Vector2*)v, min, max, (Vector2*)out, count );
 }
 inline
-Vec3 CrossProduct( Vector3 v1, Vector3 v2 ) {
-    return Vector3CrossProduct( v1, v2 );
+void Length( const Vec3* v, float* out, size_t count ) {
+    Length( (const Vector3*)v, out, count );
 }
 inline
-float Distance( Vector3 v1, Vector3 v2 ) {
-    return Vector3Distance( v1, v2 );
+void LengthSqr( const Vec3* v, float* out, size_t count ) {
+    LengthSqr( (const Vector3*)v, out, count );
 }
 inline
-float DistanceSqr( Vector3 v1, Vector3 v2 ) {
-    return Vector3DistanceSqr( v1, v2 );
+void DotProduct( const Vec3* v1, const Vec3* v2, float* out, size_t count ) {
+    DotProduct( (const Vector3*)v1, (const Vector3*)v2, out, count );
 }
 inline
-float Angle( Vector3 v1, Vector3 v2 ) {
-    return Vector3Angle( v1, v2 );
+void CrossProduct( const Vec3* v1, const Vec3* v2, Vec3* out, size_t count ) {
+    CrossProduct( (const Vector3*)v1, (const Vector3*)v2, (Vector3*)out, count );
 }
 inline
-Vec3 Normalize( Vector3 v ) {
-    return Vector3Normalize( v );
+void Distance( const Vec3* v1, const Vec3* v2, float* out, size_t count ) {
+    Distance( (const Vector3*)v1, (const Vector3*)v2, out, count );
 }
 inline
-Vec3 MoveTowards( Vector3 v, Vector3 target, float maxDistance ) {
-    return Vector3MoveTowards( v, target, maxDistance );
+void DistanceSqr( const Vec3* v1, const Vec3* v2, float* out, size_t count ) {
+    DistanceSqr( (const Vector3*)v1, (const Vector3*)v2, out, count );
 }
 inline
-Vec3 Lerp( Vector3 v1, Vector3 v2, float amount ) {
-    return Vector3Lerp( v1, v2, amount );
+void Normalize( const Vec3* v, Vec3* out, size_t count ) {
+    Normalize( (const Vector3*)v, (Vector3*)out, count );
 }
 inline
-Vec3 Reflect( Vector3 v, Vector3 normal ) {
-    return Vector3Reflect( v, normal );
+void Lerp( const Vec3* v1, const Vec3* v2, float amount, Vec3* out, size_t count ) {
+    Lerp( (const Vector3*)v1, (const Vector3*)v2, amount, (Vector3*)out, count );
 }
 inline
-Vec3 Rotate( Vector3 v, Quaternion q ) {
-    return Vector3RotateByQuaternion( v, q );
+void Reflect( const Vec3* v, Vector3 normal, Vec3* out, size_t count ) {
+    Reflect( (const Vector3*)v, normal, (Vector3*)out, count );
 }
 inline
-Vec3 Rotate( Vector3 v, Vector3 axis, float angle ) {
-    return Vector3RotateByAxisAngle( v, axis, angle );
+void Rotate( const Vec3* v, Quaternion q, Vec3* out, size_t count ) {
+    Rotate( (const Vector3*)v, q, (Vector3*)out, count );
 }
 inline
-Vec3 Clamp( Vector3 v, Vector3 min, Vector3 max ) {
-    return Vector3Clamp( v, min, max );
+void Rotate( const Vec3* v, Vector3 axis, float angle, Vec3* out, size_t count ) {
+    Rotate( (const Vector3*)v, axis, angle, (Vector3*)out, count );
 }
 inline
-Vec3 Clamp( Vector3 v, float min, float max ) {
-    return Vector3ClampValue( v, min, max );
+void Transform( const Vec3* v, const Matrix& mat, Vec3* out, size_t count ) {
+    Transform( (const Vector3*)v, mat, (Vector3*)out, count );
+}
+inline
+void TransformDirection( const Vec3* v, const Matrix& mat, Vec3* out, size_t count ) {
+    TransformDirection( (const Vector3*)v, mat, (Vector3*)out, count );
+}
+inline
+void TransformProject( const Vec3* v, const Matrix& mat, Vec3* out, size_t count ) {
+    TransformProject( (const Vector3*)v, mat, (Vector3*)out, count );
+}
+inline
+void Transform( const Vec3* v, const Affine3x4& affine, Vec3* out, size_t count ) {
+    Transform( (const Vector3*)v, affine, (Vector3*)out, count );
+}
+inline
+void TransformDirection( const Vec3* v, const Affine3x4& affine, Vec3* out, size_t count ) {
+    TransformDirection( (const Vector3*)v, affine, (Vector3*)out, count );
+}
+inline
+void NormalMatrix( const Mat4* models, Mat3* out, size_t count ) {
+    NormalMatrix( (const Matrix*)models, out, count );
+}
+inline
+void ComposeMatrix(
+    const Vec3* translations, const Quat* rotations, const Vec3* scales, Mat4* out, size_t count
+) {
+    ComposeMatrix( (const Vector3*)translations, (const Quaternion*)rotations,
+        (const Vector3*)scales, (Matrix*)out, count );
+}
+inline
+void DecomposeMatrix(
+    const Mat4* matrices, Vec3* translations, Quat* rotations, Vec3* scales, size_t count
+) {
+    DecomposeMatrix( (const Matrix*)matrices, (Vector3*)translations,
+        (Quaternion*)rotations, (Vector3*)scales, count );
+}
+inline
+void Clamp( const Vec3* v, Vector3 min, Vector3 max, Vec3* out, size_t count ) {
+    Clamp( (const Vector3*)v, min, max, (Vector3*)out, count );
+}
+inline
+void Clamp( const Vec3* v, float min, float max, Vec3* out, size_t count ) {
+    Clamp( (const Vector3*)v, min, max, (Vector3*)out, count );
+}
+inline
+void Length( const Vec4* v, float* out, size_t count ) {
+    Length( (const Vector4*)v, out, count );
+}
+inline
+void LengthSqr( const Vec4* v, float* out, size_t count ) {
+    LengthSqr( (const Vector4*)v, out, count );
+}
+inline
+void DotProduct( const Vec4* v1, const Vec4* v2, float* out, size_t count ) {
+    DotProduct( (const Vector4*)v1, (const Vector4*)v2, out, count );
+}
+inline
+void Distance( const Vec4* v1, const Vec4* v2, float* out, size_t count ) {
+    Distance( (const Vector4*)v1, (const Vector4*)v2, out, count );
+}
+inline
+void DistanceSqr( const Vec4* v1, const Vec4* v2, float* out, size_t count ) {
+    DistanceSqr( (const Vector4*)v1, (const Vector4*)v2, out, count );
+}
+inline
+void Transform( const Vec4* v, const Matrix& mat, Vec4* out, size_t count ) {
+    Transform( (const Vector4*)v, mat, (Vector4*)out, count );
+}
+inline
+void Normalize( const Vec4* v, Vec4* out, size_t count ) {
+    Normalize( (const Vector4*)v, (Vector4*)out, count );
+}
+inline
+void Lerp( const Vec4* v1, const Vec4* v2, float amount, Vec4* out, size_t count ) {
+    Lerp( (const Vector4*)v1, (const Vector4*)v2, amount, (Vector4*)out, count );
+}
+inline
+void Normalize( const Quat* q, Quat* out, size_t count ) {
+    Normalize( (const Quaternion*)q, (Quaternion*)out, count );
+}
+inline
+void Nlerp( const Quat* q1, const Quat* q2, float amount, Quat* out, size_t count ) {
+    Nlerp( (const Quaternion*)q1, (const Quaternion*)q2, amount, (Quaternion*)out, count );
+}
+inline
+void Slerp( const Quat* q1, const Quat* q2, float amount, Quat* out, size_t count ) {
+    Slerp( (const Quaternion*)q1, (const Quaternion*)q2, amount, (Quaternion*)out, count );
+}
+inline
+void Slerp( const Quat* q1, const Quat* q2, const float* amount, Quat* out, size_t count ) {
+    Slerp( (const Quaternion*)q1, (const Quaternion*)q2, amount, (Quaternion*)out, count );
+}
+inline
+void SlerpFast( const Quat* q1, const Quat* q2, float amount, Quat* out, size_t count ) {
+    SlerpFast( (const Quaternion*)q1, (const Quaternion*)q2, amount, (Quaternion*)out, count );
+}
+inline
+void SlerpFast( const Quat* q1, const Quat* q2, const float* amount, Quat* out, size_t count ) {
+    SlerpFast( (const Quaternion*)q1, (const Quaternion*)q2, amount, (Quaternion*)out, count );
+}
+inline
+void Encode( const Vec3* v, Vec3Half* out, size_t count ) {
+    Encode( (const Vector3*)v, out, count );
+}
+inline
+void Decode( const Vec3Half* v, Vec3* out, size_t count ) {
+    Decode( v, (Vector3*)out, count );
+}
+inline
+void Encode( const Vec3* normals, NormalOct16* out, size_t count ) {
+    Encode( (const Vector3*)normals, out, count );
+}
+inline
+void Decode( const NormalOct16* normals, Vec3* out, size_t count ) {
+    Decode( normals, (Vector3*)out, count );
+}
+inline
+void Encode( const Quat* q, QuatPacked32* out, size_t count ) {
+    Encode( (const Quaternion*)q, out, count );
+}
+inline
+void Decode( const QuatPacked32* q, Quat* out, size_t count ) {
+    Decode( q, (Quaternion*)out, count );
 }
-
-struct Vec4 {
-    union {
-        float array[4];
-        struct { float x = 0.0f, y = 0.0f, z = 0.0f, w = 0.0f; };
-        // TODO(alicia): swizzle? there are 256 permutations . . .
-    };
-    Vec4() {}
-    Vec4( float x, float y, float z, float w ) : x(x), y(y), z(z), w(w) {}
-    Vec4( const Vector4& v ) : Vec4( v.x, v.y, v.z, v.w ) {}
-
-    inline
-    operator Vector4() const {
-        return *(Vector4*)this;
-    }
-    inline
-    float operator[]( size_t idx ) const {
-        return array[idx];
-    }
-    inline
-    float& operator[]( size_t idx ) {
-        return array[idx];
-    }
-
-    inline
-    Vec4& operator+=( Vec4 v2 ) {
-        return *this = this->Add( v2 );
-    }
-    inline
-    Vec4& operator-=( Vec4 v2 ) {
-        return *this = this->Subtract( v2 );
-    }
-    inline
-    Vec4& operator*=( float value ) {
-        return *this = this->Scale( value );
-    }
-    inline
-    Vec4& operator/=( float value ) {
-        return *this = this->Scale( 1.0f / value );
-    }
-    inline
-    Vec4 operator-() const {
-        return this->Negate();
-    }
-
-    static inline
-    Vec4 Zero() {
-        return Vector4Zero();
-    }
-    static inline
-    Vec4 One() {
-        return Vector4One();
-    }
-
-    inline
-    Vec4 Add( Vector4 v2 ) const {
-        return Vector4Add( *this, v2 );
-    }
-    inline
-    Vec4 AddValue( float add ) const {
-        return Vector4AddValue( *this, add );
-    }
-    inline
-    Vec4 Subtract( Vector4 v2 ) const {
-        return Vector4Subtract( *this, v2 );
-    }
-    inline
-    Vec4 SubtractValue( float sub ) const {
-        return Vector4SubtractValue( *this, sub );
-    }
-    inline
-    Vec4 Scale( float scalar ) const {
-        return Vector4Scale( *this, scalar );
-    }
-    inline
-    Vec4 Multiply( Vector4 v2 ) const {
-        return Vector4Multiply( *this, v2 );
-    }
-    inline
-    float Length() const {
-        return Vector4Length( *this );
-    }
-    inline
-    float LengthSqr() const {
-        return Vector4LengthSqr( *this );
-    }
-    inline
-    float DotProduct( Vector4 v2 ) const {
-        return Vector4DotProduct( *this, v2 );
-    }
-    inline
-    float Distance( Vector4 v2 ) const {
-        return Vector4Distance( *this, v2 );
-    }
-    inline
-    float DistanceSqr( Vector4 v2 ) const {
-        return Vector4DistanceSqr( *this, v2 );
-    }
-    inline
-    Vec4 Negate() const {
-        return Vector4Negate( *this );
-    }
-    inline
-    Vec4 Divide( Vector4 v2 ) const {
-        return Vector4Divide( *this, v2 );
-    }
-    inline
-    Vec4 Normalize() const {
-        return Vector4Normalize( *this );
-    }
-    inline
-    void OrthoNormalize( Vector3 *v2 ) {
-        Vector3OrthoNormalize( (Vector3*)this, v2 );
-    }
-    inline
-    Vec4 MoveTowards( Vector4 target, float maxDistance ) const {
-        return Vector4MoveTowards( *this, target, maxDistance );
-    }
-    inline
-    Vec4 Lerp( Vector4 v2, float amount ) const {
-        return Vector4Lerp( *this, v2, amount );
-    }
-    inline
-    Vec4 Min( Vector4 v2 ) const {
-        return Vector4Min( *this, v2 );
-    }
-    inline
-    Vec4 Max( Vector4 v2 ) const {
-        return Vector4Max( *this, v2 );
-    }
-    inline
-    Vec4 Invert() const {
-        return Vector4Invert( *this );
-    }
-    inline
-    bool Equals( Vector4 q ) const {
-        return Vector4Equals( *this, q );
-    }
-};
 inline
-Vec4 operator+( Vec4 v1, Vec4 v2 ) {
-    return Vector4Add( v1, v2 );
+void Encode( const Quat* q, QuatPacked48* out, size_t count ) {
+    Encode( (const Quaternion*)q, out, count );
 }
 inline
-Vec4 operator-( Vec4 v1, Vec4 v2 ) {
-    return Vector4Subtract( v1, v2 );
+void Decode( const QuatPacked48* q, Quat* out, size_t count ) {
+    Decode( q, (Quaternion*)out, count );
 }
 inline
-Vec4 operator*( Vec4 v1, float scale ) {
-    return Vector4Scale( v1, scale );
+void Rebase( const Vec3T<double>* positions, const Vec3T<double>& origin, Vec3* out, size_t count ) {
+    Rebase( positions, origin, (Vector3*)out, count );
 }
 inline
-Vec4 operator*( float scale, Vec4 v1 ) {
-    return Vector4Scale( v1, scale );
+void Rebase( const Mat4T<double>* matrices, const Vec3T<double>& origin, Mat4* out, size_t count ) {
+    Rebase( matrices, origin, (Matrix*)out, count );
 }
 inline
-Vec4 operator/( Vec4 v1, float scale ) {
-    return Vector4Scale( v1, 1.0f / scale );
+void Skin(
+    const DualQuat* bones, const unsigned char* boneIds, const float* boneWeights,
+    const Vec3* positions, const Vec3* normals, Vec3* outPositions, Vec3* outNormals, size_t count
+) {
+    Skin( bones, boneIds, boneWeights, (const Vector3*)positions, (const Vector3*)normals,
+        (Vector3*)outPositions, (Vector3*)outNormals, count );
 }
 inline
-bool operator==( Vec4 p, Vec4 q ) {
-    return Vector4Equals( p, q );
+void Skin(
+    const Mat4* bones, const unsigned char* boneIds, const float* boneWeights,
+    const Vec3* positions, const Vec3* normals, Vec3* outPositions, Vec3* outNormals, size_t count
+) {
+    Skin( (const Matrix*)bones, boneIds, boneWeights, (const Vector3*)positions, (const Vector3*)normals,
+        (Vector3*)outPositions, (Vector3*)outNormals, count );
 }
+
+#if defined(RAYMATH_CPP_SPAN)
+// NOTE(alicia): span overloads, out must be at least as long as the input.
 inline
-bool operator!=( Vec4 p, Vec4 q ) {
-    return !( p == q );
+void Length( std::span<const Vector2> v, std::span<float> out ) {
+    Length( v.data(), out.data(), v.size() );
 }
 inline
-float Length( Vector4 v ) {
-    return Vector4Length( v );
+void LengthSqr( std::span<const Vector2> v, std::span<float> out ) {
+    LengthSqr( v.data(), out.data(), v.size() );
 }
 inline
-float LengthSqr( Vector4 v ) {
-    return Vector4LengthSqr( v );
+void DotProduct( std::span<const Vector2> v1, std::span<const Vector2> v2, std::span<float> out ) {
+    DotProduct( v1.data(), v2.data(), out.data(), v1.size() );
 }
 inline
-float DotProduct( Vector4 v1, Vector4 v2 ) {
-    return Vector4DotProduct( v1, v2 );
+void Distance( std::span<const Vector2> v1, std::span<const Vector2> v2, std::span<float> out ) {
+    Distance( v1.data(), v2.data(), out.data(), v1.size() );
 }
 inline
-float Distance( Vector4 v1, Vector4 v2 ) {
-    return Vector4Distance( v1, v2 );
+void DistanceSqr( std::span<const Vector2> v1, std::span<const Vector2> v2, std::span<float> out ) {
+    DistanceSqr( v1.data(), v2.data(), out.data(), v1.size() );
 }
 inline
-float DistanceSqr( Vector4 v1, Vector4 v2 ) {
-    return Vector4DistanceSqr( v1, v2 );
+void Normalize( std::span<const Vector2> v, std::span<Vector2> out ) {
+    Normalize( v.data(), out.data(), v.size() );
 }
 inline
-Vec4 Normalize( Vector4 v ) {
-    return Vector4Normalize( v );
+void Lerp( std::span<const Vector2> v1, std::span<const Vector2> v2, float amount, std::span<Vector2> out ) {
+    Lerp( v1.data(), v2.data(), amount, out.data(), v1.size() );
 }
 inline
-Vec4 MoveTowards( Vector4 v, Vector4 target, float maxDistance ) {
-    return Vector4MoveTowards( v, target, maxDistance );
+void Reflect( std::span<const Vector2> v, Vector2 normal, std::span<Vector2> out ) {
+    Reflect( v.data(), normal, out.data(), v.size() );
 }
 inline
-Vec4 Lerp( Vector4 v1, Vector4 v2, float amount ) {
-    return Vector4Lerp( v1, v2, amount );
+void Rotate( std::span<const Vector2> v, float angle, std::span<Vector2> out ) {
+    Rotate( v.data(), angle, out.data(), v.size() );
+}
+inline
+void Clamp( std::span<const Vector2> v, Vector2 min, Vector2 max, std::span<Vector2> out ) {
+    Clamp( v.data(), min, max, out.data(), v.size() );
+}
+inline
+void Clamp( std::span<const Vector2> v, float min, float max, std::span<Vector2> out ) {
+    Clamp( v.data(), min, max, out.data(), v.size() );
+}
+inline
+void Length( std::span<const Vector3> v, std::span<float> out ) {
+    Length( v.data(), out.data(), v.size() );
+}
+inline
+void LengthSqr( std::span<const Vector3> v, std::span<float> out ) {
+    LengthSqr( v.data(), out.data(), v.size() );
+}
+inline
+void DotProduct( std::span<const Vector3> v1, std::span<const Vector3> v2, std::span<float> out ) {
+    DotProduct( v1.data(), v2.data(), out.data(), v1.size() );
+}
+inline
+void CrossProduct( std::span<const Vector3> v1, std::span<const Vector3> v2, std::span<Vector3> out ) {
+    CrossProduct( v1.data(), v2.data(), out.data(), v1.size() );
+}
+inline
+void Distance( std::span<const Vector3> v1, std::span<const Vector3> v2, std::span<float> out ) {
+    Distance( v1.data(), v2.data(), out.data(), v1.size() );
+}
+inline
+void DistanceSqr( std::span<const Vector3> v1, std::span<const Vector3> v2, std::span<float> out ) {
+    DistanceSqr( v1.data(), v2.data(), out.data(), v1.size() );
+}
+inline
+void Normalize( std::span<const Vector3> v, std::span<Vector3> out ) {
+    Normalize( v.data(), out.data(), v.size() );
+}
+inline
+void Lerp( std::span<const Vector3> v1, std::span<const Vector3> v2, float amount, std::span<Vector3> out ) {
+    Lerp( v1.data(), v2.data(), amount, out.data(), v1.size() );
+}
+inline
+void Reflect( std::span<const Vector3> v, Vector3 normal, std::span<Vector3> out ) {
+    Reflect( v.data(), normal, out.data(), v.size() );
+}
+inline
+void Rotate( std::span<const Vector3> v, Quaternion q, std::span<Vector3> out ) {
+    Rotate( v.data(), q, out.data(), v.size() );
+}
+inline
+void Rotate( std::span<const Vector3> v, Vector3 axis, float angle, std::span<Vector3> out ) {
+    Rotate( v.data(), axis, angle, out.data(), v.size() );
+}
+inline
+void Transform( std::span<const Vector3> v, const Matrix& mat, std::span<Vector3> out ) {
+    Transform( v.data(), mat, out.data(), v.size() );
+}
+inline
+void TransformDirection( std::span<const Vector3> v, const Matrix& mat, std::span<Vector3> out ) {
+    TransformDirection( v.data(), mat, out.data(), v.size() );
+}
+inline
+void TransformProject( std::span<const Vector3> v, const Matrix& mat, std::span<Vector3> out ) {
+    TransformProject( v.data(), mat, out.data(), v.size() );
+}
+inline
+void Transform( std::span<const Vector3> v, const Affine3x4& affine, std::span<Vector3> out ) {
+    Transform( v.data(), affine, out.data(), v.size() );
+}
+inline
+void TransformDirection( std::span<const Vector3> v, const Affine3x4& affine, std::span<Vector3> out ) {
+    TransformDirection( v.data(), affine, out.data(), v.size() );
+}
+inline
+void Multiply( std::span<const Affine3x4> left, const Affine3x4& right, std::span<Affine3x4> out ) {
+    Multiply( left.data(), right, out.data(), left.size() );
+}
+inline
+void NormalMatrix( std::span<const Matrix> models, std::span<Mat3> out ) {
+    NormalMatrix( models.data(), out.data(), models.size() );
+}
+inline
+void ComposeMatrix(
+    std::span<const Vector3> translations, std::span<const Quaternion> rotations,
+    std::span<const Vector3> scales, std::span<Matrix> out
+) {
+    ComposeMatrix( translations.data(), rotations.data(), scales.data(), out.data(), translations.size() );
+}
+inline
+void DecomposeMatrix(
+    std::span<const Matrix> matrices, std::span<Vector3> translations,
+    std::span<Quaternion> rotations, std::span<Vector3> scales
+) {
+    DecomposeMatrix( matrices.data(), translations.data(), rotations.data(), scales.data(), matrices.size() );
+}
+inline
+void Clamp( std::span<const Vector3> v, Vector3 min, Vector3 max, std::span<Vector3> out ) {
+    Clamp( v.data(), min, max, out.data(), v.size() );
+}
+inline
+void Clamp( std::span<const Vector3> v, float min, float max, std::span<Vector3> out ) {
+    Clamp( v.data(), min, max, out.data(), v.size() );
+}
+inline
+void Length( std::span<const Vector4> v, std::span<float> out ) {
+    Length( v.data(), out.data(), v.size() );
+}
+inline
+void LengthSqr( std::span<const Vector4> v, std::span<float> out ) {
+    LengthSqr( v.data(), out.data(), v.size() );
+}
+inline
+void DotProduct( std::span<const Vector4> v1, std::span<const Vector4> v2, std::span<float> out ) {
+    DotProduct( v1.data(), v2.data(), out.data(), v1.size() );
+}
+inline
+void Distance( std::span<const Vector4> v1, std::span<const Vector4> v2, std::span<float> out ) {
+    Distance( v1.data(), v2.data(), out.data(), v1.size() );
+}
+inline
+void DistanceSqr( std::span<const Vector4> v1, std::span<const Vector4> v2, std::span<float> out ) {
+    DistanceSqr( v1.data(), v2.data(), out.data(), v1.size() );
+}
+inline
+void Transform( std::span<const Vector4> v, const Matrix& mat, std::span<Vector4> out ) {
+    Transform( v.data(), mat, out.data(), v.size() );
+}
+inline
+void Normalize( std::span<const Vector4> v, std::span<Vector4> out ) {
+    Normalize( v.data(), out.data(), v.size() );
+}
+inline
+void Lerp( std::span<const Vector4> v1, std::span<const Vector4> v2, float amount, std::span<Vector4> out ) {
+    Lerp( v1.data(), v2.data(), amount, out.data(), v1.size() );
+}
+inline
+void Nlerp( std::span<const Quaternion> q1, std::span<const Quaternion> q2, float amount, std::span<Quaternion> out ) {
+    Nlerp( q1.data(), q2.data(), amount, out.data(), q1.size() );
 }
-
-struct Mat4 {
-    union {
-        float  array[16];
-        Matrix m;
-        struct {
-            float m0 = 0.0f, m4 = 0.0f,  m8 = 0.0f, m12 = 0.0f; 
-            float m1 = 0.0f, m5 = 0.0f,  m9 = 0.0f, m13 = 0.0f; 
-            float m2 = 0.0f, m6 = 0.0f, m10 = 0.0f, m14 = 0.0f;
-            float m3 = 0.0f, m7 = 0.0f, m11 = 0.0f, m15 = 0.0f;
-        };
-    };
-
-    Mat4() {}
-    Mat4(
-        float m0, float m4, float  m8, float m12, 
-        float m1, float m5, float  m9, float m13, 
-        float m2, float m6, float m10, float m14,
-        float m3, float m7, float m11, float m15
-    ) :
-        m0(m0), m4(m4),   m8(m8), m12(m12), 
-        m1(m1), m5(m5),   m9(m9), m13(m13), 
-        m2(m2), m6(m6), m10(m10), m14(m14),
-        m3(m3), m7(m7), m11(m11), m15(m15)
-    {}
-#if defined(RAYMATH_CPP_NO_STDLIB)
-    Mat4( const Matrix& mat ) {
-        *this = *(const Mat4*)&mat;
-    }
-#else
-    Mat4( const Matrix& mat ) : m( std::move(mat) ) {}
-#endif
-
-    inline
-    operator const Matrix&() const {
-        return *(Matrix*)this;
-    }
-    inline
-    operator Matrix&() {
-        return *(Matrix*)this;
-    }
-    inline
-    float operator[]( size_t idx ) const {
-        return array[idx];
-    }
-    inline
-    float& operator[]( size_t idx ) {
-        return array[idx];
-    }
-
-
-    static inline
-    Mat4 Identity() {
-        return MatrixIdentity();
-    }
-    static inline
-    Mat4 Translate( float x, float y, float z ) {
-        return MatrixTranslate( x, y, z );
-    }
-    static inline
-    Mat4 Translate( Vector3 translate ) {
-        return MatrixTranslate( translate.x, translate.y, translate.z );
-    }
-    static inline
-    Mat4 Rotate( Vector3 axis, float angle ) {
-        return MatrixRotate( axis, angle );
-    }
-    static inline
-    Mat4 RotateX( float angle ) {
-        return MatrixRotateX( angle );
-    }
-    static inline
-    Mat4 RotateY( float angle ) {
-        return MatrixRotateY( angle );
-    }
-    static inline
-    Mat4 RotateZ( float angle ) {
-        return MatrixRotateZ( angle );
-    }
-    static inline
-    Mat4 RotateXYZ( Vector3 angle ) {
-        return MatrixRotateXYZ( angle );
-    }
-    static inline
-    Mat4 RotateZYX( Vector3 angle ) {
-        return MatrixRotateZYX( angle );
-    }
-    static inline
-    Mat4 Scale( float x, float y, float z ) {
-        return MatrixScale( x, y, z );
-    }
-    static inline
-    Mat4 Scale( Vector3 scale ) {
-        return MatrixScale( scale.x, scale.y, scale.z );
-    }
-    static inline
-    Mat4 Frustum(
-        double left, double right,
-        double bottom, double top,
-        double nearPlane, double farPlane
-    ) {
-        return MatrixFrustum(
-            left, right,
-            bottom, top,
-            nearPlane, farPlane );
-    }
-    static inline
-    Mat4 Perspective( double fovY, double aspect, double nearPlane, double farPlane ) {
-        return MatrixPerspective( fovY, aspect, nearPlane, farPlane );
-    }
-    static inline
-    Mat4 Ortho(
-        double left, double right,
-        double bottom, double top,
-        double nearPlane, double farPlane
-    ) {
-        return MatrixOrtho(
-            left, right,
-            bottom, top,
-            nearPlane, farPlane );
-    }
-    static inline
-    Mat4 LookAt( Vector3 eye, Vector3 target, Vector3 up ) {
-        return MatrixLookAt( eye, target, up );
-    }
-
-    inline
-    float Determinant() const {
-        return MatrixDeterminant( *this );
-    }
-    inline
-    float Trace() const {
-        return MatrixTrace( *this );
-    }
-    inline
-    Mat4 Transpose() const {
-        return MatrixTranspose( *this );
-    }
-    inline
-    Mat4 Invert() const {
-        return MatrixInvert( *this );
-    }
-    inline
-    Mat4 Add( const Matrix& right ) const {
-        return MatrixAdd( *this, right );
-    }
-    inline
-    Mat4 Subtract( const Matrix& right ) const {
-        return MatrixSubtract( *this, right );
-    }
-    inline
-    Mat4 Multiply( const Matrix& right ) const {
-        const Matrix& left = *this;
-
-        Matrix result = {};
-
-        // NOTE(alicia): copied from raymath.h
-        // this is to avoid making a copy of left and right matrices.
-        result.m0 = left.m0*right.m0 + left.m1*right.m4 + left.m2*right.m8 + left.m3*right.m12;
-        result.m1 = left.m0*right.m1 + left.m1*right.m5 + left.m2*right.m9 + left.m3*right.m13;
-        result.m2 = left.m0*right.m2 + left.m1*right.m6 + left.m2*right.m10 + left.m3*right.m14;
-        result.m3 = left.m0*right.m3 + left.m1*right.m7 + left.m2*right.m11 + left.m3*right.m15;
-        result.m4 = left.m4*right.m0 + left.m5*right.m4 + left.m6*right.m8 + left.m7*right.m12;
-        result.m5 = left.m4*right.m1 + left.m5*right.m5 + left.m6*right.m9 + left.m7*right.m13;
-        result.m6 = left.m4*right.m2 + left.m5*right.m6 + left.m6*right.m10 + left.m7*right.m14;
-        result.m7 = left.m4*right.m3 + left.m5*right.m7 + left.m6*right.m11 + left.m7*right.m15;
-        result.m8 = left.m8*right.m0 + left.m9*right.m4 + left.m10*right.m8 + left.m11*right.m12;
-        result.m9 = left.m8*right.m1 + left.m9*right.m5 + left.m10*right.m9 + left.m11*right.m13;
-        result.m10 = left.m8*right.m2 + left.m9*right.m6 + left.m10*right.m10 + left.m11*right.m14;
-        result.m11 = left.m8*right.m3 + left.m9*right.m7 + left.m10*right.m11 + left.m11*right.m15;
-        result.m12 = left.m12*right.m0 + left.m13*right.m4 + left.m14*right.m8 + left.m15*right.m12;
-        result.m13 = left.m12*right.m1 + left.m13*right.m5 + left.m14*right.m9 + left.m15*right.m13;
-        result.m14 = left.m12*right.m2 + left.m13*right.m6 + left.m14*right.m10 + left.m15*right.m14;
-        result.m15 = left.m12*right.m3 + left.m13*right.m7 + left.m14*right.m11 + left.m15*right.m15;
-
-        return result;
-    }
-    inline
-    float16 ToFloatV() const {
-        return MatrixToFloatV( *this );
-    }
-};
 inline
-Mat4 operator+( const Matrix& left, const Matrix& right ) {
-    return MatrixAdd( left, right );
+void Slerp( std::span<const Quaternion> q1, std::span<const Quaternion> q2, float amount, std::span<Quaternion> out ) {
+    Slerp( q1.data(), q2.data(), amount, out.data(), q1.size() );
 }
 inline
-Mat4 operator-( const Matrix& left, const Matrix& right ) {
-    return MatrixSubtract( left, right );
+void Slerp( std::span<const Quaternion> q1, std::span<const Quaternion> q2, std::span<const float> amount, std::span<Quaternion> out ) {
+    Slerp( q1.data(), q2.data(), amount.data(), out.data(), q1.size() );
 }
 inline
-Mat4 operator*( const Matrix& left, const Matrix& right ) {
-    Matrix result = {};
-
-    // NOTE(alicia): copied from raymath.h
-    // this is to avoid making a copy of left and right matrices.
-    result.m0 = left.m0*right.m0 + left.m1*right.m4 + left.m2*right.m8 + left.m3*right.m12;
-    result.m1 = left.m0*right.m1 + left.m1*right.m5 + left.m2*right.m9 + left.m3*right.m13;
-    result.m2 = left.m0*right.m2 + left.m1*right.m6 + left.m2*right.m10 + left.m3*right.m14;
-    result.m3 = left.m0*right.m3 + left.m1*right.m7 + left.m2*right.m11 + left.m3*right.m15;
-    result.m4 = left.m4*right.m0 + left.m5*right.m4 + left.m6*right.m8 + left.m7*right.m12;
-    result.m5 = left.m4*right.m1 + left.m5*right.m5 + left.m6*right.m9 + left.m7*right.m13;
-    result.m6 = left.m4*right.m2 + left.m5*right.m6 + left.m6*right.m10 + left.m7*right.m14;
-    result.m7 = left.m4*right.m3 + left.m5*right.m7 + left.m6*right.m11 + left.m7*right.m15;
-    result.m8 = left.m8*right.m0 + left.m9*right.m4 + left.m10*right.m8 + left.m11*right.m12;
-    result.m9 = left.m8*right.m1 + left.m9*right.m5 + left.m10*right.m9 + left.m11*right.m13;
-    result.m10 = left.m8*right.m2 + left.m9*right.m6 + left.m10*right.m10 + left.m11*right.m14;
-    result.m11 = left.m8*right.m3 + left.m9*right.m7 + left.m10*right.m11 + left.m11*right.m15;
-    result.m12 = left.m12*right.m0 + left.m13*right.m4 + left.m14*right.m8 + left.m15*right.m12;
-    result.m13 = left.m12*right.m1 + left.m13*right.m5 + left.m14*right.m9 + left.m15*right.m13;
-    result.m14 = left.m12*right.m2 + left.m13*right.m6 + left.m14*right.m10 + left.m15*right.m14;
-    result.m15 = left.m12*right.m3 + left.m13*right.m7 + left.m14*right.m11 + left.m15*right.m15;
-
-    return result;
+void SlerpFast( std::span<const Quaternion> q1, std::span<const Quaternion> q2, float amount, std::span<Quaternion> out ) {
+    SlerpFast( q1.data(), q2.data(), amount, out.data(), q1.size() );
 }
+inline
+void SlerpFast( std::span<const Quaternion> q1, std::span<const Quaternion> q2, std::span<const float> amount, std::span<Quaternion> out ) {
+    SlerpFast( q1.data(), q2.data(), amount.data(), out.data(), q1.size() );
+}
+inline
+void Encode( std::span<const Vector3> v, std::span<Vec3Half> out ) {
+    Encode( v.data(), out.data(), v.size() );
+}
+inline
+void Decode( std::span<const Vec3Half> v, std::span<Vector3> out ) {
+    Decode( v.data(), out.data(), v.size() );
+}
+inline
+void Encode( std::span<const Vector3> v, std::span<NormalOct16> out ) {
+    Encode( v.data(), out.data(), v.size() );
+}
+inline
+void Decode( std::span<const NormalOct16> v, std::span<Vector3> out ) {
+    Decode( v.data(), out.data(), v.size() );
+}
+inline
+void Encode( std::span<const Quaternion> v, std::span<QuatPacked32> out ) {
+    Encode( v.data(), out.data(), v.size() );
+}
+inline
+void Decode( std::span<const QuatPacked32> v, std::span<Quaternion> out ) {
+    Decode( v.data(), out.data(), v.size() );
+}
+inline
+void Encode( std::span<const Quaternion> v, std::span<QuatPacked48> out ) {
+    Encode( v.data(), out.data(), v.size() );
+}
+inline
+void Decode( std::span<const QuatPacked48> v, std::span<Quaternion> out ) {
+    Decode( v.data(), out.data(), v.size() );
+}
+inline
+void Rebase( std::span<const Vec3T<double>> positions, const Vec3T<double>& origin, std::span<Vector3> out ) {
+    Rebase( positions.data(), origin, out.data(), positions.size() );
+}
+inline
+void Rebase( std::span<const Mat4T<double>> matrices, const Vec3T<double>& origin, std::span<Matrix> out ) {
+    Rebase( matrices.data(), origin, out.data(), matrices.size() );
+}
+/// normals and outNormals may be empty.
+inline
+void Skin(
+    std::span<const DualQuat> bones, std::span<const unsigned char> boneIds, std::span<const float> boneWeights,
+    std::span<const Vector3> positions, std::span<const Vector3> normals,
+    std::span<Vector3> outPositions, std::span<Vector3> outNormals
+) {
+    Skin( bones.data(), boneIds.data(), boneWeights.data(), positions.data(),
+        normals.empty() ? nullptr : normals.data(), outPositions.data(),
+        outNormals.empty() ? nullptr : outNormals.data(), positions.size() );
+}
+/// normals and outNormals may be empty.
+inline
+void Skin(
+    std::span<const Matrix> bones, std::span<const unsigned char> boneIds, std::span<const float> boneWeights,
+    std::span<const Vector3> positions, std::span<const Vector3> normals,
+    std::span<Vector3> outPositions, std::span<Vector3> outNormals
+) {
+    Skin( bones.data(), boneIds.data(), boneWeights.data(), positions.data(),
+        normals.empty() ? nullptr : normals.data(), outPositions.data(),
+        outNormals.empty() ? nullptr : outNormals.data(), positions.size() );
+}
+#endif
 
-struct Quat {
-    union {
-        float array[4];
-        struct { float x = 0.0f, y = 0.0f, z = 0.0f, w = 0.0f; };
-    };
-
-    Quat() {}
-    Quat( float x, float y, float z, float w ) : x(x), y(y), z(z), w(w) {}
-    explicit Quat( float pitch, float yaw, float roll ) : Quat( FromEuler(pitch, yaw, roll)) {}
-    explicit Quat( Vector3 from, Vector3 to ) : Quat( FromVector3ToVector3( from, to ) ) {}
-    explicit Quat( Vector3 axis, float angle ) : Quat( FromAxisAngle( axis, angle ) ) {}
-    explicit Quat( const Matrix& mat ) : Quat( FromMatrix( mat ) ) {}
-    Quat( const Quaternion& q ) : Quat( q.x, q.y, q.z, q.w ) {}
+#if defined(RAYMATH_CPP_PARALLEL)
+// NOTE(alicia): parallel batch overloads.
+// the array is cut into chunks of about RAYMATH_CPP_PARALLEL_CHUNK_BYTES
+// (input + output) and the chunks are handed out through an atomic
+// counter, so fast threads pick up the chunks slow ones don't get to.
+// every chunk runs the regular batch function on its own slice.
+// chunks are a multiple of 8 elements and start on one, so every element
+// takes the same path as in the single threaded call: the 4 or 8 wide
+// loop, or the scalar tail for the last count % 4. the output matches
+// the single threaded call exactly, even where the compiler contracts
+// the scalar tail to FMA and the wide loop doesn't.
+#if !defined(RAYMATH_CPP_PARALLEL_CHUNK_BYTES)
+    // NOTE(alicia): about half of a typical per core L2.
+    #define RAYMATH_CPP_PARALLEL_CHUNK_BYTES ( 128 * 1024 )
+#endif
 
-    static inline
-    Quat Identity() {
-        return QuaternionIdentity();
-    }
-    static inline
-    Quat FromVector3ToVector3( Vector3 from, Vector3 to ) {
-        return QuaternionFromVector3ToVector3( from, to );
+struct ThreadPool {
+    /// Starts threads - 1 workers, the calling thread is the last one.
+    /// 0 uses std::thread::hardware_concurrency().
+    explicit ThreadPool( unsigned threads = 0 ) {
+        if( !threads ) {
+            threads = std::thread::hardware_concurrency();
+        }
+        for( unsigned i = 1; i < threads; ++i ) {
+            workers.emplace_back( [this]() { Worker(); } );
+        }
     }
-    static inline
-    Quat FromMatrix( const Matrix& mat ) {
-        return QuaternionFromMatrix( mat );
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock( mutex );
+            stop = true;
+        }
+        wake.notify_all();
+        for( std::thread& worker : workers ) {
+            worker.join();
+        }
     }
+    ThreadPool( const ThreadPool& ) = delete;
+    ThreadPool& operator=( const ThreadPool& ) = delete;
+
+    /// Shared pool with one thread per core, started on first use.
     static inline
-    Quat FromAxisAngle( Vector3 axis, float angle ) {
-        return QuaternionFromAxisAngle( axis, angle );
-    }
+    ThreadPool& Default() {
+        static ThreadPool pool;
+        return pool;
+    }
+    /// Threads working on a call, including the caller.
+    inline
+    unsigned ThreadCount() const {
+        return (unsigned)workers.size() + 1;
+    }
+    /// Calls fn( begin, end ) for every chunk of [0, count) and
+    /// returns once all of them ran. fn must not throw.
+    /// Calls from different threads take turns.
+    template<typename Fn>
+    void For( size_t count, size_t chunk, const Fn& fn ) {
+        if( count <= chunk || workers.empty() ) {
+            if( count ) {
+                fn( (size_t)0, count );
+            }
+            return;
+        }
+        std::lock_guard<std::mutex> turn( submit );
+
+        Job job;
+        job.run     = &Invoke<Fn>;
+        job.context = &fn;
+        job.count   = count;
+        job.chunk   = chunk;
+        job.chunks  = ( count + chunk - 1 ) / chunk;
+        job.next.store( 0, std::memory_order_relaxed );
+        job.active  = 0;
+        {
+            std::lock_guard<std::mutex> lock( mutex );
+            current = &job;
+            ++generation;
+        }
+        wake.notify_all();
+
+        Run( job );
+
+        // NOTE(alicia): workers join a job under the lock,
+        // once current is cleared no one else can pick it up.
+        std::unique_lock<std::mutex> lock( mutex );
+        current = nullptr;
+        done.wait( lock, [&job]() { return job.active == 0; } );
+    }
+    /// Elements per chunk so that one chunk of input and output
+    /// fits in RAYMATH_CPP_PARALLEL_CHUNK_BYTES, a multiple of 8.
     static inline
-    Quat FromEuler( float pitch, float yaw, float roll ) {
-        return QuaternionFromEuler( pitch, yaw, roll );
+    size_t Chunk( size_t bytesPerElement ) {
+        size_t chunk = ( RAYMATH_CPP_PARALLEL_CHUNK_BYTES / bytesPerElement ) & ~(size_t)7;
+        return chunk < 8 ? 8 : chunk;
+    }
+private:
+    struct Job {
+        void (*run)( const void* context, size_t begin, size_t end );
+        const void*         context;
+        size_t              count;
+        size_t              chunk;
+        size_t              chunks;
+        std::atomic<size_t> next;
+        unsigned            active;
+    };
+    template<typename Fn>
+    static void Invoke( const void* context, size_t begin, size_t end ) {
+        (*(const Fn*)context)( begin, end );
+    }
+    static void Run( Job& job ) {
+        for( ;; ) {
+            size_t index = job.next.fetch_add( 1, std::memory_order_relaxed );
+            if( index >= job.chunks ) {
+                break;
+            }
+            size_t begin = index * job.chunk;
+            size_t end   = begin + job.chunk;
+            job.run( job.context, begin, end < job.count ? end : job.count );
+        }
     }
+    void Worker() {
+        std::unique_lock<std::mutex> lock( mutex );
+        size_t seen = generation;
+        for( ;; ) {
+            wake.wait( lock, [&]() {
+                return stop || ( current && generation != seen );
+            } );
+            if( stop ) {
+                return;
+            }
+            seen = generation;
+            Job* job = current;
+            ++job->active;
+            lock.unlock();
 
-    inline
-    operator Quaternion() const {
-        return *(Quaternion*)this;
-    }
-    inline
-    float operator[]( size_t idx ) const {
-        return array[idx];
-    }
-    inline
-    float& operator[]( size_t idx ) {
-        return array[idx];
-    }
+            Run( *job );
 
-    inline
-    Quat Add( Quaternion q2 ) const {
-        return QuaternionAdd( *this, q2 );
-    }
-    inline
-    Quat AddValue( float add ) const {
-        return QuaternionAddValue( *this, add );
-    }
-    inline
-    Quat Subtract( Quaternion q2 ) const {
-        return QuaternionSubtract( *this, q2 );
-    }
-    inline
-    Quat SubtractValue( float add ) const {
-        return QuaternionSubtractValue( *this, add );
-    }
-    inline
-    float Length() const {
-        return QuaternionLength( *this );
-    }
-    inline
-    Quat Normalize() const {
-        return QuaternionNormalize( *this );
-    }
-    inline
-    Quat Invert() const {
-        return QuaternionInvert( *this );
-    }
-    inline
-    Quat Multiply( Quaternion q2 ) const {
-        return QuaternionMultiply( *this, q2 );
-    }
-    inline
-    Quat Scale( float mul ) const {
-        return QuaternionScale( *this, mul );
-    }
-    inline
-    Quat Divide( Quaternion q2 ) const {
-        return QuaternionDivide( *this, q2 );
-    }
-    inline
-    Quat Lerp( Quaternion q2, float amount ) const {
-        return QuaternionLerp( *this, q2, amount );
-    }
-    inline
-    Quat Nlerp( Quaternion q2, float amount ) const {
-        return QuaternionNlerp( *this, q2, amount );
-    }
-    inline
-    Quat Slerp( Quaternion q2, float amount ) const {
-        return QuaternionSlerp( *this, q2, amount );
-    }
-    inline
-    Mat4 ToMatrix() const {
-        return QuaternionToMatrix( *this );
-    }
-    inline
-    void ToAxisAngle( Vector3* outAxis, float* outAngle ) const {
-        QuaternionToAxisAngle( *this, outAxis, outAngle );
-    }
-    inline
-    void ToAxisAngle( Vec3* outAxis, float* outAngle ) const {
-        QuaternionToAxisAngle( *this, (Vector3*)outAxis, outAngle );
-    }
-    inline
-    Vec3 ToEuler() const {
-        return QuaternionToEuler( *this );
-    }
-    inline
-    Quat Transform( const Matrix& mat ) const {
-        return QuaternionTransform( *this, mat );
-    }
-    inline
-    bool Equals( Quaternion q ) const {
-        return QuaternionEquals( *this, q );
+            lock.lock();
+            if( !--job->active ) {
+                done.notify_all();
+            }
+        }
     }
+
+    std::vector<std::thread> workers;
+    std::mutex               submit;
+    std::mutex               mutex;
+    std::condition_variable  wake;
+    std::condition_variable  done;
+    Job*                     current    = nullptr;
+    size_t                   generation = 0;
+    bool                     stop       = false;
 };
+
 inline
-Quat operator+( Quaternion v1, Quaternion v2 ) {
-    return QuaternionAdd( v1, v2 );
+void Normalize( ThreadPool& pool, const Vector2* v, Vector2* out, size_t count ) {
+    pool.For( count, ThreadPool::Chunk( sizeof(Vector2) * 2 ), [=]( size_t begin, size_t end ) {
+        Normalize( v + begin, out + begin, end - begin );
+    } );
 }
 inline
-Quat operator-( Quaternion v1, Quaternion v2 ) {
-    return QuaternionSubtract( v1, v2 );
+void Lerp( ThreadPool& pool, const Vector2* v1, const Vector2* v2, float amount, Vector2* out, size_t count ) {
+    pool.For( count, ThreadPool::Chunk( sizeof(Vector2) * 3 ), [=]( size_t begin, size_t end ) {
+        Lerp( v1 + begin, v2 + begin, amount, out + begin, end - begin );
+    } );
 }
 inline
-Quat operator*( Quaternion v1, float scale ) {
-    return QuaternionScale( v1, scale );
+void Normalize( ThreadPool& pool, const Vector3* v, Vector3* out, size_t count ) {
+    pool.For( count, ThreadPool::Chunk( sizeof(Vector3) * 2 ), [=]( size_t begin, size_t end ) {
+        Normalize( v + begin, out + begin, end - begin );
+    } );
 }
 inline
-Quat operator*( float scale, Quaternion v1 ) {
-    return QuaternionScale( v1, scale );
+void Lerp( ThreadPool& pool, const Vector3* v1, const Vector3* v2, float amount, Vector3* out, size_t count ) {
+    pool.For( count, ThreadPool::Chunk( sizeof(Vector3) * 3 ), [=]( size_t begin, size_t end ) {
+        Lerp( v1 + begin, v2 + begin, amount, out + begin, end - begin );
+    } );
 }
 inline
-Quat operator*( Quaternion lhs, const Matrix& rhs ) {
-    return QuaternionTransform( lhs, rhs );
+void Transform( ThreadPool& pool, const Vector3* v, const Matrix& mat, Vector3* out, size_t count ) {
+    pool.For( count, ThreadPool::Chunk( sizeof(Vector3) * 2 ), [&]( size_t begin, size_t end ) {
+        Transform( v + begin, mat, out + begin, end - begin );
+    } );
 }
 inline
-Quat operator/( Quaternion v1, float scale ) {
-    return QuaternionScale( v1, 1.0f / scale );
+void TransformDirection( ThreadPool& pool, const Vector3* v, const Matrix& mat, Vector3* out, size_t count ) {
+    pool.For( count, ThreadPool::Chunk( sizeof(Vector3) * 2 ), [&]( size_t begin, size_t end ) {
+        TransformDirection( v + begin, mat, out + begin, end - begin );
+    } );
 }
 inline
-bool operator==( Quaternion p, Quaternion q ) {
-    return QuaternionEquals( p, q );
+void TransformProject( ThreadPool& pool, const Vector3* v, const Matrix& mat, Vector3* out, size_t count ) {
+    pool.For( count, ThreadPool::Chunk( sizeof(Vector3) * 2 ), [&]( size_t begin, size_t end ) {
+        TransformProject( v + begin, mat, out + begin, end - begin );
+    } );
 }
 inline
-bool operator!=( Quaternion p, Quaternion q ) {
-    return !( p == q );
+void Transform( ThreadPool& pool, const Vector3* v, const Affine3x4& affine, Vector3* out, size_t count ) {
+    pool.For( count, ThreadPool::Chunk( sizeof(Vector3) * 2 ), [&]( size_t begin, size_t end ) {
+        Transform( v + begin, affine, out + begin, end - begin );
+    } );
 }
 inline
-Quat Nlerp( Quaternion q1, Quaternion q2, float amount ) {
-    return QuaternionNlerp( q1, q2, amount );
+void Transform( ThreadPool& pool, const Vector4* v, const Matrix& mat, Vector4* out, size_t count ) {
+    pool.For( count, ThreadPool::Chunk( sizeof(Vector4) * 2 ), [&]( size_t begin, size_t end ) {
+        Transform( v + begin, mat, out + begin, end - begin );
+    } );
 }
 inline
-Quat Slerp( Quaternion q1, Quaternion q2, float amount ) {
-    return QuaternionSlerp( q1, q2, amount );
+void Normalize( ThreadPool& pool, const Vector4* v, Vector4* out, size_t count ) {
+    pool.For( count, ThreadPool::Chunk( sizeof(Vector4) * 2 ), [=]( size_t begin, size_t end ) {
+        Normalize( v + begin, out + begin, end - begin );
+    } );
 }
-// NOTE(alicia):
-// Lerp, Normalize,
-// Length and LengthSqr already implemented from Vector4
+inline
+void Lerp( ThreadPool& pool, const Vector4* v1, const Vector4* v2, float amount, Vector4* out, size_t count ) {
+    pool.For( count, ThreadPool::Chunk( sizeof(Vector4) * 3 ), [=]( size_t begin, size_t end ) {
+        Lerp( v1 + begin, v2 + begin, amount, out + begin, end - begin );
+    } );
+}
+inline
+void Nlerp( ThreadPool& pool, const Quaternion* q1, const Quaternion* q2, float amount, Quaternion* out, size_t count ) {
+    pool.For( count, ThreadPool::Chunk( sizeof(Quaternion) * 3 ), [=]( size_t begin, size_t end ) {
+        Nlerp( q1 + begin, q2 + begin, amount, out + begin, end - begin );
+    } );
+}
+inline
+void Slerp( ThreadPool& pool, const Quaternion* q1, const Quaternion* q2, float amount, Quaternion* out, size_t count ) {
+    pool.For( count, ThreadPool::Chunk( sizeof(Quaternion) * 3 ), [=]( size_t begin, size_t end ) {
+        Slerp( q1 + begin, q2 + begin, amount, out + begin, end - begin );
+    } );
+}
+inline
+void Slerp( ThreadPool& pool, const Quaternion* q1, const Quaternion* q2, const float* amount, Quaternion* out, size_t count ) {
+    pool.For( count, ThreadPool::Chunk( sizeof(Quaternion) * 3 + sizeof(float) ), [=]( size_t begin, size_t end ) {
+        Slerp( q1 + begin, q2 + begin, amount + begin, out + begin, end - begin );
+    } );
+}
+inline
+void SlerpFast( ThreadPool& pool, const Quaternion* q1, const Quaternion* q2, float amount, Quaternion* out, size_t count ) {
+    pool.For( count, ThreadPool::Chunk( sizeof(Quaternion) * 3 ), [=]( size_t begin, size_t end ) {
+        SlerpFast( q1 + begin, q2 + begin, amount, out + begin, end - begin );
+    } );
+}
+inline
+void SlerpFast( ThreadPool& pool, const Quaternion* q1, const Quaternion* q2, const float* amount, Quaternion* out, size_t count ) {
+    pool.For( count, ThreadPool::Chunk( sizeof(Quaternion) * 3 + sizeof(float) ), [=]( size_t begin, size_t end ) {
+        SlerpFast( q1 + begin, q2 + begin, amount + begin, out + begin, end - begin );
+    } );
+}
+inline
+void Normalize( ThreadPool& pool, const Vec2* v, Vec2* out, size_t count ) {
+    Normalize( pool, (const Vector2*)v, (Vector2*)out, count );
+}
+inline
+void Lerp( ThreadPool& pool, const Vec2* v1, const Vec2* v2, float amount, Vec2* out, size_t count ) {
+    Lerp( pool, (const Vector2*)v1, (const Vector2*)v2, amount, (Vector2*)out, count );
+}
+inline
+void Normalize( ThreadPool& pool, const Vec3* v, Vec3* out, size_t count ) {
+    Normalize( pool, (const Vector3*)v, (Vector3*)out, count );
+}
+inline
+void Lerp( ThreadPool& pool, const Vec3* v1, const Vec3* v2, float amount, Vec3* out, size_t count ) {
+    Lerp( pool, (const Vector3*)v1, (const Vector3*)v2, amount, (Vector3*)out, count );
+}
+inline
+void Transform( ThreadPool& pool, const Vec3* v, const Matrix& mat, Vec3* out, size_t count ) {
+    Transform( pool, (const Vector3*)v, mat, (Vector3*)out, count );
+}
+inline
+void TransformDirection( ThreadPool& pool, const Vec3* v, const Matrix& mat, Vec3* out, size_t count ) {
+    TransformDirection( pool, (const Vector3*)v, mat, (Vector3*)out, count );
+}
+inline
+void TransformProject( ThreadPool& pool, const Vec3* v, const Matrix& mat, Vec3* out, size_t count ) {
+    TransformProject( pool, (const Vector3*)v, mat, (Vector3*)out, count );
+}
+inline
+void Transform( ThreadPool& pool, const Vec3* v, const Affine3x4& affine, Vec3* out, size_t count ) {
+    Transform( pool, (const Vector3*)v, affine, (Vector3*)out, count );
+}
+inline
+void Transform( ThreadPool& pool, const Vec4* v, const Matrix& mat, Vec4* out, size_t count ) {
+    Transform( pool, (const Vector4*)v, mat, (Vector4*)out, count );
+}
+inline
+void Normalize( ThreadPool& pool, const Vec4* v, Vec4* out, size_t count ) {
+    Normalize( pool, (const Vector4*)v, (Vector4*)out, count );
+}
+inline
+void Lerp( ThreadPool& pool, const Vec4* v1, const Vec4* v2, float amount, Vec4* out, size_t count ) {
+    Lerp( pool, (const Vector4*)v1, (const Vector4*)v2, amount, (Vector4*)out, count );
+}
+inline
+void Nlerp( ThreadPool& pool, const Quat* q1, const Quat* q2, float amount, Quat* out, size_t count ) {
+    Nlerp( pool, (const Quaternion*)q1, (const Quaternion*)q2, amount, (Quaternion*)out, count );
+}
+inline
+void Slerp( ThreadPool& pool, const Quat* q1, const Quat* q2, float amount, Quat* out, size_t count ) {
+    Slerp( pool, (const Quaternion*)q1, (const Quaternion*)q2, amount, (Quaternion*)out, count );
+}
+inline
+void Slerp( ThreadPool& pool, const Quat* q1, const Quat* q2, const float* amount, Quat* out, size_t count ) {
+    Slerp( pool, (const Quaternion*)q1, (const Quaternion*)q2, amount, (Quaternion*)out, count );
+}
+inline
+void SlerpFast( ThreadPool& pool, const Quat* q1, const Quat* q2, float amount, Quat* out, size_t count ) {
+    SlerpFast( pool, (const Quaternion*)q1, (const Quaternion*)q2, amount, (Quaternion*)out, count );
+}
+inline
+void SlerpFast( ThreadPool& pool, const Quat* q1, const Quat* q2, const float* amount, Quat* out, size_t count ) {
+    SlerpFast( pool, (const Quaternion*)q1, (const Quaternion*)q2, amount, (Quaternion*)out, count );
+}
+
+inline
+bool Bvh::Build( ThreadPool& pool, const Vector3* min, const Vector3* max, size_t count ) {
+    return BuildWith( pool, min, max, count );
+}
+inline
+bool TransformHierarchy::Update( ThreadPool& pool ) {
+    return UpdateWith( pool, ThreadPool::Chunk( sizeof(Matrix) + sizeof(Quaternion) + 2 * sizeof(Vector3) ) );
+}
+inline
+bool SpatialGrid::Build( ThreadPool& pool, const Vector3* points, size_t count, float cellSize ) {
+    return BuildWith( pool, pool.ThreadCount(), points, nullptr, count, cellSize );
+}
+inline
+bool SpatialGrid::Build( ThreadPool& pool, const Vector2* points, size_t count, float cellSize ) {
+    return BuildWith( pool, pool.ThreadCount(), nullptr, points, count, cellSize );
+}
+template<typename Fn>
+size_t SpatialGrid::Pairs( ThreadPool& pool, float radius, const Fn& fn ) const {
+    std::atomic<size_t> found( 0 );
+    pool.For( state.count, PairChunk, [&]( size_t begin, size_t end ) {
+        found.fetch_add( PairsIn( begin, end, radius, fn ), std::memory_order_relaxed );
+    } );
+    return found.load( std::memory_order_relaxed );
+}
+#endif
 
 #endif /* header guard */